@@ -0,0 +1,18 @@
+#include "Crc32.h"
+
+uint32_t Crc32(const void* data, size_t length)
+{
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  uint32_t crc = 0xFFFFFFFF;
+
+  while(length--)
+  {
+    crc ^= *bytes++;
+    for(uint8_t bit = 0; bit < 8; ++bit)
+    {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+
+  return ~crc;
+}
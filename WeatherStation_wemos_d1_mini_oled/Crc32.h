@@ -0,0 +1,9 @@
+#ifndef _CRC32_H
+#define _CRC32_H
+
+#include <Arduino.h>
+
+///////////////// CODE
+// CRC-32 (IEEE) of the records kept on SPIFFS and in RTC memory
+uint32_t Crc32(const void* data, size_t length);
+#endif
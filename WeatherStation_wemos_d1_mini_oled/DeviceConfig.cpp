@@ -0,0 +1,294 @@
+#include "DeviceConfig.h"
+
+static_assert(sizeof(pageIntervalParams) / sizeof(pageIntervalParams[0]) == DISPLAY_PAGE_COUNT, "Every EDisplayPage needs a config key");
+static_assert(sizeof(SDeviceConfig) <= UINT16_MAX, "Config size has to fit the record header");
+static_assert(sizeof(SDeviceConfig::m_wifiName) + sizeof(SDeviceConfig::m_padding0) + sizeof(SDeviceConfig::m_lat)
+    + sizeof(SDeviceConfig::m_lon) + sizeof(SDeviceConfig::m_apiKey) + sizeof(SDeviceConfig::m_screenSaver)
+    + sizeof(SDeviceConfig::m_padding1) + sizeof(SDeviceConfig::m_screenSaverTime) + sizeof(SDeviceConfig::m_screenSaverTimeOff)
+    + sizeof(SDeviceConfig::m_dndMode) + sizeof(SDeviceConfig::m_dndFrom) + sizeof(SDeviceConfig::m_dndTo)
+    + sizeof(SDeviceConfig::m_celsius) + sizeof(SDeviceConfig::m_celsiusSign) + sizeof(SDeviceConfig::m_rotateDisplay)
+    + sizeof(SDeviceConfig::m_pageIntervals) == deviceConfigSizes[DEVICE_CONFIG_VERSION], "SDeviceConfig needs its padding spelled out");
+
+namespace
+{
+  void ReadJsonString(JsonObjectConst obj, const char* key, char* value, size_t size)
+  {
+    const char* received = obj[key];
+    if(received)
+    {
+      strlcpy(value, received, size);
+    }
+  }
+
+  template<typename T>
+  void ReadJsonValue(JsonObjectConst obj, const char* key, T& value)
+  {
+    if(!obj[key].isNull())
+    {
+      value = obj[key].as<T>();
+    }
+  }
+
+  // Only overwrites the fields json has
+  void ReadJson(JsonObjectConst obj, SDeviceConfig& config)
+  {
+    ReadJsonString(obj, PARAM_WIFINAME, config.m_wifiName, sizeof(config.m_wifiName));
+    ReadJsonValue(obj, PARAM_LAT, config.m_lat);
+    ReadJsonValue(obj, PARAM_LON, config.m_lon);
+    ReadJsonString(obj, PARAM_APIKEY, config.m_apiKey, sizeof(config.m_apiKey));
+    ReadJsonValue(obj, PARAM_SCREENSAVER, config.m_screenSaver);
+    ReadJsonValue(obj, PARAM_SCREENSAVERTIME, config.m_screenSaverTime);
+    ReadJsonValue(obj, PARAM_SCREENSAVERTIMEOFF, config.m_screenSaverTimeOff);
+    ReadJsonValue(obj, PARAM_DNDMODE, config.m_dndMode);
+    ReadJsonValue(obj, PARAM_DNDFROM, config.m_dndFrom);
+    ReadJsonValue(obj, PARAM_DNDTO, config.m_dndTo);
+    ReadJsonValue(obj, PARAM_CELSIUS, config.m_celsius);
+    ReadJsonValue(obj, PARAM_CELSIUSSIGN, config.m_celsiusSign);
+    ReadJsonValue(obj, PARAM_ROTATEDISPLAY, config.m_rotateDisplay);
+    for(uint8_t page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+    {
+      ReadJsonValue(obj, pageIntervalParams[page], config.m_pageIntervals[page]);
+      if(config.m_pageIntervals[page] > PAGE_MAX_INTERVAL)
+      {
+        config.m_pageIntervals[page] = PAGE_MAX_INTERVAL;
+      }
+    }
+  }
+
+  void WriteJson(const SDeviceConfig& config, JsonObject obj)
+  {
+    obj[PARAM_WIFINAME] = config.m_wifiName;
+    obj[PARAM_LAT] = config.m_lat;
+    obj[PARAM_LON] = config.m_lon;
+    obj[PARAM_SCREENSAVER] = config.m_screenSaver;
+    obj[PARAM_SCREENSAVERTIME] = config.m_screenSaverTime;
+    obj[PARAM_SCREENSAVERTIMEOFF] = config.m_screenSaverTimeOff;
+    obj[PARAM_DNDMODE] = config.m_dndMode;
+    obj[PARAM_DNDFROM] = config.m_dndFrom;
+    obj[PARAM_DNDTO] = config.m_dndTo;
+    obj[PARAM_CELSIUS] = config.m_celsius;
+    obj[PARAM_CELSIUSSIGN] = config.m_celsiusSign;
+    obj[PARAM_ROTATEDISPLAY] = config.m_rotateDisplay;
+    obj[PARAM_APIKEY] = config.m_apiKey;
+    for(uint8_t page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+    {
+      obj[pageIntervalParams[page]] = config.m_pageIntervals[page];
+    }
+  }
+}
+
+SDeviceConfig::SDeviceConfig()
+  : m_wifiName(DEVICE_NAME)
+  , m_padding0{}
+  , m_lat(0)
+  , m_lon(0)
+  , m_apiKey("XXXXXXXXXXXXXXXXXXXXXXXXXX")
+  , m_screenSaver(true)
+  , m_padding1{}
+  , m_screenSaverTime(WEATHER_DISPLAY_OLED_START_REFRESH * 1000 * 60)
+  , m_screenSaverTimeOff(WEATHER_DISPLAY_OLED_END_REFRESH * 1000)
+  , m_dndMode(true)
+  , m_dndFrom(23)
+  , m_dndTo(7)
+  , m_celsius(true)
+  , m_celsiusSign(true)
+  , m_rotateDisplay(false)
+  , m_pageIntervals{ PAGE_WEATHER_DEFAULT_INTERVAL, PAGE_TEMPERATURE_DEFAULT_INTERVAL, PAGE_POP_DEFAULT_INTERVAL, PAGE_STATUS_DEFAULT_INTERVAL }
+  {
+  }
+
+CDeviceConfig::CDeviceConfig()
+  : m_config()
+  {
+  }
+
+void CDeviceConfig::Begin()
+{
+  const unsigned long loadStart = micros();
+
+  // A save interrupted before its rename leaves a complete temp record, the
+  // CRC tells it apart from one interrupted while writing
+  SDeviceConfig config;
+  if(LoadRecord(DEVICE_CONFIG_FILE, config)
+    || LoadRecord(DEVICE_CONFIG_TEMP_FILE, config)
+    || LoadRecord(DEVICE_CONFIG_PREVIOUS_FILE, config))
+  {
+    m_config.Publish(config);
+
+    DEBUG_LOG(F("[DeviceConfig] Loaded in us: "));
+    DEBUG_LOG_LN(micros() - loadStart);
+    return;
+  }
+
+  config = SDeviceConfig();
+  if(LoadLegacyJson(config))
+  {
+    DEBUG_LOG_LN(F("[DeviceConfig] Migrating JSON configuration"));
+  }
+
+  if(Save(config))
+  {
+    SPIFFS.remove(DEVICE_CONFIG_LEGACY_FILE);
+  }
+  else
+  {
+    // Runs with it all the same, the next save may get through
+    m_config.Publish(config);
+  }
+}
+
+bool CDeviceConfig::Save(const SDeviceConfig& config)
+{
+  if(!WriteRecord(DEVICE_CONFIG_TEMP_FILE, config))
+  {
+    SPIFFS.remove(DEVICE_CONFIG_TEMP_FILE);
+    return false;
+  }
+
+  // A broken current record doesn't push out the previous generation. SPIFFS
+  // doesn't rename over an existing file.
+  SDeviceConfig current;
+  if(LoadRecord(DEVICE_CONFIG_FILE, current))
+  {
+    SPIFFS.remove(DEVICE_CONFIG_PREVIOUS_FILE);
+    if(!SPIFFS.rename(DEVICE_CONFIG_FILE, DEVICE_CONFIG_PREVIOUS_FILE))
+    {
+      DEBUG_LOG_LN(F("[DeviceConfig] Failed to keep the previous record"));
+    }
+  }
+  SPIFFS.remove(DEVICE_CONFIG_FILE);
+
+  if(!SPIFFS.rename(DEVICE_CONFIG_TEMP_FILE, DEVICE_CONFIG_FILE))
+  {
+    // Still loaded from the temp file on the next boot
+    DEBUG_LOG_LN(F("[DeviceConfig] Failed to rename the new record"));
+  }
+
+  m_config.Publish(config);
+  return true;
+}
+
+void CDeviceConfig::ToJson(JsonObject obj) const
+{
+  WriteJson(m_config.Read(), obj);
+}
+
+bool CDeviceConfig::FromJson(const char* json, size_t length, SDeviceConfig& config)
+{
+  DynamicJsonDocument document(DEVICE_CONFIG_JSON_SIZE);
+  const DeserializationError err = deserializeJson(document, json, length);
+  if(err || !document.is<JsonObject>())
+  {
+    DEBUG_LOG(F("[DeviceConfig] Import failed: "));
+    DEBUG_LOG_LN(err.c_str());
+    return false;
+  }
+
+  ReadJson(document.as<JsonObjectConst>(), config);
+  return true;
+}
+
+bool CDeviceConfig::Erase()
+{
+  const bool erased = SPIFFS.remove(DEVICE_CONFIG_FILE);
+  SPIFFS.remove(DEVICE_CONFIG_TEMP_FILE);
+  SPIFFS.remove(DEVICE_CONFIG_PREVIOUS_FILE);
+  SPIFFS.remove(DEVICE_CONFIG_LEGACY_FILE);
+  return erased;
+}
+
+bool CDeviceConfig::LoadRecord(const char* path, SDeviceConfig& config)
+{
+  File configFile = SPIFFS.open(path, "r");
+  if(!configFile)
+  {
+    return false;
+  }
+
+  // Only the fields of the record version are copied, the ones it doesn't
+  // have keep the defaults config comes with
+  SDeviceConfigRecord record;
+  const size_t bytesRead = configFile.read(reinterpret_cast<uint8_t*>(&record), sizeof(record));
+  configFile.close();
+
+  const SDeviceConfigHeader& header = record.m_header;
+  const bool valid = bytesRead >= sizeof(header)
+      && header.m_magic == DEVICE_CONFIG_MAGIC
+      && header.m_version >= 1
+      && header.m_version <= DEVICE_CONFIG_VERSION
+      && header.m_size == deviceConfigSizes[header.m_version]
+      && bytesRead == sizeof(header) + header.m_size
+      && header.m_crc == Crc32(&record.m_config, header.m_size);
+
+  DEBUG_LOG(F("[DeviceConfig] Record valid: "));
+  DEBUG_LOG(path);
+  DEBUG_LOG(F(", "));
+  DEBUG_LOG_LN(valid);
+
+  if(!valid)
+  {
+    return false;
+  }
+
+  memcpy(reinterpret_cast<uint8_t*>(&config), &record.m_config, deviceConfigSizes[header.m_version]);
+  config.m_wifiName[sizeof(config.m_wifiName) - 1] = '\0';
+  config.m_apiKey[sizeof(config.m_apiKey) - 1] = '\0';
+  memset(config.m_padding0, 0, sizeof(config.m_padding0));
+  memset(config.m_padding1, 0, sizeof(config.m_padding1));
+  return true;
+}
+
+bool CDeviceConfig::WriteRecord(const char* path, const SDeviceConfig& config)
+{
+  const uint16_t configSize = deviceConfigSizes[DEVICE_CONFIG_VERSION];
+  const size_t recordSize = sizeof(SDeviceConfigHeader) + configSize;
+
+  // Cleared first so that no byte of the record is left to chance
+  SDeviceConfigRecord record;
+  memset(reinterpret_cast<uint8_t*>(&record), 0, sizeof(record));
+  record.m_header.m_magic   = DEVICE_CONFIG_MAGIC;
+  record.m_header.m_version = DEVICE_CONFIG_VERSION;
+  record.m_header.m_size    = configSize;
+  memcpy(reinterpret_cast<uint8_t*>(&record.m_config), &config, configSize);
+  record.m_header.m_crc     = Crc32(&record.m_config, configSize);
+
+  File configFile = SPIFFS.open(path, "w");
+  if(!configFile)
+  {
+    DEBUG_LOG_LN(F("[DeviceConfig] Failed to open file"));
+    return false;
+  }
+
+  const size_t bytesWritten = configFile.write(reinterpret_cast<const uint8_t*>(&record), recordSize);
+  configFile.close();
+
+  DEBUG_LOG(F("[DeviceConfig] Saved bytes: "));
+  DEBUG_LOG_LN(bytesWritten);
+
+  return bytesWritten == recordSize;
+}
+
+bool CDeviceConfig::LoadLegacyJson(SDeviceConfig& config)
+{
+  File configFile = SPIFFS.open(DEVICE_CONFIG_LEGACY_FILE, "r");
+  if(!configFile || !configFile.size())
+  {
+    return false;
+  }
+
+  DynamicJsonDocument document(DEVICE_CONFIG_JSON_SIZE);
+  const DeserializationError err = deserializeJson(document, configFile);
+  configFile.close();
+
+  if(err)
+  {
+    DEBUG_LOG(F("[DeviceConfig] deserializeJson() failed with code "));
+    DEBUG_LOG_LN(err.c_str());
+    return false;
+  }
+
+  // Files from before the page carousel keep showing only the weather
+  memset(config.m_pageIntervals, 0, sizeof(config.m_pageIntervals));
+  ReadJson(document[0], config);
+  return true;
+}
@@ -0,0 +1,147 @@
+#ifndef _DEVICECONFIG_H
+#define _DEVICECONFIG_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <ArduinoJson.h>
+
+#include "WeatherDisplay.h"
+#include "Crc32.h"
+#include "Snapshot.h"
+#include "DebugHelpers.h"
+
+///////////////// DEFINES
+// A new record goes to the temp file first and is renamed over the current
+// one, which is kept as the previous generation
+#define DEVICE_CONFIG_FILE "/config.bin"
+#define DEVICE_CONFIG_TEMP_FILE "/config.tmp"
+#define DEVICE_CONFIG_PREVIOUS_FILE "/config.bak"
+#define DEVICE_CONFIG_MAGIC 0x47434457 // "WDCG"
+// Fields are only ever appended to SDeviceConfig, a record of an older
+// version is read over the defaults of the ones it doesn't have. A new
+// version also adds its size to deviceConfigSizes.
+#define DEVICE_CONFIG_VERSION 1
+
+// JSON is only used to import and export the configuration, and to migrate
+// the file older firmware kept it in
+#define DEVICE_CONFIG_LEGACY_FILE "/configuration.json"
+#define DEVICE_CONFIG_JSON_SIZE 640
+
+#define DEVICE_CONFIG_NAME_SIZE 33
+#define DEVICE_CONFIG_API_KEY_SIZE 48
+
+#define DEVICE_NAME "WeatherStation_OLED_1"
+
+// Seconds each screen page is shown for on a new device, 0 hides it
+#define PAGE_WEATHER_DEFAULT_INTERVAL 20
+#define PAGE_TEMPERATURE_DEFAULT_INTERVAL 5
+#define PAGE_POP_DEFAULT_INTERVAL 5
+#define PAGE_STATUS_DEFAULT_INTERVAL 0
+#define PAGE_MAX_INTERVAL 3600
+
+///////////////// CODE
+// Keys of the JSON configuration, the config page fields have the same names
+const char* const PARAM_WIFINAME = "wifiName";
+const char* const PARAM_LAT = "lat";
+const char* const PARAM_LON = "lon";
+const char* const PARAM_SCREENSAVER = "screenSaver";
+const char* const PARAM_SCREENSAVERTIME = "screenSaverTime";
+const char* const PARAM_SCREENSAVERTIMEOFF = "screenSaverTimeOff";
+const char* const PARAM_DNDMODE = "DNDMode";
+const char* const PARAM_DNDFROM = "DNDFrom";
+const char* const PARAM_DNDTO = "DNDTo";
+const char* const PARAM_CELSIUS = "celsius";
+const char* const PARAM_CELSIUSSIGN = "celsiusSign";
+const char* const PARAM_ROTATEDISPLAY = "rotateDisplay";
+const char* const PARAM_APIKEY = "apiKey";
+const char* const PARAM_PAGEWEATHER = "pageWeather";
+const char* const PARAM_PAGETEMPERATURE = "pageTemperature";
+const char* const PARAM_PAGEPOP = "pagePoP";
+const char* const PARAM_PAGESTATUS = "pageStatus";
+
+// Indexed by EDisplayPage
+const char* const pageIntervalParams[] = { PARAM_PAGEWEATHER, PARAM_PAGETEMPERATURE, PARAM_PAGEPOP, PARAM_PAGESTATUS };
+
+// Settings from the config page. Constructed with the ones of a new device.
+// Stored as is up to its last field, new fields go to the end. The padding
+// the compiler would add between fields is spelled out and kept 0, so the
+// same settings always store the same bytes.
+struct SDeviceConfig
+{
+  SDeviceConfig();
+
+  char m_wifiName[DEVICE_CONFIG_NAME_SIZE];
+  uint8_t m_padding0[3];
+  float m_lat;
+  float m_lon;
+  char m_apiKey[DEVICE_CONFIG_API_KEY_SIZE];
+  bool m_screenSaver;
+  uint8_t m_padding1[3];
+  int32_t m_screenSaverTime;     // ms
+  int32_t m_screenSaverTimeOff;  // ms
+  bool m_dndMode;
+  uint8_t m_dndFrom;             // Hour
+  uint8_t m_dndTo;               // Hour, included
+  bool m_celsius;
+  bool m_celsiusSign;
+  bool m_rotateDisplay;
+  uint16_t m_pageIntervals[DISPLAY_PAGE_COUNT];  // Seconds
+};
+
+// Bytes of SDeviceConfig a record holds, indexed by its version. The tail
+// padding after the last field is never stored, a field appended later
+// would otherwise be read from it.
+constexpr uint16_t deviceConfigSizes[DEVICE_CONFIG_VERSION + 1] = {
+  0,
+  offsetof(SDeviceConfig, m_pageIntervals) + sizeof(SDeviceConfig::m_pageIntervals),
+};
+
+struct SDeviceConfigHeader
+{
+  uint32_t m_magic;
+  uint16_t m_version;
+  uint16_t m_size;    // Of the config that follows, deviceConfigSizes[m_version]
+  uint32_t m_crc;     // Of the config that follows
+};
+
+struct SDeviceConfigRecord
+{
+  SDeviceConfigHeader m_header;
+  SDeviceConfig m_config;
+};
+
+// The configuration record read once at boot. Everything else reads the
+// fields, the file is only touched again when a new configuration is saved.
+// Begin() and Save() belong to loop(), Get() can be called from anywhere.
+class CDeviceConfig
+{
+  public:
+    CDeviceConfig();
+
+    // Loads the newest valid record, a device without one gets its old JSON
+    // file migrated or the defaults written
+    void Begin();
+    // A copy, the web handlers read it while loop() may save a new one
+    SDeviceConfig Get() const { return m_config.Read(); }
+    // Writes the record and makes config the current configuration
+    bool Save(const SDeviceConfig& config);
+    // Changes with every saved configuration, whatever was derived from an
+    // older one is out of date
+    uint32_t GetGeneration() const { return m_config.GetGeneration(); }
+
+    // Every field under its PARAM_ key, times in ms
+    void ToJson(JsonObject obj) const;
+    // Reads json over config, keys it doesn't have keep their values
+    static bool FromJson(const char* json, size_t length, SDeviceConfig& config);
+    // Removes every stored generation, returns whether there was one
+    bool Erase();
+
+  private:
+    bool LoadRecord(const char* path, SDeviceConfig& config);
+    bool WriteRecord(const char* path, const SDeviceConfig& config);
+    bool LoadLegacyJson(SDeviceConfig& config);
+
+  private:
+    CSnapshot<SDeviceConfig> m_config;
+};
+#endif
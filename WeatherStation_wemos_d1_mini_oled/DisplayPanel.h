@@ -0,0 +1,113 @@
+#ifndef _DISPLAYPANEL_H
+#define _DISPLAYPANEL_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+///////////////// DEFINES
+// Panel the station is built for, one of the CPanel classes below. Can be
+// given as a build flag instead. `make -C tests panels` builds and renders
+// every one of them.
+//
+// The weather screen is laid out for the size of the panel, see
+// SWeatherLayout in WeatherDisplay.h. 128x32 panels get a 32 column
+// portrait screen with half size icons.
+#ifndef WEATHER_DISPLAY_PANEL
+#define WEATHER_DISPLAY_PANEL CPanelSH1106I2C
+#endif
+
+// Wemos D1 mini pins of the SPI panels, clock and data go to the hardware
+// SPI pins D5 and D7
+#define WEATHER_DISPLAY_SPI_CS D8
+#define WEATHER_DISPLAY_SPI_DC D3
+
+///////////////// CODE
+// A panel is the u8g2 driver of its controller, wired up for its bus, plus
+// what CWeatherDisplay needs to know about the controller. Only the one
+// picked above is built and it is used directly, without virtual calls.
+//
+// WIDTH x HEIGHT are the panel pixels, RAM_COLUMNS the columns of controller
+// RAM the visible ones are a window of.
+
+class CPanelSH1106I2C : public U8G2_SH1106_128X64_NONAME_F_HW_I2C
+{
+  public:
+    static constexpr uint8_t WIDTH = 128;
+    static constexpr uint8_t HEIGHT = 64;
+    static constexpr uint8_t RAM_COLUMNS = 132;
+
+    CPanelSH1106I2C()
+      : U8G2_SH1106_128X64_NONAME_F_HW_I2C(U8G2_R1, /* reset=*/ U8X8_PIN_NONE)
+      {
+      }
+};
+
+class CPanelSH1106SPI : public U8G2_SH1106_128X64_NONAME_F_4W_HW_SPI
+{
+  public:
+    static constexpr uint8_t WIDTH = 128;
+    static constexpr uint8_t HEIGHT = 64;
+    static constexpr uint8_t RAM_COLUMNS = 132;
+
+    CPanelSH1106SPI()
+      : U8G2_SH1106_128X64_NONAME_F_4W_HW_SPI(U8G2_R1, WEATHER_DISPLAY_SPI_CS, WEATHER_DISPLAY_SPI_DC, /* reset=*/ U8X8_PIN_NONE)
+      {
+      }
+};
+
+class CPanelSSD1306I2C : public U8G2_SSD1306_128X64_NONAME_F_HW_I2C
+{
+  public:
+    static constexpr uint8_t WIDTH = 128;
+    static constexpr uint8_t HEIGHT = 64;
+    static constexpr uint8_t RAM_COLUMNS = 128;
+
+    CPanelSSD1306I2C()
+      : U8G2_SSD1306_128X64_NONAME_F_HW_I2C(U8G2_R1, /* reset=*/ U8X8_PIN_NONE)
+      {
+      }
+};
+
+class CPanelSSD1306SPI : public U8G2_SSD1306_128X64_NONAME_F_4W_HW_SPI
+{
+  public:
+    static constexpr uint8_t WIDTH = 128;
+    static constexpr uint8_t HEIGHT = 64;
+    static constexpr uint8_t RAM_COLUMNS = 128;
+
+    CPanelSSD1306SPI()
+      : U8G2_SSD1306_128X64_NONAME_F_4W_HW_SPI(U8G2_R1, WEATHER_DISPLAY_SPI_CS, WEATHER_DISPLAY_SPI_DC, /* reset=*/ U8X8_PIN_NONE)
+      {
+      }
+};
+
+class CPanelSSD1306I2C128x32 : public U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C
+{
+  public:
+    static constexpr uint8_t WIDTH = 128;
+    static constexpr uint8_t HEIGHT = 32;
+    static constexpr uint8_t RAM_COLUMNS = 128;
+
+    CPanelSSD1306I2C128x32()
+      : U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C(U8G2_R1, /* reset=*/ U8X8_PIN_NONE)
+      {
+      }
+};
+
+class CPanelSSD1306SPI128x32 : public U8G2_SSD1306_128X32_UNIVISION_F_4W_HW_SPI
+{
+  public:
+    static constexpr uint8_t WIDTH = 128;
+    static constexpr uint8_t HEIGHT = 32;
+    static constexpr uint8_t RAM_COLUMNS = 128;
+
+    CPanelSSD1306SPI128x32()
+      : U8G2_SSD1306_128X32_UNIVISION_F_4W_HW_SPI(U8G2_R1, WEATHER_DISPLAY_SPI_CS, WEATHER_DISPLAY_SPI_DC, /* reset=*/ U8X8_PIN_NONE)
+      {
+      }
+};
+
+typedef WEATHER_DISPLAY_PANEL CDisplayPanel;
+
+static_assert(CDisplayPanel::RAM_COLUMNS >= CDisplayPanel::WIDTH, "The panel shows a window of its RAM columns");
+#endif
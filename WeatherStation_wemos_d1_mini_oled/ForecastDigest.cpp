@@ -0,0 +1,104 @@
+#include "ForecastDigest.h"
+
+#define SECONDS_IN_HOUR 3600UL
+#define SECONDS_IN_DAY (SECONDS_IN_HOUR * 24)
+
+static_assert(ONECALL_HOURLY_MAX_COUNT <= FORECAST_TIMELINE_MAX_COUNT, "Timeline can't hold all parsed hours");
+
+void BuildTimeline(const SOneCallForecast& forecast, SForecastTimeline& timeline)
+{
+  timeline.m_firstDt        = forecast.m_hourly.size() ? forecast.m_hourly[0].m_dt : 0;
+  timeline.m_timezoneOffset = forecast.m_timezoneOffset;
+  timeline.m_count          = forecast.m_hourly.size();
+
+  for(uint8_t index = 0; index < timeline.m_count; ++index)
+  {
+    const SHourlyForecast& hourly = forecast.m_hourly[index];
+    SForecastHour& hour = timeline.m_hours[index];
+
+    const float pop = hourly.m_pop < 0.f ? 0.f : (hourly.m_pop > 1.f ? 1.f : hourly.m_pop);
+
+    hour.m_weatherId = hourly.m_weatherId;
+    hour.m_feelsLike = RoundTemperature(hourly.m_feelsLike);
+    hour.m_pop       = static_cast<uint8_t>(pop * 100.f + 0.5f);
+  }
+}
+
+void DigestTimeline(const SForecastTimeline& timeline, uint8_t startIndex, SWeatherInfo& weatherInfo)
+{
+  weatherInfo = SWeatherInfo();
+
+  if(startIndex >= timeline.m_count)
+  {
+    return;
+  }
+
+  const SForecastHour& firstHour = timeline.m_hours[startIndex];
+  int16_t minTemperature = firstHour.m_feelsLike;
+  int16_t maxTemperature = firstHour.m_feelsLike;
+  int16_t midnightTemperature = 0;
+  bool midnightFound = false;
+  uint8_t worstRank = WEATHER_RANK_UNKNOWN;
+
+  unsigned long localTime = timeline.m_firstDt + timeline.m_timezoneOffset + startIndex * SECONDS_IN_HOUR;
+
+  for(uint8_t index = startIndex; index < timeline.m_count; ++index, localTime += SECONDS_IN_HOUR)
+  {
+    const SForecastHour& hour = timeline.m_hours[index];
+    const uint8_t offset = index - startIndex;
+
+    if(offset < WEATHER_CONDITIONS_COUNT_MAX)
+    {
+      const uint8_t rank = GetWeatherRank(hour.m_weatherId);
+      if(rank < worstRank)
+      {
+        worstRank = rank;
+        weatherInfo.m_weatherId = hour.m_weatherId;
+      }
+    }
+
+    if(offset < PROBABILITY_OF_PERCEPTION_MAX_COUNT)
+    {
+      weatherInfo.m_pop[weatherInfo.m_popCount++] = hour.m_pop;
+    }
+
+    minTemperature = hour.m_feelsLike < minTemperature ? hour.m_feelsLike : minTemperature;
+    maxTemperature = hour.m_feelsLike > maxTemperature ? hour.m_feelsLike : maxTemperature;
+
+    // The current hour never counts as midnight
+    if(offset > 0 && !midnightFound && localTime % SECONDS_IN_DAY < SECONDS_IN_HOUR)
+    {
+      midnightTemperature = hour.m_feelsLike;
+      midnightFound = true;
+    }
+  }
+
+  weatherInfo.m_currentTemp = firstHour.m_feelsLike;
+  weatherInfo.m_eveningTemp = midnightTemperature;
+  weatherInfo.m_minTemp     = minTemperature;
+  weatherInfo.m_maxTemp     = maxTemperature;
+}
+
+uint8_t GetTimelineIndex(const SForecastTimeline& timeline, unsigned long localTime)
+{
+  if(timeline.m_count == 0)
+  {
+    return FORECAST_TIMELINE_INDEX_UNKNOWN;
+  }
+
+  // Signed: before the first NTP sync local time is just the uptime
+  const int64_t time = static_cast<int64_t>(localTime) - timeline.m_timezoneOffset;
+  if(time < static_cast<int64_t>(timeline.m_firstDt))
+  {
+    return 0;
+  }
+
+  const unsigned long index = (time - timeline.m_firstDt) / SECONDS_IN_HOUR;
+  return index < timeline.m_count ? index : timeline.m_count - 1;
+}
+
+short RoundTemperature(float temperature)
+{
+  double intpart;
+  return modf(temperature, &intpart) >= 0.5f ? ceil(temperature) : floor(temperature);
+}
@@ -0,0 +1,31 @@
+#ifndef _FORECASTDIGEST_H
+#define _FORECASTDIGEST_H
+
+#include <Arduino.h>
+
+#include "OneCallParser.h"
+#include "WeatherInfo.h"
+#include "WeatherCodes.h"
+
+///////////////// DEFINES
+#define WEATHER_CONDITIONS_COUNT_MAX (int8_t)3
+
+#define FORECAST_TIMELINE_INDEX_UNKNOWN 0xFF
+
+///////////////// CODE
+// Converts the parsed hourly entries into the compact timeline, rounding
+// temperatures and PoP once per fetch.
+void BuildTimeline(const SOneCallForecast& forecast, SForecastTimeline& timeline);
+
+// Derives everything the display needs (worst weather code over the next
+// WEATHER_CONDITIONS_COUNT_MAX hours, PoP series, current/midnight and min/max
+// temperatures) in a single walk over the timeline, starting at startIndex.
+void DigestTimeline(const SForecastTimeline& timeline, uint8_t startIndex, SWeatherInfo& weatherInfo);
+
+// Timeline entry for the given local time (UTC + timezone offset of the
+// timeline). Times before the timeline map to its first entry, times after it
+// to the last one.
+uint8_t GetTimelineIndex(const SForecastTimeline& timeline, unsigned long localTime);
+
+short RoundTemperature(float temperature);
+#endif
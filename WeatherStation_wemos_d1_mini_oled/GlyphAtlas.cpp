@@ -0,0 +1,29 @@
+#include "GlyphAtlas.h"
+
+#ifndef GLYPH_ATLAS_GENERATED
+#warning "glyph_atlas.h is empty, the temperatures are drawn with the u8g2 fonts. Run tools/generate_assets.py with U8g2."
+#endif
+
+bool CGlyphAtlas::GetGlyph(uint8_t font, char character, SAtlasGlyph& glyph)
+{
+#ifdef GLYPH_ATLAS_GENERATED
+  for(uint8_t index = 0; index < GLYPH_ATLAS_GLYPH_COUNT; ++index)
+  {
+    memcpy_P(&glyph, &glyph_atlas_glyphs[index], sizeof(glyph));
+    if(glyph.m_font == font && glyph.m_character == character)
+    {
+      return true;
+    }
+  }
+#endif
+  return false;
+}
+
+const uint8_t* CGlyphAtlas::GetGlyphData(const SAtlasGlyph& glyph)
+{
+#ifdef GLYPH_ATLAS_GENERATED
+  return glyph_atlas_bits + glyph.m_data;
+#else
+  return nullptr;
+#endif
+}
@@ -0,0 +1,46 @@
+#ifndef _GLYPHATLAS_H
+#define _GLYPHATLAS_H
+
+#include <Arduino.h>
+
+///////////////// CODE
+// Fonts kept in the glyph atlas, temperatures are drawn from it
+enum EGlyphFont : uint8_t
+{
+  GLYPH_FONT_TEMPERATURE,
+  GLYPH_FONT_EVENING_TEMPERATURE,
+  GLYPH_FONT_DEGREE,
+  GLYPH_FONT_COUNT
+};
+
+// One glyph cut down to the pixels it lights. The bitmap is in the same
+// SH1106 page layout as the tools/generate_assets.py bitmaps, uncompressed.
+struct SAtlasGlyph
+{
+  uint8_t m_font;
+  char m_character;
+  // Top left corner of the bitmap from the cursor on the baseline
+  int8_t m_offsetX;
+  int8_t m_offsetY;
+  uint8_t m_width;
+  uint8_t m_height;
+  uint8_t m_advance;
+  // First byte of the bitmap in glyph_atlas_bits
+  uint16_t m_data;
+};
+
+#include "glyph_atlas.h"
+
+// Glyphs decoded from the U8g2 fonts by tools/generate_assets.py and kept in
+// PROGMEM, so that drawing text is a copy of their bytes. Without U8g2 the
+// script writes an empty atlas (no GLYPH_ATLAS_GENERATED) and the fonts are
+// used instead.
+class CGlyphAtlas
+{
+  public:
+    // Copies the glyph out of PROGMEM, false when the atlas doesn't hold it
+    static bool GetGlyph(uint8_t font, char character, SAtlasGlyph& glyph);
+    // Bitmap of the glyph, in PROGMEM
+    static const uint8_t* GetGlyphData(const SAtlasGlyph& glyph);
+};
+#endif
@@ -0,0 +1,411 @@
+#include "OneCallParser.h"
+
+static const char keyTimezoneOffset[] PROGMEM = "timezone_offset";
+static const char keyHourly[] PROGMEM = "hourly";
+static const char keyDt[] PROGMEM = "dt";
+static const char keyWeather[] PROGMEM = "weather";
+static const char keyId[] PROGMEM = "id";
+static const char keyPop[] PROGMEM = "pop";
+static const char keyFeelsLike[] PROGMEM = "feels_like";
+static const char keyNull[] PROGMEM = "null";
+
+COneCallParser::COneCallParser()
+  : m_forecast(nullptr)
+  , m_entry()
+  , m_state(STATE_STRUCTURE)
+  , m_readingKey(false)
+  , m_expectKey(false)
+  , m_done(false)
+  , m_error(false)
+  , m_depth(0)
+  , m_tokenLength(0)
+  {
+  }
+
+void COneCallParser::Reset(SOneCallForecast* forecast)
+{
+  m_forecast = forecast;
+  m_forecast->m_timezoneOffset = 0;
+  m_forecast->m_hourly.clear();
+
+  m_entry = SHourlyForecast();
+  m_state = STATE_STRUCTURE;
+  m_readingKey = false;
+  m_expectKey = false;
+  m_done = false;
+  m_error = false;
+  m_depth = 0;
+  m_tokenLength = 0;
+}
+
+size_t COneCallParser::Feed(const char* data, size_t length)
+{
+  size_t index = 0;
+  for(; index < length && !m_done && !m_error; ++index)
+  {
+    FeedChar(data[index]);
+  }
+
+  return index;
+}
+
+void COneCallParser::FeedChar(char c)
+{
+  switch(m_state)
+  {
+  case STATE_STRING:
+    if(c == '"')
+    {
+      m_state = STATE_STRUCTURE;
+      if(m_readingKey)
+      {
+        CommitKey();
+      }
+    }
+    else if(c == '\\')
+    {
+      m_state = STATE_STRING_ESCAPE;
+    }
+    else if(m_readingKey)
+    {
+      AppendToken(c);
+    }
+    return;
+
+  case STATE_STRING_ESCAPE:
+    // None of the keys we are looking for contain escapes
+    m_state = STATE_STRING;
+    m_tokenLength = ONECALL_PARSER_TOKEN_MAX + 1;
+    return;
+
+  case STATE_SCALAR:
+    if(c != ',' && c != '}' && c != ']' && !isspace(c))
+    {
+      AppendToken(c);
+      return;
+    }
+    CommitScalar();
+    m_state = STATE_STRUCTURE;
+    break;
+
+  default:
+    break;
+  }
+
+  switch(c)
+  {
+  case '{':
+    Push(false);
+    break;
+
+  case '[':
+    Push(true);
+    break;
+
+  case '}':
+    Pop(false);
+    break;
+
+  case ']':
+    Pop(true);
+    break;
+
+  case ',':
+    NextElement();
+    break;
+
+  case ':':
+    break;
+
+  case '"':
+    m_readingKey = m_expectKey && InObject();
+    m_tokenLength = 0;
+    m_state = STATE_STRING;
+    break;
+
+  case ' ':
+  case '\t':
+  case '\r':
+  case '\n':
+    break;
+
+  default:
+    m_tokenLength = 0;
+    AppendToken(c);
+    m_state = STATE_SCALAR;
+    break;
+  }
+}
+
+void COneCallParser::Push(bool isArray)
+{
+  if(m_depth >= ONECALL_PARSER_NESTING_MAX)
+  {
+    DEBUG_LOG_LN(F("[OneCallParser] Nested too deep"));
+    m_error = true;
+    return;
+  }
+
+  if(m_depth < ONECALL_PARSER_MAX_DEPTH)
+  {
+    m_isArray[m_depth] = isArray;
+    m_key[m_depth] = KEY_NONE;
+    m_index[m_depth] = 0;
+  }
+  ++m_depth;
+
+  m_expectKey = !isArray;
+
+  if(InHourlyEntry() && m_depth == 3)
+  {
+    m_entry = SHourlyForecast();
+  }
+}
+
+void COneCallParser::Pop(bool isArray)
+{
+  if(m_depth == 0 || (m_depth <= ONECALL_PARSER_MAX_DEPTH && m_isArray[m_depth - 1] != isArray))
+  {
+    DEBUG_LOG_LN(F("[OneCallParser] Unbalanced JSON"));
+    m_error = true;
+    return;
+  }
+
+  if(InHourlyEntry() && m_depth == 3)
+  {
+    m_forecast->m_hourly.push_back(m_entry);
+    if(m_forecast->m_hourly.full())
+    {
+      m_done = true;
+    }
+  }
+  else if(m_depth == 2 && m_isArray[1] && m_key[0] == KEY_HOURLY)
+  {
+    // Whole "hourly" array consumed, nothing else is needed
+    m_done = true;
+  }
+
+  --m_depth;
+  m_expectKey = false;
+
+  if(m_depth == 0)
+  {
+    m_done = true;
+  }
+}
+
+void COneCallParser::NextElement()
+{
+  if(m_depth == 0 || m_depth > ONECALL_PARSER_MAX_DEPTH)
+  {
+    return;
+  }
+
+  if(m_isArray[m_depth - 1])
+  {
+    if(m_index[m_depth - 1] < 0xFF)
+    {
+      ++m_index[m_depth - 1];
+    }
+  }
+  else
+  {
+    m_key[m_depth - 1] = KEY_NONE;
+    m_expectKey = true;
+  }
+}
+
+void COneCallParser::CommitKey()
+{
+  m_key[m_depth - 1] = MatchKey();
+  m_expectKey = false;
+  m_readingKey = false;
+}
+
+void COneCallParser::CommitScalar()
+{
+  if(m_tokenLength > ONECALL_PARSER_TOKEN_MAX)
+  {
+    return;
+  }
+  m_token[m_tokenLength] = '\0';
+
+  EKey key = KEY_NONE;
+  if(m_depth == 1 && !m_isArray[0] && m_key[0] == KEY_TIMEZONE_OFFSET)
+  {
+    key = KEY_TIMEZONE_OFFSET;
+  }
+  else if(m_depth == 3 && InHourlyEntry())
+  {
+    key = m_key[2];
+  }
+  else if(m_depth == 5 && InHourlyEntry() && m_key[2] == KEY_WEATHER && m_isArray[3] && m_index[3] == 0 && !m_isArray[4] && m_key[4] == KEY_ID)
+  {
+    key = KEY_ID;
+  }
+
+  if(key == KEY_NONE || key == KEY_HOURLY || key == KEY_WEATHER)
+  {
+    return;
+  }
+
+  double value = 0.;
+  if(!ParseNumber(value))
+  {
+    DEBUG_LOG(F("[OneCallParser] Malformed number: "));
+    DEBUG_LOG_LN(m_token);
+    m_error = true;
+    return;
+  }
+
+  switch(key)
+  {
+  case KEY_TIMEZONE_OFFSET:
+    m_forecast->m_timezoneOffset = long(value);
+    break;
+
+  case KEY_DT:
+    m_entry.m_dt = (unsigned long)(value);
+    break;
+
+  case KEY_ID:
+    m_entry.m_weatherId = (unsigned int)(value);
+    break;
+
+  case KEY_POP:
+    m_entry.m_pop = float(value);
+    break;
+
+  case KEY_FEELS_LIKE:
+    m_entry.m_feelsLike = float(value);
+    break;
+
+  default:
+    break;
+  }
+}
+
+bool COneCallParser::ParseNumber(double& value) const
+{
+  if(strcmp_P(m_token, keyNull) == 0)
+  {
+    value = 0.;
+    return true;
+  }
+
+  // JSON number grammar, strtod alone would also take hex, inf and nan
+  const char* c = m_token;
+  if(*c == '-')
+  {
+    ++c;
+  }
+  if(!isdigit(*c))
+  {
+    return false;
+  }
+  while(isdigit(*c))
+  {
+    ++c;
+  }
+  if(*c == '.')
+  {
+    ++c;
+    if(!isdigit(*c))
+    {
+      return false;
+    }
+    while(isdigit(*c))
+    {
+      ++c;
+    }
+  }
+  if(*c == 'e' || *c == 'E')
+  {
+    ++c;
+    if(*c == '+' || *c == '-')
+    {
+      ++c;
+    }
+    if(!isdigit(*c))
+    {
+      return false;
+    }
+    while(isdigit(*c))
+    {
+      ++c;
+    }
+  }
+  if(*c != '\0')
+  {
+    return false;
+  }
+
+  value = strtod(m_token, nullptr);
+  return true;
+}
+
+void COneCallParser::AppendToken(char c)
+{
+  if(m_tokenLength < ONECALL_PARSER_TOKEN_MAX)
+  {
+    m_token[m_tokenLength++] = c;
+  }
+  else
+  {
+    // Too long to be anything we care about
+    m_tokenLength = ONECALL_PARSER_TOKEN_MAX + 1;
+  }
+}
+
+bool COneCallParser::InObject() const
+{
+  return m_depth > 0 && m_depth <= ONECALL_PARSER_MAX_DEPTH && !m_isArray[m_depth - 1];
+}
+
+bool COneCallParser::InHourlyEntry() const
+{
+  return m_depth >= 3 && !m_isArray[0] && m_key[0] == KEY_HOURLY && m_isArray[1] && !m_isArray[2];
+}
+
+COneCallParser::EKey COneCallParser::MatchKey() const
+{
+  if(m_tokenLength > ONECALL_PARSER_TOKEN_MAX)
+  {
+    return KEY_NONE;
+  }
+
+  char key[ONECALL_PARSER_TOKEN_MAX + 1];
+  memcpy(key, m_token, m_tokenLength);
+  key[m_tokenLength] = '\0';
+
+  if(strcmp_P(key, keyDt) == 0)
+  {
+    return KEY_DT;
+  }
+  else if(strcmp_P(key, keyWeather) == 0)
+  {
+    return KEY_WEATHER;
+  }
+  else if(strcmp_P(key, keyId) == 0)
+  {
+    return KEY_ID;
+  }
+  else if(strcmp_P(key, keyPop) == 0)
+  {
+    return KEY_POP;
+  }
+  else if(strcmp_P(key, keyFeelsLike) == 0)
+  {
+    return KEY_FEELS_LIKE;
+  }
+  else if(strcmp_P(key, keyHourly) == 0)
+  {
+    return KEY_HOURLY;
+  }
+  else if(strcmp_P(key, keyTimezoneOffset) == 0)
+  {
+    return KEY_TIMEZONE_OFFSET;
+  }
+
+  return KEY_NONE;
+}
@@ -0,0 +1,104 @@
+#ifndef _ONECALLPARSER_H
+#define _ONECALLPARSER_H
+
+#include <Arduino.h>
+#include <Array.h>
+
+#include "DebugHelpers.h"
+
+///////////////// DEFINES
+// Everything OneCall returns, the display rolls over to later hours between fetches
+#define ONECALL_HOURLY_MAX_COUNT 48
+
+#define ONECALL_PARSER_MAX_DEPTH 6
+// Deeper nesting than this is an error instead of being skipped, the depth
+// counter would wrap otherwise
+#define ONECALL_PARSER_NESTING_MAX 64
+#define ONECALL_PARSER_TOKEN_MAX 24
+
+///////////////// CODE
+struct SHourlyForecast
+{
+  unsigned long m_dt = 0;
+  unsigned int m_weatherId = 0;
+  float m_pop = 0.f;
+  float m_feelsLike = 0.f;
+};
+
+struct SOneCallForecast
+{
+  long m_timezoneOffset = 0;
+  Array<SHourlyForecast, ONECALL_HOURLY_MAX_COUNT> m_hourly;
+};
+
+// Push parser for the OneCall response. Bytes are fed as they come off the
+// socket and only dt, weather[0].id, pop and feels_like of every "hourly"
+// entry (plus "timezone_offset") are kept. Parsing is done as soon as
+// ONECALL_HOURLY_MAX_COUNT hours were collected, the rest of the body can be dropped.
+// A kept value that is not a JSON number (or null, read as 0) is an error, the
+// same body deserializeJson would reject. Values of other keys are skipped
+// without being validated.
+class COneCallParser
+{
+  public:
+    COneCallParser();
+
+    void Reset(SOneCallForecast* forecast);
+    size_t Feed(const char* data, size_t length);
+
+    bool IsDone() const { return m_done; }
+    bool HasError() const { return m_error; }
+
+  private:
+    enum EState : uint8_t
+    {
+      STATE_STRUCTURE = 0,
+      STATE_STRING,
+      STATE_STRING_ESCAPE,
+      STATE_SCALAR
+    };
+
+    enum EKey : uint8_t
+    {
+      KEY_NONE = 0,
+      KEY_TIMEZONE_OFFSET,
+      KEY_HOURLY,
+      KEY_DT,
+      KEY_WEATHER,
+      KEY_ID,
+      KEY_POP,
+      KEY_FEELS_LIKE
+    };
+
+    void FeedChar(char c);
+    void Push(bool isArray);
+    void Pop(bool isArray);
+    void NextElement();
+    void CommitKey();
+    void CommitScalar();
+    bool ParseNumber(double& value) const;
+    void AppendToken(char c);
+
+    bool InObject() const;
+    bool InHourlyEntry() const;
+    EKey MatchKey() const;
+
+  private:
+    SOneCallForecast* m_forecast;
+    SHourlyForecast m_entry;
+
+    EState m_state;
+    bool m_readingKey;
+    bool m_expectKey;
+    bool m_done;
+    bool m_error;
+
+    uint8_t m_depth;
+    bool m_isArray[ONECALL_PARSER_MAX_DEPTH];
+    EKey m_key[ONECALL_PARSER_MAX_DEPTH];
+    uint8_t m_index[ONECALL_PARSER_MAX_DEPTH];
+
+    char m_token[ONECALL_PARSER_TOKEN_MAX + 1];
+    uint8_t m_tokenLength;
+};
+#endif
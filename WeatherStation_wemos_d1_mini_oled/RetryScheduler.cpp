@@ -0,0 +1,87 @@
+#include "RetryScheduler.h"
+
+CRetryScheduler::CRetryScheduler(unsigned long interval, unsigned long retryInterval, unsigned long maxInterval)
+  : m_interval(interval)
+  , m_retryInterval(retryInterval)
+  , m_maxInterval(maxInterval)
+  , m_consecutiveFailures(0)
+  , m_failures()
+  , m_lastError(FETCH_ERROR_NONE)
+  , m_currentInterval(interval)
+  , m_seed(1)
+  {
+  }
+
+unsigned long CRetryScheduler::OnSuccess()
+{
+  m_consecutiveFailures = 0;
+  m_lastError = FETCH_ERROR_NONE;
+  m_currentInterval = m_interval;
+
+  return m_currentInterval;
+}
+
+unsigned long CRetryScheduler::OnFailure(EFetchError error, unsigned long retryAfterSec)
+{
+  ++m_consecutiveFailures;
+  if(error < FETCH_ERROR_COUNT)
+  {
+    ++m_failures[error];
+  }
+  m_lastError = error;
+
+  unsigned long delay = 0;
+  switch(error)
+  {
+  case FETCH_ERROR_HTTP_UNAUTHORIZED:
+    delay = m_maxInterval;
+    break;
+
+  case FETCH_ERROR_HTTP_RATE_LIMITED:
+  {
+    const unsigned long retryAfter = retryAfterSec * 1000UL;
+    const unsigned long backoff = Jitter(Backoff());
+    // Retry-After is a lower bound, jitter only ever adds to it
+    delay = retryAfter > backoff ? retryAfter + Jitter(m_retryInterval) / 2 : backoff;
+    break;
+  }
+
+  default:
+    delay = Jitter(Backoff());
+    break;
+  }
+
+  m_currentInterval = delay;
+
+  DEBUG_LOG(F("[RetryScheduler] Failure: "));
+  DEBUG_LOG(FetchErrorToString(error));
+  DEBUG_LOG(F(", in a row: "));
+  DEBUG_LOG(m_consecutiveFailures);
+  DEBUG_LOG(F(", next try in ms: "));
+  DEBUG_LOG_LN(m_currentInterval);
+
+  return m_currentInterval;
+}
+
+unsigned long CRetryScheduler::Backoff() const
+{
+  const unsigned long doublings = m_consecutiveFailures - 1 < RETRY_SCHEDULER_MAX_DOUBLINGS ? m_consecutiveFailures - 1 : RETRY_SCHEDULER_MAX_DOUBLINGS;
+  // Compared before shifting so the multiplication can't overflow
+  if(m_retryInterval > (m_maxInterval >> doublings))
+  {
+    return m_maxInterval;
+  }
+
+  return m_retryInterval << doublings;
+}
+
+unsigned long CRetryScheduler::Jitter(unsigned long delay)
+{
+  // xorshift32, seeded per device
+  m_seed ^= m_seed << 13;
+  m_seed ^= m_seed >> 17;
+  m_seed ^= m_seed << 5;
+
+  const unsigned long half = delay / 2;
+  return half + (half ? m_seed % (half + 1) : 0);
+}
@@ -0,0 +1,51 @@
+#ifndef _RETRYSCHEDULER_H
+#define _RETRYSCHEDULER_H
+
+#include <Arduino.h>
+
+#include "WeatherFetcher.h"
+#include "DebugHelpers.h"
+
+///////////////// DEFINES
+// Exponent cap, keeps the shift well inside 32 bits
+#define RETRY_SCHEDULER_MAX_DOUBLINGS 10
+
+///////////////// CODE
+// Decides when the next weather request goes out. Failures back off
+// exponentially from the retry interval up to the maximum one. The delay is
+// then spread over its upper half with a per-device jitter, so stations that
+// share an API key don't all come back at the same moment after an outage.
+// A 429 Retry-After is never undercut, a 401 waits for the maximum interval
+// because repeating a request with a bad key can't succeed.
+class CRetryScheduler
+{
+  public:
+    CRetryScheduler(unsigned long interval, unsigned long retryInterval, unsigned long maxInterval);
+
+    void SetSeed(uint32_t seed) { m_seed = seed ? seed : 1; }
+
+    unsigned long OnSuccess();
+    unsigned long OnFailure(EFetchError error, unsigned long retryAfterSec);
+
+    unsigned long GetConsecutiveFailures() const { return m_consecutiveFailures; }
+    unsigned long GetFailures(EFetchError error) const { return error < FETCH_ERROR_COUNT ? m_failures[error] : 0; }
+    EFetchError GetLastError() const { return m_lastError; }
+    unsigned long GetCurrentInterval() const { return m_currentInterval; }
+
+  private:
+    unsigned long Backoff() const;
+    unsigned long Jitter(unsigned long delay);
+
+  private:
+    const unsigned long m_interval;
+    const unsigned long m_retryInterval;
+    const unsigned long m_maxInterval;
+
+    unsigned long m_consecutiveFailures;
+    unsigned long m_failures[FETCH_ERROR_COUNT];
+    EFetchError m_lastError;
+    unsigned long m_currentInterval;
+
+    uint32_t m_seed;
+};
+#endif
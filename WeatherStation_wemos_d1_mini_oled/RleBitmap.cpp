@@ -0,0 +1,85 @@
+#include "RleBitmap.h"
+
+CRleBitmapReader::CRleBitmapReader(const uint8_t* bitmap)
+  : m_data(bitmap)
+  , m_byte(0)
+  , m_highNibble(false)
+  , m_pixel(0)
+  , m_runLeft(0)
+  {
+  }
+
+// Sets count bits of data starting at bit first, whole bytes at once
+static void SetBits(uint8_t* data, uint16_t first, uint16_t count)
+{
+  for(; count && (first & 7); ++first, --count)
+  {
+    data[first >> 3] |= 1 << (first & 7);
+  }
+
+  if(count >= 8)
+  {
+    memset(data + (first >> 3), 0xFF, count >> 3);
+    first += count & ~7;
+    count &= 7;
+  }
+
+  for(; count; ++first, --count)
+  {
+    data[first >> 3] |= 1 << (first & 7);
+  }
+}
+
+void CRleBitmapReader::ReadBytes(uint8_t* data, uint8_t count)
+{
+  memset(data, 0, count);
+
+  const uint16_t bitCount = static_cast<uint16_t>(count) * 8;
+  for(uint16_t bit = 0; bit < bitCount; )
+  {
+    while(m_runLeft == 0)
+    {
+      NextRun();
+    }
+
+    // Rest of the run or of the data, whichever ends first
+    uint16_t run = bitCount - bit;
+    run = m_runLeft < run ? m_runLeft : run;
+    m_runLeft -= run;
+
+    if(m_pixel)
+    {
+      SetBits(data, bit, run);
+    }
+    bit += run;
+  }
+}
+
+uint8_t CRleBitmapReader::NextNibble()
+{
+  if(m_highNibble)
+  {
+    m_highNibble = false;
+    return m_byte >> 4;
+  }
+
+  m_byte = pgm_read_byte(m_data++);
+  m_highNibble = true;
+  return m_byte & 0x0F;
+}
+
+void CRleBitmapReader::NextRun()
+{
+  uint8_t nibble = 0;
+  uint8_t shift = 0;
+  m_runLeft = 0;
+
+  do
+  {
+    nibble = NextNibble();
+    m_runLeft |= static_cast<uint16_t>(nibble & 0x07) << shift;
+    shift += 3;
+  } while(nibble & 0x08);
+
+  m_pixel ^= 1;
+}
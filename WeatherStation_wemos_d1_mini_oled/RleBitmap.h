@@ -0,0 +1,34 @@
+#ifndef _RLEBITMAP_H
+#define _RLEBITMAP_H
+
+#include <Arduino.h>
+
+///////////////// DEFINES
+// Most columns of one bitmap page that can be read at a time
+#define RLE_BITMAP_PAGE_COLUMNS_MAX 64
+
+///////////////// CODE
+// Streams a bitmap produced by tools/generate_assets.py out of PROGMEM, one
+// page of SH1106 column bytes at a time. The data is a sequence of pixel runs
+// alternating between 1 and 0 (starting with 1), each length stored as a
+// varint of nibbles.
+class CRleBitmapReader
+{
+  public:
+    explicit CRleBitmapReader(const uint8_t* bitmap);
+
+    // Fills count bytes, 8 pixels of the stream each, least significant bit first
+    void ReadBytes(uint8_t* data, uint8_t count);
+
+  private:
+    uint8_t NextNibble();
+    void NextRun();
+
+  private:
+    const uint8_t* m_data;
+    uint8_t m_byte;
+    bool m_highNibble;
+    uint8_t m_pixel;
+    uint16_t m_runLeft;
+};
+#endif
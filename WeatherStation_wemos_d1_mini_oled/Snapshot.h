@@ -0,0 +1,92 @@
+#ifndef _SNAPSHOT_H
+#define _SNAPSHOT_H
+
+#include <stdint.h>
+#include <atomic>
+
+///////////////// CODE
+// State one context writes and others read, loop() and the async web
+// handlers. The writer fills the copy nobody reads and publishes it by
+// flipping the active index, a reader gets a whole copy of one generation
+// and never a mix of two.
+//
+// A reader pins the copy it reads. The writer only reuses the inactive copy
+// once its pins are gone, a reader that pinned a copy just as it went
+// inactive lets go and takes the new one. On the ESP8266 loop() and the
+// async callbacks don't preempt each other, so the writer never waits there.
+// Only one context may publish.
+template<typename T>
+class CSnapshot
+{
+  public:
+    CSnapshot()
+      : m_slots()
+      , m_generations()
+      , m_active(0)
+      , m_readers()
+      {
+      }
+
+    void Publish(const T& value)
+    {
+      const uint32_t active = m_active.load();
+      const uint32_t inactive = active ^ 1;
+
+      while(m_readers[inactive].load() != 0)
+      {
+      }
+
+      m_slots[inactive] = value;
+      m_generations[inactive] = m_generations[active] + 1;
+      m_active.store(inactive);
+    }
+
+    // Generation starts at 0 for the default constructed T and counts the
+    // publishes
+    T Read(uint32_t* generation = nullptr) const
+    {
+      const uint32_t index = Pin();
+      T value = m_slots[index];
+      if(generation)
+      {
+        *generation = m_generations[index];
+      }
+      Unpin(index);
+      return value;
+    }
+
+    uint32_t GetGeneration() const
+    {
+      const uint32_t index = Pin();
+      const uint32_t generation = m_generations[index];
+      Unpin(index);
+      return generation;
+    }
+
+  private:
+    uint32_t Pin() const
+    {
+      while(true)
+      {
+        const uint32_t index = m_active.load();
+        m_readers[index].fetch_add(1);
+        if(m_active.load() == index)
+        {
+          return index;
+        }
+        m_readers[index].fetch_sub(1);
+      }
+    }
+
+    void Unpin(uint32_t index) const
+    {
+      m_readers[index].fetch_sub(1);
+    }
+
+  private:
+    T m_slots[2];
+    uint32_t m_generations[2];
+    std::atomic<uint32_t> m_active;
+    mutable std::atomic<uint32_t> m_readers[2];
+};
+#endif
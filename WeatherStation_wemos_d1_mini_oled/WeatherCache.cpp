@@ -0,0 +1,88 @@
+#include "WeatherCache.h"
+
+static_assert(sizeof(SWeatherCacheRecord) <= WEATHER_CACHE_RTC_SIZE_MAX, "Weather cache record doesn't fit RTC user memory");
+static_assert(sizeof(SWeatherCacheRecord) % 4 == 0, "RTC user memory is accessed in 4 byte blocks");
+
+bool CWeatherCache::Load(SForecastTimeline& timeline)
+{
+  SWeatherCacheRecord record;
+
+  if(!LoadFromRtc(record) && !LoadFromFile(record))
+  {
+    DEBUG_LOG_LN(F("[WeatherCache] No cached forecast"));
+    return false;
+  }
+
+  timeline = record.m_timeline;
+
+  return true;
+}
+
+void CWeatherCache::Save(const SForecastTimeline& timeline)
+{
+  SWeatherCacheRecord record;
+  record.m_header.m_magic          = WEATHER_CACHE_MAGIC;
+  record.m_header.m_version        = WEATHER_CACHE_VERSION;
+  record.m_header.m_size           = sizeof(SWeatherCacheRecord);
+  record.m_timeline                = timeline;
+  record.m_header.m_crc            = Crc32(&record.m_timeline, sizeof(record.m_timeline));
+
+  ESP.rtcUserMemoryWrite(WEATHER_CACHE_RTC_OFFSET, reinterpret_cast<uint32_t*>(&record), sizeof(record));
+
+  File cacheFile = SPIFFS.open(F(WEATHER_CACHE_FILE), "w");
+  if(!cacheFile)
+  {
+    DEBUG_LOG_LN(F("[WeatherCache] Failed to open cache file"));
+    return;
+  }
+
+  const size_t bytesWritten = cacheFile.write(reinterpret_cast<const uint8_t*>(&record), sizeof(record));
+  cacheFile.close();
+
+  DEBUG_LOG(F("[WeatherCache] Saved bytes: "));
+  DEBUG_LOG_LN(bytesWritten);
+}
+
+bool CWeatherCache::LoadFromRtc(SWeatherCacheRecord& record)
+{
+  if(!ESP.rtcUserMemoryRead(WEATHER_CACHE_RTC_OFFSET, reinterpret_cast<uint32_t*>(&record), sizeof(record)))
+  {
+    return false;
+  }
+
+  // RTC memory holds garbage after a power loss
+  const bool valid = IsValid(record);
+
+  DEBUG_LOG(F("[WeatherCache] RTC record valid: "));
+  DEBUG_LOG_LN(valid);
+
+  return valid;
+}
+
+bool CWeatherCache::LoadFromFile(SWeatherCacheRecord& record)
+{
+  File cacheFile = SPIFFS.open(F(WEATHER_CACHE_FILE), "r");
+  if(!cacheFile)
+  {
+    return false;
+  }
+
+  const size_t bytesRead = cacheFile.read(reinterpret_cast<uint8_t*>(&record), sizeof(record));
+  cacheFile.close();
+
+  const bool valid = bytesRead == sizeof(record) && IsValid(record);
+
+  DEBUG_LOG(F("[WeatherCache] File record valid: "));
+  DEBUG_LOG_LN(valid);
+
+  return valid;
+}
+
+bool CWeatherCache::IsValid(const SWeatherCacheRecord& record)
+{
+  return record.m_header.m_magic == WEATHER_CACHE_MAGIC
+      && record.m_header.m_version == WEATHER_CACHE_VERSION
+      && record.m_header.m_size == sizeof(SWeatherCacheRecord)
+      && record.m_header.m_crc == Crc32(&record.m_timeline, sizeof(record.m_timeline))
+      && record.m_timeline.m_count <= FORECAST_TIMELINE_MAX_COUNT;
+}
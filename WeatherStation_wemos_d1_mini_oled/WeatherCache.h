@@ -0,0 +1,51 @@
+#ifndef _WEATHERCACHE_H
+#define _WEATHERCACHE_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "WeatherInfo.h"
+#include "Crc32.h"
+#include "DebugHelpers.h"
+
+///////////////// DEFINES
+#define WEATHER_CACHE_FILE "/weather.bin"
+#define WEATHER_CACHE_MAGIC 0x48435357 // "WSCH"
+#define WEATHER_CACHE_VERSION 3
+
+// RTC user memory survives soft resets (OTA, /restartdevice), offset in 4 byte
+// blocks. Blocks 0-31 hold the eboot command an OTA update leaves for the
+// bootloader, the record goes after them into the remaining 384 bytes.
+#define WEATHER_CACHE_RTC_OFFSET 32
+#define WEATHER_CACHE_RTC_SIZE_MAX 384
+
+///////////////// CODE
+struct SWeatherCacheHeader
+{
+  uint32_t m_magic;
+  uint16_t m_version;
+  uint16_t m_size;
+  uint32_t m_crc;
+};
+
+// Padded to whole 4 byte blocks for RTC user memory
+struct alignas(4) SWeatherCacheRecord
+{
+  SWeatherCacheHeader m_header;
+  SForecastTimeline m_timeline;
+};
+
+// Keeps the last forecast timeline across reboots so it can be shown right
+// after power up, long before WiFi and the first weather request are done.
+class CWeatherCache
+{
+  public:
+    bool Load(SForecastTimeline& timeline);
+    void Save(const SForecastTimeline& timeline);
+
+  private:
+    bool LoadFromRtc(SWeatherCacheRecord& record);
+    bool LoadFromFile(SWeatherCacheRecord& record);
+    bool IsValid(const SWeatherCacheRecord& record);
+};
+#endif
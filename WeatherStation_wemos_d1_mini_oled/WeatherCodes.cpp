@@ -0,0 +1,280 @@
+#include "WeatherCodes.h"
+
+#include <utility>
+
+// Table entry layout, one uint32_t per condition code:
+//   bits  0..5   severity rank
+//   bits  6..17  day:   weather type + 1 (5 bits), main icon (5 bits), aux icon (2 bits)
+//   bits 18..29  night: same as day
+#define WEATHER_CODE_RANK_BITS 6
+#define WEATHER_CODE_SIDE_BITS 12
+#define WEATHER_CODE_TYPE_BITS 5
+#define WEATHER_CODE_ICON_BITS 5
+
+#define WEATHER_CODE_RANK_MASK ((1UL << WEATHER_CODE_RANK_BITS) - 1)
+#define WEATHER_CODE_SIDE_MASK ((1UL << WEATHER_CODE_SIDE_BITS) - 1)
+#define WEATHER_CODE_TYPE_MASK ((1UL << WEATHER_CODE_TYPE_BITS) - 1)
+#define WEATHER_CODE_ICON_MASK ((1UL << WEATHER_CODE_ICON_BITS) - 1)
+
+namespace
+{
+  struct SCodeType
+  {
+    uint16_t m_code;
+    EWeatherType m_day;
+    EWeatherType m_night;
+  };
+
+  // Source of truth for the generated table
+  constexpr SCodeType codeTypes[] = {
+    // Thunderstorm
+    {200, THUNDERSTROM_LIGHT_RAIN, THUNDERSTROM_LIGHT_RAIN},
+    {201, THUNDERSTORM_RAIN, THUNDERSTORM_RAIN},
+    {202, THUNDERSTORM_HEAVY_RAIN, THUNDERSTORM_HEAVY_RAIN},
+    {210, THUNDERSTORM, THUNDERSTORM},
+    {211, THUNDERSTORM, THUNDERSTORM},
+    {212, THUNDERSTORM_HEAVY, THUNDERSTORM_HEAVY},
+    {221, THUNDERSTORM, THUNDERSTORM},
+    {230, THUNDERSTROM_LIGHT_RAIN, THUNDERSTROM_LIGHT_RAIN},
+    {231, THUNDERSTROM_LIGHT_RAIN, THUNDERSTROM_LIGHT_RAIN},
+    {232, THUNDERSTORM_HEAVY_RAIN, THUNDERSTORM_HEAVY_RAIN},
+
+    // Drizzle
+    {300, RAIN_LIGHT_DAY, RAIN_LIGHT_NIGHT},
+    {301, RAIN_LIGHT_DAY, RAIN_LIGHT_NIGHT},
+    {302, RAIN_HEAVY_DAY, RAIN_HEAVY_NIGHT},
+    {310, RAIN_DAY, RAIN_NIGHT},
+    {311, RAIN_DAY, RAIN_NIGHT},
+    {312, RAIN_DAY, RAIN_NIGHT},
+    {313, RAIN_DAY, RAIN_NIGHT},
+    {314, RAIN_HEAVY_DAY, RAIN_HEAVY_NIGHT},
+    {321, RAIN_DAY, RAIN_NIGHT},
+
+    // Rain
+    {500, RAIN_LIGHT_DAY, RAIN_LIGHT_NIGHT},
+    {501, RAIN_DAY, RAIN_NIGHT},
+    {502, RAIN_HEAVY_DAY, RAIN_HEAVY_NIGHT},
+    {503, RAIN_HEAVY_DAY, RAIN_HEAVY_NIGHT},
+    {504, RAIN_HEAVY_DAY, RAIN_HEAVY_NIGHT},
+    {511, RAIN_FREEZING_DAY, RAIN_FREEZING_NIGHT},
+    {520, RAIN_DAY, RAIN_NIGHT},
+    {521, RAIN_DAY, RAIN_NIGHT},
+    {522, RAIN_HEAVY_DAY, RAIN_HEAVY_NIGHT},
+    {531, RAIN_DAY, RAIN_NIGHT},
+
+    // Snow
+    {600, SNOW, SNOW},
+    {601, SNOW, SNOW},
+    {602, SNOW_HEAVY, SNOW_HEAVY},
+    {611, SNOW_SHOWER, SNOW_SHOWER},
+    {612, SNOW_SHOWER, SNOW_SHOWER},
+    {613, SNOW_HEAVY_SHOWER, SNOW_HEAVY_SHOWER},
+    {615, SNOW_RAIN, SNOW_RAIN},
+    {616, SNOW_HEAVY_RAIN, SNOW_HEAVY_RAIN},
+    {620, SNOW_SHOWER, SNOW_SHOWER},
+    {621, SNOW_HEAVY_SHOWER, SNOW_HEAVY_SHOWER},
+    {622, SNOW_HEAVY_SHOWER, SNOW_HEAVY_SHOWER},
+
+    // Atmosphere
+    {701, MIST, MIST},
+    {711, MIST, MIST},
+    {721, MIST, MIST},
+    {731, MIST, MIST},
+    {741, MIST, MIST},
+    {751, MIST, MIST},
+    {761, MIST, MIST},
+    {762, MIST, MIST},
+    {771, MIST, MIST},
+    {781, MIST, MIST},
+
+    // Clear
+    {800, CLEAR_DAY, CLEAR_NIGHT},
+
+    // Clouds
+    {801, CLOUDS_LIGHT_DAY, CLOUDS_LIGHT_NIGHT},
+    {802, CLOUDS_MEDIUM_DAY, CLOUDS_MEDIUM_NIGHT},
+    {803, CLOUDS_MEDIUM_DAY, CLOUDS_MEDIUM_NIGHT},
+    {804, CLOUDS_HEAVY, CLOUDS_HEAVY}
+  };
+
+  // Ordered from the worst to the mildest weather
+  constexpr uint16_t codeWorstness[] = {
+    202, 212, 232, 201, 200, 231, 230, 221, 211, 210,
+    314, 302, 312, 313, 311, 321, 310, 301, 300,
+    504, 503, 511, 502, 522, 501, 531, 521, 520, 500,
+    622, 616, 621, 620, 615, 613, 612, 602, 611, 601, 600,
+    701, 711, 721, 731, 741, 751, 761, 762, 771, 781,
+    804, 803, 802, 801, 800
+  };
+
+  static_assert(sizeof(codeWorstness) / sizeof(codeWorstness[0]) < WEATHER_RANK_UNKNOWN, "Rank doesn't fit its bit field");
+  static_assert(WEATHER_TYPE_COUNT < (1 << WEATHER_CODE_TYPE_BITS), "Weather type doesn't fit its bit field");
+  static_assert(WEATHER_ICON_COUNT <= (1 << WEATHER_CODE_ICON_BITS), "Icon doesn't fit its bit field");
+  static_assert(WEATHER_AUX_ICON_COUNT <= (1 << (WEATHER_CODE_SIDE_BITS - WEATHER_CODE_TYPE_BITS - WEATHER_CODE_ICON_BITS)), "Aux icon doesn't fit its bit field");
+
+  constexpr uint8_t Rank(unsigned int code)
+  {
+    for(uint8_t index = 0; index < sizeof(codeWorstness) / sizeof(codeWorstness[0]); ++index)
+    {
+      if(codeWorstness[index] == code)
+      {
+        return index;
+      }
+    }
+
+    return WEATHER_RANK_UNKNOWN;
+  }
+
+  constexpr EWeatherType Type(unsigned int code, bool isDay)
+  {
+    for(const SCodeType& codeType : codeTypes)
+    {
+      if(codeType.m_code == code)
+      {
+        return isDay ? codeType.m_day : codeType.m_night;
+      }
+    }
+
+    return UNKNOWN;
+  }
+
+  constexpr EWeatherIcon MainIcon(EWeatherType type)
+  {
+    switch(type)
+    {
+    case THUNDERSTROM_LIGHT_RAIN: return ICON_THUNDER_LIGHT_RAIN;
+    case THUNDERSTORM_RAIN:       return ICON_THUNDER_RAIN;
+    case THUNDERSTORM:            return ICON_THUNDER_RAIN;
+    case THUNDERSTORM_HEAVY:      return ICON_THUNDER_RAIN;
+    case THUNDERSTORM_HEAVY_RAIN: return ICON_THUNDER_RAIN;
+
+    case RAIN_LIGHT:              return ICON_LIGHT_RAIN;
+    case RAIN_LIGHT_DAY:          return ICON_LIGHT_RAIN_DAY;
+    case RAIN_LIGHT_NIGHT:        return ICON_LIGHT_RAIN_NIGHT;
+    case RAIN:                    return ICON_RAIN;
+    case RAIN_DAY:                return ICON_RAIN_DAY;
+    case RAIN_NIGHT:              return ICON_RAIN_NIGHT;
+    case RAIN_HEAVY:              return ICON_RAIN;
+    case RAIN_HEAVY_DAY:          return ICON_RAIN_DAY;
+    case RAIN_HEAVY_NIGHT:        return ICON_RAIN_NIGHT;
+    case RAIN_FREEZING:           return ICON_RAIN;
+    case RAIN_FREEZING_DAY:       return ICON_RAIN_DAY;
+    case RAIN_FREEZING_NIGHT:     return ICON_RAIN_NIGHT;
+
+    case SNOW:                    return ICON_SNOW;
+    case SNOW_HEAVY:              return ICON_SNOW;
+    case SNOW_SHOWER:             return ICON_SNOW_SHOWER;
+    case SNOW_HEAVY_SHOWER:       return ICON_SNOW_HEAVY_SHOWER;
+    case SNOW_RAIN:               return ICON_SNOW_RAIN;
+    case SNOW_HEAVY_RAIN:         return ICON_SNOW_HEAVY_RAIN;
+
+    case MIST:                    return ICON_MIST;
+
+    case CLEAR_DAY:               return ICON_SUN;
+    case CLEAR_NIGHT:             return ICON_NIGHT;
+
+    case CLOUDS_LIGHT_DAY:        return ICON_SMALL_CLOUDS_DAY;
+    case CLOUDS_LIGHT_NIGHT:      return ICON_SMALL_CLOUDS_NIGHT;
+    case CLOUDS_MEDIUM_DAY:       return ICON_MEDIUM_CLOUDS_DAY;
+    case CLOUDS_MEDIUM_NIGHT:     return ICON_MEDIUM_CLOUDS_NIGHT;
+    case CLOUDS_HEAVY:            return ICON_CLOUDS;
+
+    default:                      return ICON_NONE;
+    }
+  }
+
+  constexpr EWeatherAuxIcon AuxIcon(EWeatherType type)
+  {
+    switch(type)
+    {
+    case THUNDERSTORM_HEAVY:      return AUX_ICON_THUNDER;
+
+    case THUNDERSTORM_HEAVY_RAIN:
+    case RAIN_HEAVY:
+    case RAIN_HEAVY_DAY:
+    case RAIN_HEAVY_NIGHT:        return AUX_ICON_MORE_RAIN;
+
+    case RAIN_FREEZING:
+    case RAIN_FREEZING_DAY:
+    case RAIN_FREEZING_NIGHT:
+    case SNOW_HEAVY:              return AUX_ICON_SNOW;
+
+    default:                      return AUX_ICON_NONE;
+    }
+  }
+
+  constexpr uint32_t PackSide(EWeatherType type)
+  {
+    return static_cast<uint32_t>(type + 1)
+         | static_cast<uint32_t>(MainIcon(type)) << WEATHER_CODE_TYPE_BITS
+         | static_cast<uint32_t>(AuxIcon(type)) << (WEATHER_CODE_TYPE_BITS + WEATHER_CODE_ICON_BITS);
+  }
+
+  constexpr uint32_t Pack(unsigned int code)
+  {
+    return Rank(code)
+         | PackSide(Type(code, true)) << WEATHER_CODE_RANK_BITS
+         | PackSide(Type(code, false)) << (WEATHER_CODE_RANK_BITS + WEATHER_CODE_SIDE_BITS);
+  }
+
+  // Every ranked code has a type and every typed code has a rank and an icon
+  constexpr bool IsConsistent()
+  {
+    for(unsigned int code = WEATHER_CODE_FIRST; code <= WEATHER_CODE_LAST; ++code)
+    {
+      const bool ranked = Rank(code) != WEATHER_RANK_UNKNOWN;
+      if(ranked != (Type(code, true) != UNKNOWN) || ranked != (Type(code, false) != UNKNOWN))
+      {
+        return false;
+      }
+
+      if(ranked && (MainIcon(Type(code, true)) == ICON_NONE || MainIcon(Type(code, false)) == ICON_NONE))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  static_assert(IsConsistent(), "Weather code rank, type and icon tables disagree");
+
+  template<size_t Count>
+  struct SCodeTable
+  {
+    uint32_t m_entries[Count];
+  };
+
+  template<size_t... Index>
+  constexpr SCodeTable<sizeof...(Index)> MakeCodeTable(std::index_sequence<Index...>)
+  {
+    return {{ Pack(WEATHER_CODE_FIRST + Index)... }};
+  }
+}
+
+static const SCodeTable<WEATHER_CODE_COUNT> weatherCodeTable PROGMEM = MakeCodeTable(std::make_index_sequence<WEATHER_CODE_COUNT>());
+
+static uint32_t ReadWeatherCode(unsigned int weatherId)
+{
+  const unsigned int index = weatherId - WEATHER_CODE_FIRST;
+  return index < WEATHER_CODE_COUNT ? pgm_read_dword(&weatherCodeTable.m_entries[index]) : WEATHER_RANK_UNKNOWN;
+}
+
+SWeatherCondition GetWeatherCondition(unsigned int weatherId, bool isDay)
+{
+  const uint32_t entry = ReadWeatherCode(weatherId);
+  const uint32_t side = (entry >> (WEATHER_CODE_RANK_BITS + WEATHER_CODE_SIDE_BITS * !isDay)) & WEATHER_CODE_SIDE_MASK;
+
+  SWeatherCondition condition;
+  condition.m_rank     = entry & WEATHER_CODE_RANK_MASK;
+  condition.m_type     = static_cast<EWeatherType>(static_cast<int>(side & WEATHER_CODE_TYPE_MASK) - 1);
+  condition.m_mainIcon = static_cast<EWeatherIcon>((side >> WEATHER_CODE_TYPE_BITS) & WEATHER_CODE_ICON_MASK);
+  condition.m_auxIcon  = static_cast<EWeatherAuxIcon>(side >> (WEATHER_CODE_TYPE_BITS + WEATHER_CODE_ICON_BITS));
+
+  return condition;
+}
+
+uint8_t GetWeatherRank(unsigned int weatherId)
+{
+  return ReadWeatherCode(weatherId) & WEATHER_CODE_RANK_MASK;
+}
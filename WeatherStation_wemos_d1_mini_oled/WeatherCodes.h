@@ -0,0 +1,111 @@
+#ifndef _WEATHERCODES_H
+#define _WEATHERCODES_H
+
+#include <Arduino.h>
+
+///////////////// DEFINES
+// OpenWeatherMap condition codes, https://openweathermap.org/weather-conditions
+#define WEATHER_CODE_FIRST 200
+#define WEATHER_CODE_LAST 804
+#define WEATHER_CODE_COUNT (WEATHER_CODE_LAST - WEATHER_CODE_FIRST + 1)
+
+#define WEATHER_RANK_UNKNOWN 0x3F
+
+///////////////// CODE
+enum EWeatherType
+{
+  UNKNOWN = -1,
+  
+  THUNDERSTROM_LIGHT_RAIN = 0,
+  THUNDERSTORM_RAIN,
+  THUNDERSTORM,
+  THUNDERSTORM_HEAVY,
+  THUNDERSTORM_HEAVY_RAIN,
+
+  RAIN_LIGHT,
+  RAIN_LIGHT_DAY,
+  RAIN_LIGHT_NIGHT,
+  RAIN,
+  RAIN_DAY,
+  RAIN_NIGHT,
+  RAIN_HEAVY,
+  RAIN_HEAVY_DAY,
+  RAIN_HEAVY_NIGHT,
+  RAIN_FREEZING,
+  RAIN_FREEZING_DAY,
+  RAIN_FREEZING_NIGHT,
+
+  SNOW,
+  SNOW_HEAVY,
+  SNOW_SHOWER,
+  SNOW_HEAVY_SHOWER,
+  SNOW_RAIN,
+  SNOW_HEAVY_RAIN,
+
+  MIST,
+
+  CLEAR_DAY,
+  CLEAR_NIGHT,
+
+  CLOUDS_LIGHT_DAY,
+  CLOUDS_LIGHT_NIGHT,
+  CLOUDS_MEDIUM_DAY,
+  CLOUDS_MEDIUM_NIGHT,
+  CLOUDS_HEAVY,
+
+  WEATHER_TYPE_COUNT
+};
+
+// Indexes into the 56x56 icon table of CWeatherDisplay
+enum EWeatherIcon : uint8_t
+{
+  ICON_NONE = 0,
+  ICON_THUNDER_LIGHT_RAIN,
+  ICON_THUNDER_RAIN,
+  ICON_LIGHT_RAIN,
+  ICON_LIGHT_RAIN_DAY,
+  ICON_LIGHT_RAIN_NIGHT,
+  ICON_RAIN,
+  ICON_RAIN_DAY,
+  ICON_RAIN_NIGHT,
+  ICON_SNOW,
+  ICON_SNOW_SHOWER,
+  ICON_SNOW_HEAVY_SHOWER,
+  ICON_SNOW_RAIN,
+  ICON_SNOW_HEAVY_RAIN,
+  ICON_MIST,
+  ICON_SUN,
+  ICON_NIGHT,
+  ICON_SMALL_CLOUDS_DAY,
+  ICON_SMALL_CLOUDS_NIGHT,
+  ICON_MEDIUM_CLOUDS_DAY,
+  ICON_MEDIUM_CLOUDS_NIGHT,
+  ICON_CLOUDS,
+
+  WEATHER_ICON_COUNT
+};
+
+// Indexes into the 25x25 icon table of CWeatherDisplay
+enum EWeatherAuxIcon : uint8_t
+{
+  AUX_ICON_NONE = 0,
+  AUX_ICON_THUNDER,
+  AUX_ICON_MORE_RAIN,
+  AUX_ICON_SNOW,
+
+  WEATHER_AUX_ICON_COUNT
+};
+
+struct SWeatherCondition
+{
+  uint8_t m_rank;          // 0 is the worst weather, WEATHER_RANK_UNKNOWN for unknown codes
+  EWeatherType m_type;
+  EWeatherIcon m_mainIcon;
+  EWeatherAuxIcon m_auxIcon;
+};
+
+// Everything known about a condition code comes from a single PROGMEM read
+// of a table generated at compile time, see WeatherCodes.cpp
+SWeatherCondition GetWeatherCondition(unsigned int weatherId, bool isDay);
+uint8_t GetWeatherRank(unsigned int weatherId);
+#endif
@@ -1,18 +1,180 @@
 #include "WeatherDisplay.h"
+#include "ForecastDigest.h"
 
-U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R1, /* reset=*/ U8X8_PIN_NONE);
+// Indexed by EWeatherIcon
+static const unsigned char* const mainWeatherIcons[] PROGMEM = {
+  nullptr,
+  thunder_light_rain_56x56_bits,
+  thunder_rain_56x56_bits,
+  light_rain_56x56_bits,
+  light_rain_day_56x56_bits,
+  light_rain_night_56x56_bits,
+  rain_56x56_bits,
+  rain_day_56x56_bits,
+  rain_night_56x56_bits,
+  snow_56x56_bits,
+  snow_shower_56x56_bits,
+  snow_heavy_shower_56x56_bits,
+  snow_rain_56x56_bits,
+  snow_heavy_rain_56x56_bits,
+  mist_56x56_bits,
+  sun_56x56_bits,
+  night_56x56_bits,
+  small_clouds_day_56x56_bits,
+  small_clouds_night_56x56_bits,
+  medium_clouds_day_56x56_bits,
+  medium_clouds_night_56x56_bits,
+  clouds_56x56_bits
+};
 
-CWeatherDisplay::CWeatherDisplay()
-  : m_weatherInfo()
+// Indexed by EWeatherAuxIcon
+static const unsigned char* const auxWeatherIcons[] PROGMEM = {
+  nullptr,
+  thunder_25x25_bits,
+  more_rain_25x25_bits,
+  snow_25x25_bits
+};
+
+// The same at half size, for the 32 column screen
+static const unsigned char* const smallMainWeatherIcons[] PROGMEM = {
+  nullptr,
+  thunder_light_rain_28x28_bits,
+  thunder_rain_28x28_bits,
+  light_rain_28x28_bits,
+  light_rain_day_28x28_bits,
+  light_rain_night_28x28_bits,
+  rain_28x28_bits,
+  rain_day_28x28_bits,
+  rain_night_28x28_bits,
+  snow_28x28_bits,
+  snow_shower_28x28_bits,
+  snow_heavy_shower_28x28_bits,
+  snow_rain_28x28_bits,
+  snow_heavy_rain_28x28_bits,
+  mist_28x28_bits,
+  sun_28x28_bits,
+  night_28x28_bits,
+  small_clouds_day_28x28_bits,
+  small_clouds_night_28x28_bits,
+  medium_clouds_day_28x28_bits,
+  medium_clouds_night_28x28_bits,
+  clouds_28x28_bits
+};
+
+static const unsigned char* const smallAuxWeatherIcons[] PROGMEM = {
+  nullptr,
+  thunder_13x13_bits,
+  more_rain_13x13_bits,
+  snow_13x13_bits
+};
+
+// Pixel shift positions as panel (row, column) offsets, a loop around the
+// original position
+static const int8_t pixelShiftSteps[][2] = {
+  { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }, { 0, -1 }, { 1, -1 }
+};
+
+#define PIXEL_SHIFT_STEP_COUNT (sizeof(pixelShiftSteps) / sizeof(pixelShiftSteps[0]))
+
+static bool BoxesOverlap(const SDisplayBox& first, const SDisplayBox& second)
+{
+  return first.m_x < second.m_x + second.m_w && second.m_x < first.m_x + first.m_w
+    && first.m_y < second.m_y + second.m_h && second.m_y < first.m_y + first.m_h;
+}
+
+// Bits of the 16 panel rows from firstRow that lie in [first, end)
+static uint16_t RowRangeMask(int16_t firstRow, int16_t first, int16_t end)
+{
+  uint16_t mask = 0;
+  for(uint8_t bit = 0; bit < 16; ++bit)
+  {
+    if(firstRow + bit >= first && firstRow + bit < end)
+    {
+      mask |= 1 << bit;
+    }
+  }
+  return mask;
+}
+
+static uint8_t ReverseBits(uint8_t value)
+{
+  static const uint8_t reversedNibbles[16] = { 0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF };
+  return reversedNibbles[value & 0x0F] << 4 | reversedNibbles[value >> 4];
+}
+
+#ifndef GLYPH_ATLAS_GENERATED
+// Indexed by EGlyphFont, only linked while tools/generate_assets.py had no U8g2
+// to fill the glyph atlas from
+static const uint8_t* const glyphFonts[] PROGMEM = {
+  u8g2_font_fub30_tn,
+  u8g2_font_fub14_tn,
+  u8g2_font_helvR12_tf
+};
+
+static_assert(sizeof(glyphFonts) / sizeof(glyphFonts[0]) == GLYPH_FONT_COUNT, "Every EGlyphFont needs a font");
+#endif
+
+static_assert(sizeof(mainWeatherIcons) / sizeof(mainWeatherIcons[0]) == WEATHER_ICON_COUNT, "Every EWeatherIcon needs a bitmap");
+static_assert(sizeof(auxWeatherIcons) / sizeof(auxWeatherIcons[0]) == WEATHER_AUX_ICON_COUNT, "Every EWeatherAuxIcon needs a bitmap");
+static_assert(sizeof(smallMainWeatherIcons) / sizeof(smallMainWeatherIcons[0]) == WEATHER_ICON_COUNT, "Every EWeatherIcon needs a small bitmap");
+static_assert(sizeof(smallAuxWeatherIcons) / sizeof(smallAuxWeatherIcons[0]) == WEATHER_AUX_ICON_COUNT, "Every EWeatherAuxIcon needs a small bitmap");
+
+template<typename TPanel>
+CPanelWeatherDisplay<TPanel>::CPanelWeatherDisplay()
+  : m_u8g2()
+  , m_weatherInfo()
+  , m_weatherInfoSlot(0)
+  , m_timeline()
+  , m_timelineIndex(FORECAST_TIMELINE_INDEX_UNKNOWN)
+  , m_localTime(0)
   , m_doNotDisturb(false)
   , m_isDay(true)
   , m_errorMark(false)
   , m_celsiusSign(false)
   , m_noWifiConnectionMark(false)
-  , m_currentAnimationFrame(0)
-  , m_needDisplayUpdate(false)
+  , m_staleMark(false)
+  , m_dirtyLayers(0)
+  , m_pendingInvalidations(0)
+  , m_frameInterval(1000 / WEATHER_DISPLAY_MAX_FRAME_RATE)
+  , m_lastFrameTime(0)
+  , m_framesRendered(0)
+  , m_framesCoalesced(0)
+  , m_framesDropped(0)
+  , m_pageIntervals()
+  , m_currentPage(PAGE_WEATHER)
+  , m_pageShownTime(0)
+  , m_pageDrawTime(0)
+  , m_pageDirty(false)
+  , m_pageFlips(0)
+  , m_deviceStatusCb(nullptr)
+  , m_weatherFrameValid(false)
+  , m_weatherFrame()
   , m_oledProtectionEnabled(false)
   , m_oledRefreshInProgress(false)
+  , m_displayRotated(false)
+  , m_clip(SLayout::FULL_SCREEN)
+  , m_sentFrame()
+  , m_sentFrameValid(false)
+  , m_bytesSent(0)
+  , m_tilesSkipped(0)
+  , m_lastRenderUs(0)
+  , m_maxRenderUs(0)
+  , m_lastIconDrawUs(0)
+  , m_lastSendUs(0)
+  , m_pendingPages(0)
+  , m_transferUs(0)
+  , m_lastPageSendUs(0)
+  , m_maxPageSendUs(0)
+  , m_panelPowerSave(false)
+  , m_contrast(WEATHER_DISPLAY_CONTRAST_DAY)
+  , m_powerSaveSwitches(0)
+  , m_pixelShiftStep(0)
+  , m_panelColumnShift(0)
+  , m_panelRowShift(0)
+  , m_rowShiftsSkipped(0)
+  , m_currentAnimationFrame(0)
+  , m_animationRunning(false)
+  , m_animationFrameTime(0)
   {
     m_oledStartRefreshTimer.setInterval(WEATHER_DISPLAY_OLED_START_REFRESH);
 
@@ -20,67 +182,144 @@ CWeatherDisplay::CWeatherDisplay()
     m_oledEndRefreshTimer.setRepeats(1);
   }
 
-void CWeatherDisplay::Begin()
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::Begin()
+{
+  m_u8g2.begin();
+  m_sentFrameValid = false;
+  m_pixelShiftStep = 0;
+  m_panelColumnShift = 0;
+  m_panelRowShift = 0;
+  m_panelPowerSave = false;
+  m_contrast = WEATHER_DISPLAY_CONTRAST_DAY;
+  m_u8g2.setContrast(m_contrast);
+  m_u8g2.clearBuffer();
+  SendBuffer();
+}
+
+template<typename TPanel>
+SWeatherInfo& CPanelWeatherDisplay<TPanel>::AcquireWeatherInfo()
 {
-  u8g2.begin();
-  u8g2.setContrast(255);
-  u8g2.clearBuffer();
-  u8g2.sendBuffer();
+  SWeatherInfo& weatherInfo = m_weatherInfo[m_weatherInfoSlot ^ 1];
+  weatherInfo = SWeatherInfo();
+  return weatherInfo;
 }
 
-void CWeatherDisplay::SetWeatherInfo(const SWeatherInfo& weatherInfo)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::PublishWeatherInfo()
 {
-  m_weatherInfo = weatherInfo;
-  m_needDisplayUpdate = true;
+  m_weatherInfoSlot ^= 1;
+  InvalidateLayers(DISPLAY_LAYERS_FORECAST);
+  m_pageDirty = true;
 }
 
-void CWeatherDisplay::SetDoNotDisturb(bool doNotDisturb)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::PublishTimeline()
+{
+  m_timelineIndex = GetTimelineIndex(m_timeline, m_localTime);
+  DigestCurrentHour();
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetLocalTime(unsigned long localTime)
+{
+  if(localTime == m_localTime)
+  {
+    return;
+  }
+  m_localTime = localTime;
+
+  const uint8_t timelineIndex = GetTimelineIndex(m_timeline, m_localTime);
+  if(timelineIndex != m_timelineIndex)
+  {
+    DEBUG_LOG(F("[WeatherDisplay] Hour rollover to timeline entry: "));
+    DEBUG_LOG_LN(timelineIndex);
+
+    m_timelineIndex = timelineIndex;
+    DigestCurrentHour();
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DigestCurrentHour()
+{
+  if(m_timelineIndex == FORECAST_TIMELINE_INDEX_UNKNOWN)
+  {
+    return;
+  }
+
+  const unsigned long digestStart = micros();
+
+  DigestTimeline(m_timeline, m_timelineIndex, AcquireWeatherInfo());
+  PublishWeatherInfo();
+
+  DEBUG_LOG(F("[WeatherDisplay] Timeline digest took us: "));
+  DEBUG_LOG_LN(micros() - digestStart);
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetDoNotDisturb(bool doNotDisturb)
 {
   if(m_doNotDisturb != doNotDisturb)
   {
     m_doNotDisturb = doNotDisturb;
-
-    if(m_doNotDisturb)
-    {
-      u8g2.clearBuffer();
-      u8g2.sendBuffer();
-      
-      m_needDisplayUpdate = false;
-    }
-    else
-    {
-      m_needDisplayUpdate = true;
-    }
+    UpdatePanelPower();
   }
 }
 
-void CWeatherDisplay::SetIsDay(bool isDay)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetIsDay(bool isDay)
 {
   if(m_isDay != isDay)
   {
     m_isDay = isDay;
-    m_needDisplayUpdate = true;
+    InvalidateLayers(1 << LAYER_ICON);
+    UpdatePanelPower();
   }
 }
 
-void CWeatherDisplay::SetErrorMark(bool error)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetErrorMark(bool error)
 {
-  m_errorMark = error;
-  m_needDisplayUpdate = true;
+  if(m_errorMark != error)
+  {
+    m_errorMark = error;
+    InvalidateLayers(1 << LAYER_STATUS);
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetNoWifiConnectionMark(bool noWifi)
+{
+  if(m_noWifiConnectionMark != noWifi)
+  {
+    m_noWifiConnectionMark = noWifi;
+    InvalidateLayers(1 << LAYER_STATUS);
+  }
 }
 
-void CWeatherDisplay::SetNoWifiConnectionMark(bool noWifi)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetStaleMark(bool stale)
 {
-  m_noWifiConnectionMark = noWifi;
-  m_needDisplayUpdate = true;  
+  if(m_staleMark != stale)
+  {
+    m_staleMark = stale;
+    InvalidateLayers(1 << LAYER_STATUS);
+  }
 }
 
-void CWeatherDisplay::SetCelsiusSign(bool celsiusSign)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetCelsiusSign(bool celsiusSign)
 {
-  m_celsiusSign = celsiusSign;
+  if(m_celsiusSign != celsiusSign)
+  {
+    m_celsiusSign = celsiusSign;
+    InvalidateLayers(1 << LAYER_CURRENT_TEMP);
+  }
 }
 
-void CWeatherDisplay::EnableOLEDProtection(bool enable, unsigned int updateTime/* = WEATHER_DISPLAY_OLED_START_REFRESH*/, unsigned int timeOff/* = WEATHER_DISPLAY_OLED_END_REFRESH*/)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::EnableOLEDProtection(bool enable, unsigned int updateTime/* = WEATHER_DISPLAY_OLED_START_REFRESH*/, unsigned int timeOff/* = WEATHER_DISPLAY_OLED_END_REFRESH*/)
 {
   m_oledProtectionEnabled = enable;
   m_oledStartRefreshTimer.setInterval(updateTime);
@@ -92,10 +331,33 @@ void CWeatherDisplay::EnableOLEDProtection(bool enable, unsigned int updateTime/
   else
   {
     m_oledStartRefreshTimer.stop();
+
+    if(m_pixelShiftStep)
+    {
+      m_pixelShiftStep = 0;
+      ApplyPanelColumnShift(0);
+      ApplyPanelRowShift();
+    }
   }
 }
 
-void CWeatherDisplay::UpdateDisplay()
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetMaxFrameRate(uint8_t framesPerSecond)
+{
+  m_frameInterval = 1000 / (framesPerSecond ? framesPerSecond : 1);
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetPageInterval(EDisplayPage page, uint16_t seconds)
+{
+  if(page < DISPLAY_PAGE_COUNT)
+  {
+    m_pageIntervals[page] = seconds;
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::UpdateDisplay()
 {
   if(m_doNotDisturb)
   {
@@ -107,502 +369,1002 @@ void CWeatherDisplay::UpdateDisplay()
     InternalOledRefresh();
   }
 
+  UpdateCarousel();
   InternalUpdateWeatherDisplay();
+  SendPages(WEATHER_DISPLAY_PAGES_PER_UPDATE);
 }
 
-void CWeatherDisplay::ResetAnimationFrames()
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::ResetAnimationFrames()
 {
   m_currentAnimationFrame = 0;
+  m_animationRunning = false;
 }
 
-void CWeatherDisplay::UpdateWiFiAnimation(const char* ssidName)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::UpdateWiFiAnimation(const char* ssidName)
 {
+  const unsigned long now = millis();
+  const unsigned long elapsed = now - m_animationFrameTime;
+  if(m_animationRunning)
+  {
+    if(elapsed < WEATHER_DISPLAY_WIFI_ANIMATION_INTERVAL)
+    {
+      return;
+    }
+
+    // Called too late to show every frame in time
+    m_framesDropped += elapsed / WEATHER_DISPLAY_WIFI_ANIMATION_INTERVAL - 1;
+  }
+  m_animationRunning = true;
+  m_animationFrameTime = now;
+
   const unsigned short offsetY = 20;
-  u8g2.clearBuffer();
-  u8g2.setDrawColor(0);
-  u8g2.drawXBMP(0, offsetY, WIFI_ICON_W, WIFI_ICON_H, wifi_animation_64x64_bits[m_currentAnimationFrame]);
-  u8g2.setDrawColor(1);
-  u8g2.setFont(u8g2_font_5x7_tr);
-  u8g2.drawStr(0, offsetY + WIFI_ICON_H + 10, ssidName);
-  u8g2.sendBuffer();
+  InvalidateScreen();
+  m_u8g2.clearBuffer();
+  if(SLayout::WIFI_ICON)
+  {
+    DrawPageBitmap(0, offsetY, WIFI_ICON_W, WIFI_ICON_H, static_cast<const uint8_t*>(pgm_read_ptr(&wifi_animation_64x64_bits[m_currentAnimationFrame])));
+  }
+  m_u8g2.setDrawColor(1);
+  m_u8g2.setFont(SLayout::TEXT_FONT);
+  m_u8g2.drawStr(0, offsetY + WIFI_ICON_H + 10, ssidName);
+  SendBuffer();
 
-  m_currentAnimationFrame = m_currentAnimationFrame == 3 ? 0 : ++m_currentAnimationFrame;
+  m_currentAnimationFrame = (m_currentAnimationFrame + 1) % WIFI_FRAME_ANIMATION_COUNT;
 }
 
-void CWeatherDisplay::UpdateWiFiConnectedState(const char* ssidName, const String& ipAdress)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::UpdateWiFiConnectedState(const char* ssidName, const String& ipAdress)
 {
   const unsigned short offsetY = 20;
-  u8g2.clearBuffer();
-  u8g2.setDrawColor(0);
-  u8g2.drawXBMP(0, offsetY, WIFI_ICON_W, WIFI_ICON_H, wifi_conected_64x64_bits);
-  u8g2.setDrawColor(1);
-  u8g2.setFont(u8g2_font_5x7_tr);
-  u8g2.drawStr(0, offsetY + WIFI_ICON_H + 10, ssidName);
-  u8g2.drawStr(0, offsetY + WIFI_ICON_H + 20, ipAdress.c_str());
-  u8g2.sendBuffer();
+  InvalidateScreen();
+  m_u8g2.clearBuffer();
+  if(SLayout::WIFI_ICON)
+  {
+    DrawPageBitmap(0, offsetY, WIFI_ICON_W, WIFI_ICON_H, wifi_conected_64x64_bits);
+  }
+  m_u8g2.setDrawColor(1);
+  m_u8g2.setFont(SLayout::TEXT_FONT);
+  m_u8g2.drawStr(0, offsetY + WIFI_ICON_H + 10, ssidName);
+  m_u8g2.drawStr(0, offsetY + WIFI_ICON_H + 20, ipAdress.c_str());
+  SendBuffer();
 }
 
-void CWeatherDisplay::DisplayWiFiConfigurationHelpText(const char* ssidName)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DisplayWiFiConfigurationHelpText(const char* ssidName)
 {
   const unsigned short offsetY = 20;
-  u8g2.clearBuffer();
-  u8g2.setDrawColor(1);
-  u8g2.setFont(u8g2_font_5x7_tr);
-  u8g2.drawStr(0, offsetY + WIFI_ICON_H / 2, ssidName);
-  u8g2.sendBuffer();
+  InvalidateScreen();
+  m_u8g2.clearBuffer();
+  m_u8g2.setDrawColor(1);
+  m_u8g2.setFont(SLayout::TEXT_FONT);
+  m_u8g2.drawStr(0, offsetY + WIFI_ICON_H / 2, ssidName);
+  SendBuffer();
 }
 
-void CWeatherDisplay::SetDisplayRotation(bool rotate)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SetDisplayRotation(bool rotate)
 {
-  u8g2.clearDisplay();
-  u8g2.setDisplayRotation(rotate ? U8G2_R3 : U8G2_R1);
-  u8g2.sendBuffer();
+  m_displayRotated = rotate;
+  InvalidateScreen();
+  // The kept weather frame was drawn the other way round
+  m_weatherFrameValid = false;
+  m_currentPage = PAGE_WEATHER;
+  m_pageShownTime = millis();
+  m_u8g2.clearDisplay();
+  memset(m_sentFrame, 0, sizeof(m_sentFrame));
+  m_sentFrameValid = true;
+  m_u8g2.setDisplayRotation(rotate ? U8G2_R3 : U8G2_R1);
+  // clearDisplay() only covers the columns of the current shift
+  m_pixelShiftStep = 0;
+  ApplyPanelColumnShift(0);
+  SendBuffer();
 }
 
-void CWeatherDisplay::InternalUpdateWeatherDisplay()
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SendBuffer()
 {
-  if(m_needDisplayUpdate)
+  QueueBuffer();
+  SendPages(PAGE_COUNT);
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SendPages(uint8_t maxPages)
+{
+  bool sent = false;
+  for(uint8_t page = 0; page < PAGE_COUNT && maxPages; ++page)
   {
-    m_needDisplayUpdate = false;
-      
-    u8g2.clearBuffer();
-  
-    DrawWeatherIcon(GetWeatherType(m_weatherInfo.m_weatherId, m_isDay));
-    
-    const unsigned short yOffset = 110;
-    PrepareTemperatureForDisplay(m_weatherInfo.m_currentTemp, m_weatherInfo.m_eveningTemp, yOffset);
-  
-    DrawPoPBars();
-  
-    if(m_errorMark)
+    if(!(m_pendingPages & (1 << page)))
     {
-      u8g2.setFont(u8g2_font_open_iconic_embedded_1x_t);
-      u8g2.drawStr(0, 8, "\x47");   
+      continue;
     }
+    m_pendingPages &= ~(1 << page);
+    --maxPages;
+    sent = true;
+
+    const unsigned long sendStart = micros();
+    SendPage(page);
+    m_lastPageSendUs = micros() - sendStart;
+    m_maxPageSendUs = max(m_maxPageSendUs, m_lastPageSendUs);
+    m_transferUs += m_lastPageSendUs;
 
-    if(m_noWifiConnectionMark)
+    // New content may have reached a row the start line wraps around
+    ApplyPanelRowShift();
+  }
+
+  if(sent && !m_pendingPages)
+  {
+    m_sentFrameValid = true;
+    m_lastSendUs = m_transferUs;
+    m_transferUs = 0;
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::SendPage(uint8_t page)
+{
+  const uint8_t* buffer = m_u8g2.getBufferPtr();
+  const uint8_t tileCount = PAGE_SIZE / WEATHER_DISPLAY_TILE_SIZE;
+  const uint16_t pageOffset = page * PAGE_SIZE;
+
+  // Every run of changed tiles is its own transfer, addressing the next
+  // run costs less than sending one unchanged tile
+  for(uint8_t tile = 0; tile < tileCount; )
+  {
+    uint8_t runEnd = tile;
+    while(runEnd < tileCount)
     {
-      u8g2.setFont(u8g2_font_open_iconic_embedded_1x_t);
-      u8g2.drawStr(WEATHER_DISPLAY_W - 8 * 2 - 1, 8, "\x4F");
-      u8g2.drawStr(WEATHER_DISPLAY_W - 8, 8, "\x50");   
-    }    
-    
-    u8g2.sendBuffer();  
+      const uint16_t offset = pageOffset + runEnd * WEATHER_DISPLAY_TILE_SIZE;
+      if(m_sentFrameValid && memcmp(buffer + offset, m_sentFrame + offset, WEATHER_DISPLAY_TILE_SIZE) == 0)
+      {
+        break;
+      }
+      ++runEnd;
+    }
+
+    if(runEnd == tile)
+    {
+      ++m_tilesSkipped;
+      ++tile;
+      continue;
+    }
+
+    const uint16_t offset = pageOffset + tile * WEATHER_DISPLAY_TILE_SIZE;
+    const uint16_t size = (runEnd - tile) * WEATHER_DISPLAY_TILE_SIZE;
+
+    m_u8g2.updateDisplayArea(tile, page, runEnd - tile, 1);
+    memcpy(m_sentFrame + offset, buffer + offset, size);
+    m_bytesSent += size;
+
+    tile = runEnd;
   }
 }
 
-void CWeatherDisplay::InternalOledRefresh()
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::PrintScreenPbm(Print& out) const
+{
+  char header[16];
+  snprintf(header, sizeof(header), "P4\n%d %d\n", SLayout::SCREEN_W, SLayout::SCREEN_H);
+  out.print(header);
+
+  for(uint8_t y = 0; y < SLayout::SCREEN_H; ++y)
+  {
+    // PBM rows are packed most significant bit first, 1 is black
+    uint8_t row[SLayout::SCREEN_W / 8];
+    memset(row, 0xFF, sizeof(row));
+
+    for(uint8_t x = 0; x < SLayout::SCREEN_W; ++x)
+    {
+      if(IsSentPixelLit(x, y))
+      {
+        row[x >> 3] &= ~(0x80 >> (x & 7));
+      }
+    }
+
+    out.write(row, sizeof(row));
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::UpdateCarousel()
+{
+  const unsigned long now = millis();
+  const EDisplayPage nextPage = GetNextPage();
+  if(nextPage != m_currentPage)
+  {
+    const unsigned long interval = m_pageIntervals[m_currentPage] * 1000UL;
+    if(!interval || now - m_pageShownTime >= interval)
+    {
+      ShowPage(nextPage);
+      return;
+    }
+  }
+
+  if(m_currentPage == PAGE_WEATHER)
+  {
+    return;
+  }
+
+  if(m_currentPage == PAGE_DEVICE_STATUS && now - m_pageDrawTime >= WEATHER_DISPLAY_STATUS_PAGE_REFRESH)
+  {
+    m_pageDirty = true;
+  }
+
+  if(m_pageDirty)
+  {
+    DrawPage(m_currentPage);
+  }
+}
+
+template<typename TPanel>
+EDisplayPage CPanelWeatherDisplay<TPanel>::GetNextPage() const
+{
+  for(uint8_t step = 1; step <= DISPLAY_PAGE_COUNT; ++step)
+  {
+    const EDisplayPage page = static_cast<EDisplayPage>((m_currentPage + step) % DISPLAY_PAGE_COUNT);
+    if(m_pageIntervals[page])
+    {
+      return page;
+    }
+  }
+  return PAGE_WEATHER;
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::ShowPage(EDisplayPage page)
+{
+  uint8_t* buffer = m_u8g2.getBufferPtr();
+  if(m_currentPage == PAGE_WEATHER)
+  {
+    memcpy(m_weatherFrame, buffer, FRAME_SIZE);
+    m_weatherFrameValid = true;
+  }
+
+  DEBUG_LOG(F("[WeatherDisplay] Page: "));
+  DEBUG_LOG_LN(page);
+
+  m_currentPage = page;
+  m_pageShownTime = millis();
+  ++m_pageFlips;
+
+  if(page != PAGE_WEATHER)
+  {
+    DrawPage(page);
+    return;
+  }
+
+  if(m_weatherFrameValid)
+  {
+    memcpy(buffer, m_weatherFrame, FRAME_SIZE);
+    QueueBuffer();
+  }
+  else
+  {
+    InvalidateScreen();
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawPage(EDisplayPage page)
+{
+  const unsigned long renderStart = micros();
+  m_u8g2.clearBuffer();
+
+  switch(page)
+  {
+    case PAGE_TEMPERATURE_GRAPH:
+      DrawTemperatureGraph();
+      break;
+    case PAGE_POP_CHART:
+      DrawPoPChart();
+      break;
+    case PAGE_DEVICE_STATUS:
+      DrawDeviceStatus();
+      break;
+    default:
+      break;
+  }
+
+  m_lastRenderUs = micros() - renderStart;
+  m_maxRenderUs = max(m_maxRenderUs, m_lastRenderUs);
+
+  m_pageDirty = false;
+  m_pageDrawTime = millis();
+  QueueBuffer();
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::InternalUpdateWeatherDisplay()
+{
+  if(!m_dirtyLayers || m_oledRefreshInProgress || m_currentPage != PAGE_WEATHER)
+  {
+    return;
+  }
+
+  // Everything invalidated until the frame window is over goes into one frame
+  if(millis() - m_lastFrameTime < m_frameInterval)
+  {
+    return;
+  }
+
+  const unsigned long renderStart = micros();
+
+  if(m_dirtyLayers == DISPLAY_LAYERS_ALL)
+  {
+    m_u8g2.clearBuffer();
+
+    for(uint8_t layer = 0; layer < DISPLAY_LAYER_COUNT; ++layer)
+    {
+      DrawLayer(static_cast<EDisplayLayer>(layer));
+    }
+  }
+  else
+  {
+    for(uint8_t layer = 0; layer < DISPLAY_LAYER_COUNT; ++layer)
+    {
+      if(m_dirtyLayers & (1 << layer))
+      {
+        RedrawBox(SLayout::LAYER_BOXES[layer]);
+      }
+    }
+  }
+
+  m_lastRenderUs = micros() - renderStart;
+  m_maxRenderUs = max(m_maxRenderUs, m_lastRenderUs);
+
+  DEBUG_LOG(F("[WeatherDisplay] Render of layers "));
+  DEBUG_LOG(m_dirtyLayers);
+  DEBUG_LOG(F(" took us: "));
+  DEBUG_LOG_LN(m_lastRenderUs);
+
+  m_dirtyLayers = 0;
+
+  // Sent a page at a time by the next UpdateDisplay() calls
+  QueueBuffer();
+
+  ++m_framesRendered;
+  if(m_pendingInvalidations > 1)
+  {
+    m_framesCoalesced += m_pendingInvalidations - 1;
+  }
+  m_pendingInvalidations = 0;
+
+  // The window starts after the render, so the rest of loop() always gets
+  // a full frame interval between two frames
+  m_lastFrameTime = millis();
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::RedrawBox(const SDisplayBox& box)
+{
+  m_clip = box;
+  m_u8g2.setClipWindow(box.m_x, box.m_y, box.m_x + box.m_w, box.m_y + box.m_h);
+
+  m_u8g2.setDrawColor(0);
+  m_u8g2.drawBox(box.m_x, box.m_y, box.m_w, box.m_h);
+  m_u8g2.setDrawColor(1);
+
+  for(uint8_t layer = 0; layer < DISPLAY_LAYER_COUNT; ++layer)
+  {
+    if(BoxesOverlap(SLayout::LAYER_BOXES[layer], box))
+    {
+      DrawLayer(static_cast<EDisplayLayer>(layer));
+    }
+  }
+
+  m_u8g2.setMaxClipWindow();
+  m_clip = SLayout::FULL_SCREEN;
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawLayer(EDisplayLayer layer)
+{
+  const SWeatherInfo& weatherInfo = GetWeatherInfo();
+
+  switch(layer)
+  {
+    case LAYER_ICON:
+    {
+      const SWeatherCondition condition = GetWeatherCondition(weatherInfo.m_weatherId, m_isDay);
+      const unsigned long iconStart = micros();
+      DrawWeatherIcon(condition.m_mainIcon, condition.m_auxIcon);
+      m_lastIconDrawUs = micros() - iconStart;
+      break;
+    }
+    case LAYER_POP:
+      DrawPoPBars();
+      break;
+    case LAYER_CURRENT_TEMP:
+      DrawCurrentTemperature(weatherInfo.m_currentTemp);
+      break;
+    case LAYER_EVENING_TEMP:
+      DrawEveningTemperature(weatherInfo.m_eveningTemp);
+      break;
+    case LAYER_STATUS:
+      DrawStatusMarks();
+      break;
+    default:
+      break;
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawStatusMarks()
+{
+  if(m_errorMark)
+  {
+    m_u8g2.setFont(u8g2_font_open_iconic_embedded_1x_t);
+    m_u8g2.drawStr(0, 8, "\x47");   
+  }
+
+  if(m_noWifiConnectionMark)
+  {
+    m_u8g2.setFont(u8g2_font_open_iconic_embedded_1x_t);
+    m_u8g2.drawStr(SLayout::SCREEN_W - 8 * 2 - 1, 8, "\x4F");
+    m_u8g2.drawStr(SLayout::SCREEN_W - 8, 8, "\x50");   
+  }    
+
+  if(m_staleMark)
+  {
+    // Small clock: shown forecast is from the cache, fresh one not received yet
+    m_u8g2.drawCircle(3, 13, 3);
+    m_u8g2.drawVLine(3, 11, 3);
+    m_u8g2.drawHLine(3, 13, 3);
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::InternalOledRefresh()
 {
       if(m_oledStartRefreshTimer.expired())
       {
+#ifdef WEATHER_DISPLAY_OLED_PIXEL_SHIFT
+        ShiftPixels();
+#else
         OledStartRefresh();
+#endif
       }
 
       if(m_oledEndRefreshTimer.expired())
       {
         OledEndRefresh();
       }
-
-      if(m_oledRefreshInProgress)
-      {
-        m_needDisplayUpdate = false;
-      }
 }
 
-void CWeatherDisplay::OledStartRefresh()
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::OledStartRefresh()
 {
   m_oledRefreshInProgress = true;
   m_oledEndRefreshTimer.start();
-
-  u8g2.clearBuffer();
-  u8g2.sendBuffer();
+  UpdatePanelPower();
 }
 
-void CWeatherDisplay::OledEndRefresh()
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::OledEndRefresh()
 {
   m_oledRefreshInProgress = false;
   m_oledEndRefreshTimer.stop();
-  m_needDisplayUpdate = true;
+  UpdatePanelPower();
 }
 
-void CWeatherDisplay::DrawWeatherIcon(EWeatherType weatherType)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::ShiftPixels()
 {
-  const unsigned char* mainWeatherIcon = nullptr;
-  const unsigned char* auxWeatherIcon = nullptr;
-  
-  switch(weatherType)
-  {
-  case THUNDERSTROM_LIGHT_RAIN:
-  mainWeatherIcon = thunder_light_rain_56x56_bits;
-  break;
-  
-  case THUNDERSTORM_RAIN:
-  mainWeatherIcon = thunder_rain_56x56_bits;
-  break;
-  
-  case THUNDERSTORM:
-  mainWeatherIcon = thunder_rain_56x56_bits;
-  break;
-  
-  case THUNDERSTORM_HEAVY:
-  mainWeatherIcon = thunder_rain_56x56_bits;
-  auxWeatherIcon = thunder_25x25_bits;
-  break;
-  
-  case THUNDERSTORM_HEAVY_RAIN:
-  mainWeatherIcon = thunder_rain_56x56_bits;
-  auxWeatherIcon = more_rain_25x25_bits;
-  break;
+  m_pixelShiftStep = (m_pixelShiftStep + 1) % PIXEL_SHIFT_STEP_COUNT;
 
+  DEBUG_LOG(F("[WeatherDisplay] Pixel shift step: "));
+  DEBUG_LOG_LN(m_pixelShiftStep);
 
-  case RAIN_LIGHT:
-  mainWeatherIcon = light_rain_56x56_bits;
-  break;
-  
-  case RAIN_LIGHT_DAY:
-  mainWeatherIcon = light_rain_day_56x56_bits;
-  break;
-  
-  case RAIN_LIGHT_NIGHT:
-  mainWeatherIcon = light_rain_night_56x56_bits;
-  break;
-  
-  case RAIN:
-  mainWeatherIcon = rain_56x56_bits;
-  break;
-  
-  case RAIN_DAY:
-  mainWeatherIcon = rain_day_56x56_bits;
-  break;
-    
-  case RAIN_NIGHT:
-  mainWeatherIcon = rain_night_56x56_bits;
-  break;
-    
-  case RAIN_HEAVY:
-  mainWeatherIcon = rain_56x56_bits;
-  auxWeatherIcon = more_rain_25x25_bits;
-  break;
-    
-  case RAIN_HEAVY_DAY:
-  mainWeatherIcon = rain_day_56x56_bits;
-  auxWeatherIcon = more_rain_25x25_bits;
-  break;
-    
-  case RAIN_HEAVY_NIGHT:
-  mainWeatherIcon = rain_night_56x56_bits;
-  auxWeatherIcon = more_rain_25x25_bits;
-  break;
-    
-  case RAIN_FREEZING:
-  mainWeatherIcon = rain_56x56_bits;
-  auxWeatherIcon = snow_25x25_bits;
-  break;
-  
-  case RAIN_FREEZING_DAY:
-  mainWeatherIcon = rain_day_56x56_bits;
-  auxWeatherIcon = snow_25x25_bits;
-  break;
-    
-  case RAIN_FREEZING_NIGHT:
-  mainWeatherIcon = rain_night_56x56_bits;
-  auxWeatherIcon = snow_25x25_bits;
-  break;
-    
-
-  case SNOW:
-  mainWeatherIcon = snow_56x56_bits;
-  break;
-  
-  case SNOW_HEAVY:
-  mainWeatherIcon = snow_56x56_bits;
-  auxWeatherIcon = snow_25x25_bits;
-  break;
-    
-  case SNOW_SHOWER:
-  mainWeatherIcon = snow_shower_56x56_bits;
-  break;
-  
-  case SNOW_HEAVY_SHOWER:
-  mainWeatherIcon = snow_heavy_shower_56x56_bits;
-  break;
-  
-  case SNOW_RAIN:
-  mainWeatherIcon = snow_rain_56x56_bits;
-  break;
-  
-  case SNOW_HEAVY_RAIN:
-  mainWeatherIcon = snow_heavy_rain_56x56_bits;
-  break;  
-  
+  // Without spare RAM columns the picture only moves by rows
+  const bool columnShift = TPanel::RAM_COLUMNS > TPanel::WIDTH;
+  ApplyPanelColumnShift(columnShift ? pixelShiftSteps[m_pixelShiftStep][1] : 0);
+  ApplyPanelRowShift();
 
-  case MIST:
-  mainWeatherIcon = mist_56x56_bits;
-  break;  
+  if(pixelShiftSteps[m_pixelShiftStep][0] != 0 && m_panelRowShift == 0)
+  {
+    ++m_rowShiftsSkipped;
+  }
+}
 
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::ApplyPanelColumnShift(int8_t shift)
+{
+  if(shift == m_panelColumnShift)
+  {
+    return;
+  }
+  m_panelColumnShift = shift;
 
-  case CLEAR_DAY:
-  mainWeatherIcon = sun_56x56_bits;
-  break;  
-  
-  case CLEAR_NIGHT:
-  mainWeatherIcon = night_56x56_bits;
-  break;    
+  // The SH1106 has 132 RAM columns and shows 128 of them from the default
+  // offset, with as many spare columns on either side. Blank the tiles at
+  // both ends of the RAM first, the columns a shifted frame leaves uncovered
+  // would otherwise show old pixels.
+  u8x8_t* u8x8 = m_u8g2.getU8x8();
+  const uint8_t defaultOffset = u8x8->display_info->default_x_offset;
+  const uint8_t lastTile = PAGE_SIZE / WEATHER_DISPLAY_TILE_SIZE - 1;
+  uint8_t blankTile[WEATHER_DISPLAY_TILE_SIZE] = {};
 
+  for(uint8_t page = 0; page < PAGE_COUNT; ++page)
+  {
+    u8x8->x_offset = 0;
+    u8x8_DrawTile(u8x8, 0, page, 1, blankTile);
+    u8x8->x_offset = 2 * defaultOffset;
+    u8x8_DrawTile(u8x8, lastTile, page, 1, blankTile);
+  }
 
-  case CLOUDS_LIGHT_DAY:
-  mainWeatherIcon = small_clouds_day_56x56_bits;
-  break;
-  
-  case CLOUDS_LIGHT_NIGHT:
-  mainWeatherIcon = small_clouds_night_56x56_bits;
-  break;
-  
-  case CLOUDS_MEDIUM_DAY:
-  mainWeatherIcon = medium_clouds_day_56x56_bits;
-  break;
-  
-  case CLOUDS_MEDIUM_NIGHT:
-  mainWeatherIcon = medium_clouds_night_56x56_bits;
-  break;
-  
-  case CLOUDS_HEAVY:
-  mainWeatherIcon = clouds_56x56_bits;
-  break;
+  u8x8->x_offset = defaultOffset + shift;
 
-  case UNKNOWN:
-  // DEBUG OUTPUT
-  break;
+  m_sentFrameValid = false;
+  SendBuffer();
+}
 
-  default:
-  // DEBUG OUTPUT
-  break;
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::ApplyPanelRowShift()
+{
+  // With content at one edge only, the step's direction alone would skip
+  // every step toward that edge
+  const uint8_t panelRows = PAGE_COUNT * 8;
+  int8_t shift = pixelShiftSteps[m_pixelShiftStep][0];
+  if(!IsRowShiftPossible(shift))
+  {
+    shift = IsRowShiftPossible(-shift) ? -shift : 0;
   }
 
-  if(mainWeatherIcon || auxWeatherIcon)
+  if(shift == m_panelRowShift)
   {
-    u8g2.setDrawColor(0);
-    
-    if(mainWeatherIcon)
-    {
-      u8g2.drawXBMP( 4, 0, WEATHER_ICON_W, WEATHER_ICON_H, mainWeatherIcon);
-    }
-    else
+    return;
+  }
+  m_panelRowShift = shift;
+
+  u8x8_t* u8x8 = m_u8g2.getU8x8();
+  u8x8_cad_StartTransfer(u8x8);
+  // Set display start line
+  u8x8_cad_SendCmd(u8x8, 0x40 | ((panelRows - shift) % panelRows));
+  u8x8_cad_EndTransfer(u8x8);
+}
+
+template<typename TPanel>
+bool CPanelWeatherDisplay<TPanel>::IsRowShiftPossible(int8_t shift) const
+{
+  // Rows scrolled off one edge come back at the other one
+  const uint8_t panelRows = PAGE_COUNT * 8;
+  return shift == 0 || IsPanelRowBlank(shift > 0 ? panelRows - 1 : 0);
+}
+
+template<typename TPanel>
+bool CPanelWeatherDisplay<TPanel>::IsPanelRowBlank(uint8_t row) const
+{
+  const uint8_t* page = m_sentFrame + (row >> 3) * PAGE_SIZE;
+  const uint8_t bit = 1 << (row & 7);
+
+  for(uint8_t column = 0; column < PAGE_SIZE; ++column)
+  {
+    if(page[column] & bit)
     {
-      // DEBUG OUTPUT
+      return false;
     }
+  }
+  return true;
+}
+
+template<typename TPanel>
+bool CPanelWeatherDisplay<TPanel>::IsSentPixelLit(uint8_t x, uint8_t y) const
+{
+  const uint8_t panelRow = m_displayRotated ? SLayout::SCREEN_W - 1 - x : x;
+  const uint8_t panelColumn = m_displayRotated ? y : PAGE_SIZE - 1 - y;
+  return m_sentFrame[(panelRow >> 3) * PAGE_SIZE + panelColumn] >> (panelRow & 7) & 1;
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::UpdatePanelPower()
+{
+  // The controller keeps its RAM in power save, the frame comes back as it was
+  const bool powerSave = m_doNotDisturb || m_oledRefreshInProgress;
+  if(powerSave != m_panelPowerSave)
+  {
+    m_panelPowerSave = powerSave;
+    m_u8g2.setPowerSave(powerSave ? 1 : 0);
+    ++m_powerSaveSwitches;
+  }
+
+  const uint8_t contrast = m_isDay ? WEATHER_DISPLAY_CONTRAST_DAY : WEATHER_DISPLAY_CONTRAST_NIGHT;
+  if(!m_panelPowerSave && contrast != m_contrast)
+  {
+    m_contrast = contrast;
+    m_u8g2.setContrast(contrast);
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawWeatherIcon(EWeatherIcon mainIcon, EWeatherAuxIcon auxIcon)
+{
+  const unsigned char* const* mainIcons = SLayout::SMALL ? smallMainWeatherIcons : mainWeatherIcons;
+  const unsigned char* const* auxIcons = SLayout::SMALL ? smallAuxWeatherIcons : auxWeatherIcons;
+  const unsigned char* mainWeatherIcon = static_cast<const unsigned char*>(pgm_read_ptr(&mainIcons[mainIcon < WEATHER_ICON_COUNT ? mainIcon : ICON_NONE]));
+  const unsigned char* auxWeatherIcon = static_cast<const unsigned char*>(pgm_read_ptr(&auxIcons[auxIcon < WEATHER_AUX_ICON_COUNT ? auxIcon : AUX_ICON_NONE]));
+
+  if(mainWeatherIcon)
+  {
+    DrawPageBitmap( SLayout::MAIN_ICON_X, 0, SLayout::MAIN_ICON_W, SLayout::MAIN_ICON_H, mainWeatherIcon);
+  }
+
+  if(auxWeatherIcon)
+  {
+    DrawPageBitmap( SLayout::AUX_ICON_X, 0, SLayout::AUX_ICON_W, SLayout::AUX_ICON_H, auxWeatherIcon);
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawPageBitmap(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t width, u8g2_uint_t height, const uint8_t* bitmap)
+{
+  if(height > RLE_BITMAP_PAGE_COLUMNS_MAX)
+  {
+    return;
+  }
+
+  uint8_t columns[RLE_BITMAP_PAGE_COLUMNS_MAX];
+  CRleBitmapReader reader(bitmap);
+
+  const uint8_t pageCount = (width + 7) / 8;
+  for(uint8_t page = 0; page < pageCount; ++page)
+  {
+    reader.ReadBytes(columns, height);
+    BlitPage(x, y, width, height, page, columns, false);
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::BlitPage(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t width, u8g2_uint_t height, uint8_t page, const uint8_t* columns, bool transparent)
+{
+  // Pages hold logical columns and run along the panel from its right edge
+  // (U8G2_R1). U8G2_R3 is the same picture turned by 180 degrees: columns run
+  // the other way and the rows of every byte are mirrored.
+  uint8_t* buffer = m_u8g2.getBufferPtr();
+  const int16_t bufferColumns = m_u8g2.getBufferTileWidth() * 8;
+  const int16_t bufferPages = m_u8g2.getBufferTileHeight();
+  const int16_t firstColumn = m_displayRotated ? y + height - 1 : SLayout::SCREEN_H - y - height;
+  const int8_t columnStep = m_displayRotated ? -1 : 1;
+
+  // Clip box in panel rows and columns
+  const int16_t clipRowFirst = m_displayRotated ? SLayout::SCREEN_W - m_clip.m_x - m_clip.m_w : m_clip.m_x;
+  const int16_t clipRowEnd = clipRowFirst + m_clip.m_w;
+  const int16_t clipColumnFirst = m_displayRotated ? m_clip.m_y : SLayout::SCREEN_H - m_clip.m_y - m_clip.m_h;
+  const int16_t clipColumnEnd = clipColumnFirst + m_clip.m_h;
+
+  // Padding rows of the last page are left alone
+  const uint8_t rows = width - page * 8 < 8 ? width - page * 8 : 8;
+  uint8_t rowMask = 0xFF >> (8 - rows);
+  int16_t row = x + page * 8;
+  if(m_displayRotated)
+  {
+    rowMask = ReverseBits(rowMask);
+    row = SLayout::SCREEN_W - x - 8 - page * 8;
+  }
+
+  // Only padding rows can fall above the panel
+  uint8_t dropped = 0;
+  if(row < 0)
+  {
+    dropped = -row;
+    row = 0;
+  }
+
+  const int16_t bufferPage = row >> 3;
+  if(bufferPage >= bufferPages)
+  {
+    return;
+  }
 
-    if(auxWeatherIcon)
+  const uint8_t shift = row & 7;
+  const uint16_t mask = (static_cast<uint16_t>(rowMask >> dropped) << shift) & RowRangeMask(bufferPage * 8, clipRowFirst, clipRowEnd);
+  if(!mask)
+  {
+    return;
+  }
+
+  uint8_t* low = buffer + bufferPage * bufferColumns;
+  uint8_t* high = (mask >> 8) && bufferPage + 1 < bufferPages ? low + bufferColumns : nullptr;
+
+  int16_t column = firstColumn;
+  for(uint8_t index = 0; index < height; ++index, column += columnStep)
+  {
+    if(column < clipColumnFirst || column >= clipColumnEnd || column >= bufferColumns)
     {
-      u8g2.drawXBMP( WEATHER_DISPLAY_W - WEATHER_ADDITIONAL_ICON_W, 0, WEATHER_ADDITIONAL_ICON_W, WEATHER_ADDITIONAL_ICON_H, auxWeatherIcon);
+      continue;
     }
-    else
+
+    const uint8_t bits = m_displayRotated ? ReverseBits(columns[index]) : columns[index];
+    const uint16_t value = (static_cast<uint16_t>(bits >> dropped) << shift) & mask;
+
+    // Transparent blits only set pixels, like u8g2 draws glyphs
+    const uint16_t keep = transparent ? 0xFFFF : ~mask;
+    low[column] = (low[column] & keep) | value;
+    if(high)
     {
-      // DEBUG OUTPUT
+      high[column] = (high[column] & (keep >> 8)) | (value >> 8);
     }
-    
-    u8g2.setDrawColor(1);
   }
-  else
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawGlyphText(EGlyphFont font, u8g2_uint_t x, u8g2_uint_t y, const char* text)
+{
+  uint8_t columns[RLE_BITMAP_PAGE_COLUMNS_MAX];
+  for(; *text; ++text)
   {
-    // PRINT OUTPUT
-  }
-}
-
-EWeatherType CWeatherDisplay::GetWeatherType(unsigned int weatherId, bool isDay)
-{
-  switch(weatherId)
-  {
-    // Thunderstorm
-    case 200:
-    return EWeatherType::THUNDERSTROM_LIGHT_RAIN;
-    case 201:
-    return EWeatherType::THUNDERSTORM_RAIN;
-    case 202:
-    return EWeatherType::THUNDERSTORM_HEAVY_RAIN;
-    case 210:
-    case 211:
-    return EWeatherType::THUNDERSTORM;
-    case 212:
-    return EWeatherType::THUNDERSTORM_HEAVY;
-    case 221:
-    return EWeatherType::THUNDERSTORM;
-    case 230:
-    case 231:
-    return EWeatherType::THUNDERSTROM_LIGHT_RAIN;
-    case 232:
-    return EWeatherType::THUNDERSTORM_HEAVY_RAIN;
-
-    //Drizzle
-    case 300:
-    case 301:
-    return isDay ? EWeatherType::RAIN_LIGHT_DAY : EWeatherType::RAIN_LIGHT_NIGHT;
-    case 302:
-    return isDay ? EWeatherType::RAIN_HEAVY_DAY : EWeatherType::RAIN_HEAVY_NIGHT;
-    case 310:
-    case 311:
-    case 312:
-    case 313:
-    return isDay ? EWeatherType::RAIN_DAY : EWeatherType::RAIN_NIGHT;
-    case 314:
-    return isDay ? EWeatherType::RAIN_HEAVY_DAY : EWeatherType::RAIN_HEAVY_NIGHT;
-    case 321:
-    return isDay ? EWeatherType::RAIN_DAY : EWeatherType::RAIN_NIGHT;
-
-    // Rain
-    case 500:
-    return isDay ? EWeatherType::RAIN_LIGHT_DAY : EWeatherType::RAIN_LIGHT_NIGHT;
-    case 501:
-    return isDay ? EWeatherType::RAIN_DAY : EWeatherType::RAIN_NIGHT;
-    case 502:
-    case 503:
-    case 504:
-    return isDay ? EWeatherType::RAIN_HEAVY_DAY : EWeatherType::RAIN_HEAVY_NIGHT;
-    case 511:
-    return isDay ? EWeatherType::RAIN_FREEZING_DAY : EWeatherType::RAIN_FREEZING_NIGHT;
-    case 520:
-    case 521:
-    return isDay ? EWeatherType::RAIN_DAY : EWeatherType::RAIN_NIGHT;
-    case 522:
-    return isDay ? EWeatherType::RAIN_HEAVY_DAY : EWeatherType::RAIN_HEAVY_NIGHT;
-    case 531:
-    return isDay ? EWeatherType::RAIN_DAY : EWeatherType::RAIN_NIGHT;
-
-    // Snow
-    case 600:
-    case 601:
-    return EWeatherType::SNOW;
-    case 602:
-    return EWeatherType::SNOW_HEAVY;
-    case 611:
-    case 612:
-    return EWeatherType::SNOW_SHOWER;
-    case 613:
-    return EWeatherType::SNOW_HEAVY_SHOWER;
-    case 615:
-    return EWeatherType::SNOW_RAIN;
-    case 616:
-    return EWeatherType::SNOW_HEAVY_RAIN;
-    case 620:
-    return EWeatherType::SNOW_SHOWER;
-    case 621:
-    case 622:
-    return EWeatherType::SNOW_HEAVY_SHOWER;
-
-    //Atmosphere
-    case 701:
-    case 711:
-    case 721:
-    case 731:
-    case 741:
-    case 751:
-    case 761:
-    case 762:
-    case 771:
-    case 781:
-    return EWeatherType::MIST;
-
-    //Clear
-    case 800:
-    return isDay ? EWeatherType::CLEAR_DAY : EWeatherType::CLEAR_NIGHT;
-
-    //Clouds
-    case 801:
-    return isDay ? EWeatherType::CLOUDS_LIGHT_DAY : EWeatherType::CLOUDS_LIGHT_NIGHT;
-    case 802:
-    case 803:
-    return isDay ? EWeatherType::CLOUDS_MEDIUM_DAY : EWeatherType::CLOUDS_MEDIUM_NIGHT;
-    case 804:
-    return EWeatherType::CLOUDS_HEAVY;
+    SAtlasGlyph glyph;
+    if(!CGlyphAtlas::GetGlyph(font, *text, glyph))
+    {
+#ifndef GLYPH_ATLAS_GENERATED
+      m_u8g2.setFont(static_cast<const uint8_t*>(pgm_read_ptr(&glyphFonts[font])));
+      x += m_u8g2.drawGlyph(x, y, static_cast<uint8_t>(*text));
+#endif
+      continue;
+    }
 
-    default:
-    return EWeatherType::UNKNOWN;
+    // A glyph hanging off the top or left screen edge can't be blitted, no
+    // temperature is placed that close to it
+    const int16_t glyphX = x + glyph.m_offsetX;
+    const int16_t glyphY = y + glyph.m_offsetY;
+    if(glyph.m_width && glyphX >= 0 && glyphY >= 0)
+    {
+      const uint8_t* data = CGlyphAtlas::GetGlyphData(glyph);
+      const uint8_t pageCount = (glyph.m_width + 7) / 8;
+      for(uint8_t page = 0; page < pageCount; ++page)
+      {
+        memcpy_P(columns, data + page * glyph.m_height, glyph.m_height);
+        BlitPage(glyphX, glyphY, glyph.m_width, glyph.m_height, page, columns, true);
+      }
+    }
+    x += glyph.m_advance;
   }
 }
 
-void CWeatherDisplay::PrepareTemperatureForDisplay(const short currentTemp, const short eveningTemp, const unsigned short yOffset)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawCurrentTemperature(const short currentTemp)
 {
   const unsigned short currenttemperatureCursorOffsetX = 0;
-  const unsigned short currentTemperatureCursorOffsetY = yOffset;
-  const unsigned short currentTemperatureTextSize = 3;
-  
-  const unsigned short eveningTemperatureCursorOffsetX = 30;
-  const unsigned short eveningTemperatureCursorOffsetY = 17;
-  const unsigned short eveningTemperatureTextSize = 1;
+  const unsigned short currentTemperatureCursorOffsetY = SLayout::CURRENT_TEMP_Y;
 
-  u8g2.setFont(u8g2_font_fub30_tn);
-  
-  u8g2.setCursor(currenttemperatureCursorOffsetX,currentTemperatureCursorOffsetY);
-  
-  DisplayTemperatureAlligment(currentTemp);
+  char text[GLYPH_TEXT_SIZE];
+  FormatTemperature(currentTemp, text);
+  DrawGlyphText(SLayout::CURRENT_TEMP_FONT, currenttemperatureCursorOffsetX, currentTemperatureCursorOffsetY, text);
 
-  if(m_celsiusSign)
+  // No room for it beside the temperature on the small layout
+  if(m_celsiusSign && SLayout::DEGREE_SIGN)
   {
     // Display Celsius sign
-    u8g2.setFont(u8g2_font_helvR12_tf);
-    
-    u8g2.setCursor(currenttemperatureCursorOffsetX + 58,currentTemperatureCursorOffsetY - 23);
-    u8g2.print("\xb0");
+    DrawGlyphText(GLYPH_FONT_DEGREE, currenttemperatureCursorOffsetX + SLayout::DEGREE_X, SLayout::DEGREE_Y, "\xb0");
   }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawEveningTemperature(const short eveningTemp)
+{
+  const unsigned short eveningTemperatureCursorOffsetX = SLayout::EVENING_TEMP_X;
+  const unsigned short eveningTemperatureCursorOffsetY = SLayout::EVENING_TEMP_Y;
 
-  u8g2.setFont(u8g2_font_fub14_tn);
-  u8g2.setCursor(eveningTemperatureCursorOffsetX,currentTemperatureCursorOffsetY + eveningTemperatureCursorOffsetY);
-  DisplayTemperatureAlligment(eveningTemp);
+  char text[GLYPH_TEXT_SIZE];
+  FormatTemperature(eveningTemp, text);
+  if(SLayout::SMALL)
+  {
+    // The glyph atlas has no font smaller than the current temperature's
+    m_u8g2.setFont(u8g2_font_5x7_tr);
+    m_u8g2.drawStr(eveningTemperatureCursorOffsetX, eveningTemperatureCursorOffsetY, text);
+    return;
+  }
+  DrawGlyphText(GLYPH_FONT_EVENING_TEMPERATURE, eveningTemperatureCursorOffsetX, eveningTemperatureCursorOffsetY, text);
 }
 
-void CWeatherDisplay::DisplayTemperatureAlligment(const short temp)
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::FormatTemperature(const short temp, char (&text)[GLYPH_TEXT_SIZE])
 {
   const bool minus = temp < 0 ? true : false;
   short tens = temp / 10;
   tens = tens < 0 ? tens * -1 : tens;
   short numbers = temp < 0 ? temp * -1 : temp;
   numbers -= tens * 10;
-    
-  if(minus)
+
+  // Sign and tens keep their place as blanks, the units digit stays put
+  if(tens != 0)
   {
-    u8g2.print("-");
+    snprintf(text, sizeof(text), "%c%d%d", minus ? '-' : ' ', tens, numbers);
   }
   else
   {
-    u8g2.print(" ");
+    snprintf(text, sizeof(text), "%c %d", minus ? '-' : ' ', numbers);
   }
-    
-  if(tens != 0)
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawTemperatureGraph()
+{
+  const unsigned short graphTop = 20;
+  const unsigned short graphHeight = 84;
+  const unsigned short graphBottom = graphTop + graphHeight - 1;
+  const unsigned short hourTicks = 3;
+
+  char text[16];
+  m_u8g2.setFont(SLayout::TEXT_FONT);
+  snprintf(text, sizeof(text), "%dh temp", WEATHER_DISPLAY_TEMPERATURE_GRAPH_HOURS);
+  m_u8g2.drawStr(0, 7, text);
+
+  if(m_timelineIndex == FORECAST_TIMELINE_INDEX_UNKNOWN || m_timelineIndex >= m_timeline.m_count)
   {
-    u8g2.print(tens);
+    return;
   }
-  else
+
+  const SForecastHour* hours = m_timeline.m_hours + m_timelineIndex;
+  const uint8_t hoursLeft = m_timeline.m_count - m_timelineIndex;
+  const uint8_t count = hoursLeft < WEATHER_DISPLAY_TEMPERATURE_GRAPH_HOURS ? hoursLeft : WEATHER_DISPLAY_TEMPERATURE_GRAPH_HOURS;
+
+  int16_t minTemp = hours[0].m_feelsLike;
+  int16_t maxTemp = hours[0].m_feelsLike;
+  for(uint8_t hour = 1; hour < count; ++hour)
+  {
+    minTemp = min(minTemp, hours[hour].m_feelsLike);
+    maxTemp = max(maxTemp, hours[hour].m_feelsLike);
+  }
+  const int16_t range = maxTemp > minTemp ? maxTemp - minTemp : 1;
+
+  snprintf(text, sizeof(text), "%d", maxTemp);
+  m_u8g2.drawStr(0, graphTop - 3, text);
+  snprintf(text, sizeof(text), "%d", minTemp);
+  m_u8g2.drawStr(0, graphBottom + 11, text);
+
+  // Hours are spread over the full width, a short timeline ends early
+  u8g2_uint_t lastX = 0;
+  u8g2_uint_t lastY = 0;
+  for(uint8_t hour = 0; hour < count; ++hour)
+  {
+    const u8g2_uint_t x = hour * (SLayout::SCREEN_W - 1) / (WEATHER_DISPLAY_TEMPERATURE_GRAPH_HOURS - 1);
+    const u8g2_uint_t y = graphTop + static_cast<int32_t>(maxTemp - hours[hour].m_feelsLike) * (graphHeight - 1) / range;
+
+    if(hour)
+    {
+      m_u8g2.drawLine(lastX, lastY, x, y);
+    }
+    else
+    {
+      m_u8g2.drawPixel(x, y);
+    }
+
+    if(hour % hourTicks == 0)
+    {
+      m_u8g2.drawVLine(x, graphBottom + 2, 2);
+    }
+
+    lastX = x;
+    lastY = y;
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawPoPChart()
+{
+  const unsigned short chartTop = 12;
+  const unsigned short rowPitch = 2;
+  const uint8_t maxPercent = 100;
+
+  char text[16];
+  m_u8g2.setFont(SLayout::TEXT_FONT);
+  snprintf(text, sizeof(text), "%dh rain", WEATHER_DISPLAY_POP_CHART_HOURS);
+  m_u8g2.drawStr(0, 7, text);
+
+  if(m_timelineIndex == FORECAST_TIMELINE_INDEX_UNKNOWN || m_timelineIndex >= m_timeline.m_count)
+  {
+    return;
+  }
+
+  const uint8_t hoursLeft = m_timeline.m_count - m_timelineIndex;
+  const uint8_t count = hoursLeft < WEATHER_DISPLAY_POP_CHART_HOURS ? hoursLeft : WEATHER_DISPLAY_POP_CHART_HOURS;
+  const unsigned long firstLocalHour = (m_timeline.m_firstDt + m_timeline.m_timezoneOffset) / 3600 + m_timelineIndex;
+
+  // One bar per hour running down the screen, midnight is a dotted line in
+  // the gap above its hour
+  for(uint8_t hour = 0; hour < count; ++hour)
+  {
+    const u8g2_uint_t y = chartTop + hour * rowPitch;
+
+    if(hour && (firstLocalHour + hour) % 24 == 0)
+    {
+      for(u8g2_uint_t x = 0; x < SLayout::SCREEN_W; x += 4)
+      {
+        m_u8g2.drawPixel(x, y - 1);
+      }
+    }
+
+    const uint8_t pop = m_timeline.m_hours[m_timelineIndex + hour].m_pop > maxPercent ? maxPercent : m_timeline.m_hours[m_timelineIndex + hour].m_pop;
+    // Rounded up like the PoP bars, any chance of rain shows
+    const u8g2_uint_t width = (SLayout::SCREEN_W * pop + maxPercent - 1) / maxPercent;
+    if(width)
+    {
+      m_u8g2.drawHLine(0, y, width);
+    }
+  }
+}
+
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawDeviceStatus()
+{
+  const unsigned short lineHeight = 11;
+  unsigned short baseline = 8;
+
+  SDeviceStatus status = {};
+  if(m_deviceStatusCb)
   {
-    u8g2.print(" ");
+    m_deviceStatusCb(status);
   }
-    
-  u8g2.print(numbers);
+
+  const unsigned long uptime = millis() / 1000;
+  const uint8_t* ip = reinterpret_cast<const uint8_t*>(&status.m_ip);
+
+  // 12 characters of the text font fill a line, 8 on the small layout
+  char text[16];
+  m_u8g2.setFont(SLayout::TEXT_FONT);
+
+  m_u8g2.drawStr(0, baseline, "WiFi");
+  baseline += lineHeight;
+  snprintf(text, sizeof(text), "%d dBm", status.m_rssi);
+  m_u8g2.drawStr(0, baseline, status.m_rssi ? text : "-");
+  baseline += lineHeight;
+
+  m_u8g2.drawStr(0, baseline, "IP");
+  baseline += lineHeight;
+  snprintf(text, sizeof(text), "%u.%u.", ip[0], ip[1]);
+  m_u8g2.drawStr(0, baseline, text);
+  baseline += lineHeight;
+  snprintf(text, sizeof(text), "%u.%u", ip[2], ip[3]);
+  m_u8g2.drawStr(0, baseline, text);
+  baseline += lineHeight;
+
+  m_u8g2.drawStr(0, baseline, "Uptime");
+  baseline += lineHeight;
+  snprintf(text, sizeof(text), "%lud %02lu:%02lu", uptime / 86400, uptime / 3600 % 24, uptime / 60 % 60);
+  m_u8g2.drawStr(0, baseline, text);
+  baseline += lineHeight;
+
+  m_u8g2.drawStr(0, baseline, SLayout::SMALL ? "Heap" : "Free heap");
+  baseline += lineHeight;
+  snprintf(text, sizeof(text), "%lu", static_cast<unsigned long>(status.m_freeHeap));
+  m_u8g2.drawStr(0, baseline, text);
+  baseline += lineHeight;
+
+  m_u8g2.drawStr(0, baseline, "Forecast");
+  baseline += lineHeight;
+  m_u8g2.drawStr(0, baseline, m_errorMark ? "Error" : m_staleMark ? "Cached" : "OK");
 }
 
-void CWeatherDisplay::DrawPoPBars()
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawPoPBars()
 {
   unsigned short offsetX = 0;
-  const unsigned short offsetY = 57;
+  const unsigned short offsetY = SLayout::POP_Y;
 
   const unsigned short gap = 2;
   const unsigned short barWidth = 2;
 
-  for(unsigned short index = 0, offsetX = 0; offsetX <= WEATHER_DISPLAY_W; offsetX += barWidth + gap, ++index)
+  const SWeatherInfo& weatherInfo = GetWeatherInfo();
+
+  for(unsigned short index = 0, offsetX = 0; offsetX < SLayout::SCREEN_W && index < weatherInfo.m_popCount; offsetX += barWidth + gap, ++index)
   {
-    DrawBar(offsetX, offsetY, barWidth, m_weatherInfo.m_pop[index]);
+    DrawBar(offsetX, offsetY, barWidth, weatherInfo.m_pop[index]);
   }  
 }
 
-void CWeatherDisplay::DrawBar(const unsigned short barPosX, const unsigned short barPosY, unsigned short barWidth, float barHeightPercent) 
+template<typename TPanel>
+void CPanelWeatherDisplay<TPanel>::DrawBar(const unsigned short barPosX, const unsigned short barPosY, unsigned short barWidth, uint8_t barHeightPercent) 
 {
-  const unsigned short maxBarHeightPx = 16;
-  const float maxBarHeightPercent = 1.0f;
-
-  unsigned barHeightPx = 0;
+  const unsigned short maxBarHeightPx = SLayout::POP_H;
+  const uint8_t maxBarHeightPercent = 100;
 
   barHeightPercent = barHeightPercent > maxBarHeightPercent ? maxBarHeightPercent : barHeightPercent;
 
-  barHeightPx = ceil(maxBarHeightPx * barHeightPercent);
+  // Rounded up, any chance of rain shows at least one pixel
+  const unsigned short barHeightPx = (maxBarHeightPx * barHeightPercent + maxBarHeightPercent - 1) / maxBarHeightPercent;
   
-  u8g2.drawBox(barPosX, barPosY, barWidth, barHeightPx);
+  m_u8g2.drawBox(barPosX, barPosY, barWidth, barHeightPx);
 }
+
+template class CPanelWeatherDisplay<CDisplayPanel>;
@@ -8,6 +8,11 @@
 
 #include "weather_icons.h"
 #include "wifi_icons.h"
+#include "WeatherCodes.h"
+#include "WeatherInfo.h"
+#include "RleBitmap.h"
+#include "GlyphAtlas.h"
+#include "DisplayPanel.h"
 
 #include "DebugHelpers.h"
 
@@ -27,113 +32,360 @@
 #define WEATHER_DISPLAY_OLED_END_REFRESH 1
 #endif
 
-#define WEATHER_DISPLAY_W 64
-#define WEATHER_DISPLAY_H 128
+// Changes within one frame window are drawn together in the next frame, the
+// time in between is left to the web server and the network stack
+#define WEATHER_DISPLAY_MAX_FRAME_RATE 10
+#define WEATHER_DISPLAY_WIFI_ANIMATION_INTERVAL 500
+// Frame buffer pages sent per UpdateDisplay() call, the rest of a frame
+// follows on the next loop() iterations
+#define WEATHER_DISPLAY_PAGES_PER_UPDATE 1
+
+// Carousel pages drawn from the timeline cover this many hours
+#define WEATHER_DISPLAY_TEMPERATURE_GRAPH_HOURS 12
+#define WEATHER_DISPLAY_POP_CHART_HOURS FORECAST_TIMELINE_MAX_COUNT
+// The device status page is redrawn this often while it is shown
+#define WEATHER_DISPLAY_STATUS_PAGE_REFRESH 1000 * 5
+
+// OLED protection moves the picture around by a pixel every refresh period
+// instead of blanking the panel. Comment out to blank it as before.
+#define WEATHER_DISPLAY_OLED_PIXEL_SHIFT
+
+// Lower contrast at night draws less current and ages the panel slower
+#define WEATHER_DISPLAY_CONTRAST_DAY 255
+#define WEATHER_DISPLAY_CONTRAST_NIGHT 48
+
+// Frame buffer pages of 8 panel rows are sent as rows of 8x8 tiles
+#define WEATHER_DISPLAY_TILE_SIZE 8
+
+// Sign, up to two tens digits, units digit and the terminator
+#define GLYPH_TEXT_SIZE 5
 
 ///////////////// CODE
-enum EWeatherType
+// Parts of the weather screen, in drawing order. Each one is redrawn on its
+// own when it changes.
+enum EDisplayLayer : uint8_t
 {
-  UNKNOWN = -1,
-  
-  THUNDERSTROM_LIGHT_RAIN = 0,
-  THUNDERSTORM_RAIN,
-  THUNDERSTORM,
-  THUNDERSTORM_HEAVY,
-  THUNDERSTORM_HEAVY_RAIN,
-
-  RAIN_LIGHT,
-  RAIN_LIGHT_DAY,
-  RAIN_LIGHT_NIGHT,
-  RAIN,
-  RAIN_DAY,
-  RAIN_NIGHT,
-  RAIN_HEAVY,
-  RAIN_HEAVY_DAY,
-  RAIN_HEAVY_NIGHT,
-  RAIN_FREEZING,
-  RAIN_FREEZING_DAY,
-  RAIN_FREEZING_NIGHT,
-
-  SNOW,
-  SNOW_HEAVY,
-  SNOW_SHOWER,
-  SNOW_HEAVY_SHOWER,
-  SNOW_RAIN,
-  SNOW_HEAVY_RAIN,
-
-  MIST,
-
-  CLEAR_DAY,
-  CLEAR_NIGHT,
-
-  CLOUDS_LIGHT_DAY,
-  CLOUDS_LIGHT_NIGHT,
-  CLOUDS_MEDIUM_DAY,
-  CLOUDS_MEDIUM_NIGHT,
-  CLOUDS_HEAVY
+  LAYER_ICON,
+  LAYER_POP,
+  LAYER_CURRENT_TEMP,
+  LAYER_EVENING_TEMP,
+  LAYER_STATUS,
+  DISPLAY_LAYER_COUNT
 };
 
-struct SWeatherInfo
+// Screens of the carousel. Only the weather screen is kept as a ready frame,
+// the others are drawn again every time they are shown.
+enum EDisplayPage : uint8_t
 {
-  unsigned int m_weatherId = 0;
-  Array<float, WEATHER_DISPLAY_W> m_pop;
-  short m_currentTemp = 0;
-  short m_eveningTemp = 0;
+  PAGE_WEATHER,
+  PAGE_TEMPERATURE_GRAPH,
+  PAGE_POP_CHART,
+  PAGE_DEVICE_STATUS,
+  DISPLAY_PAGE_COUNT
 };
 
-class CWeatherDisplay
+// What the device status page shows, filled in by the sketch
+struct SDeviceStatus
+{
+  uint32_t m_ip;        // IPAddress as uint32_t, first octet lowest
+  int8_t m_rssi;        // dBm, 0 when not connected
+  uint32_t m_freeHeap;
+};
+
+#define DISPLAY_LAYERS_ALL ((1 << DISPLAY_LAYER_COUNT) - 1)
+#define DISPLAY_LAYERS_FORECAST (DISPLAY_LAYERS_ALL & ~(1 << LAYER_STATUS))
+
+// Box on the rotated screen, w x h pixels from x, y
+struct SDisplayBox
+{
+  uint8_t m_x;
+  uint8_t m_y;
+  uint8_t m_w;
+  uint8_t m_h;
+};
+
+// Weather screen of a panel turned to portrait, W x H pixels. 64 columns
+// take the full size icons and temperature fonts. 32 columns take the half
+// size icons, the evening temperature font for the current temperature and
+// the 5x7 font for the evening one, and leave out the degree sign.
+template<uint8_t W, uint8_t H>
+struct SWeatherLayout
+{
+  static_assert((W == 64 || W == 32) && H == 128, "The weather screen is laid out for 128x64 and 128x32 panels");
+
+  static constexpr uint8_t SCREEN_W = W;
+  static constexpr uint8_t SCREEN_H = H;
+  static constexpr bool SMALL = W < 64;
+
+  // Main icon centered at the top, the aux icon in its top right corner
+  static constexpr uint8_t MAIN_ICON_W = SMALL ? WEATHER_SMALL_ICON_W : WEATHER_ICON_W;
+  static constexpr uint8_t MAIN_ICON_H = SMALL ? WEATHER_SMALL_ICON_H : WEATHER_ICON_H;
+  static constexpr uint8_t MAIN_ICON_X = (W - MAIN_ICON_W) / 2;
+  static constexpr uint8_t AUX_ICON_W = SMALL ? WEATHER_SMALL_ADDITIONAL_ICON_W : WEATHER_ADDITIONAL_ICON_W;
+  static constexpr uint8_t AUX_ICON_H = SMALL ? WEATHER_SMALL_ADDITIONAL_ICON_H : WEATHER_ADDITIONAL_ICON_H;
+  static constexpr uint8_t AUX_ICON_X = W - AUX_ICON_W;
+
+  // PoP bars below the icon, 100 % fills POP_H
+  static constexpr uint8_t POP_Y = MAIN_ICON_H + 1;
+  static constexpr uint8_t POP_H = 16;
+
+  // Baselines of the temperatures. The current one fills the space between
+  // the PoP bars and the evening one at the bottom.
+  static constexpr uint8_t CURRENT_TEMP_TOP = POP_Y + POP_H + 1;
+  static constexpr EGlyphFont CURRENT_TEMP_FONT = SMALL ? GLYPH_FONT_EVENING_TEMPERATURE : GLYPH_FONT_TEMPERATURE;
+  static constexpr uint8_t CURRENT_TEMP_Y = CURRENT_TEMP_TOP + (SMALL ? 15 : 36);
+  static constexpr uint8_t EVENING_TEMP_X = SMALL ? W - 15 : 30;
+  static constexpr uint8_t EVENING_TEMP_Y = CURRENT_TEMP_Y + (SMALL ? 12 : 17);
+  static constexpr uint8_t EVENING_TEMP_H = SMALL ? 9 : 16;
+  static constexpr uint8_t EVENING_TEMP_TOP = EVENING_TEMP_Y + 1 - EVENING_TEMP_H;
+
+  // Degree sign at the top right of the current temperature
+  static constexpr bool DEGREE_SIGN = !SMALL;
+  static constexpr uint8_t DEGREE_X = W - 6;
+  static constexpr uint8_t DEGREE_Y = CURRENT_TEMP_Y - 23;
+
+  // Text of the carousel pages and the WiFi screens
+  static constexpr const uint8_t* TEXT_FONT = SMALL ? u8g2_font_4x6_tr : u8g2_font_5x7_tr;
+  // The WiFi screens leave out an icon wider than the screen
+  static constexpr bool WIFI_ICON = WIFI_ICON_W <= W;
+
+  static constexpr SDisplayBox FULL_SCREEN = { 0, 0, W, H };
+
+  // Indexed by EDisplayLayer. Status marks sit on top of the icon corners.
+  static constexpr SDisplayBox LAYER_BOXES[DISPLAY_LAYER_COUNT] = {
+    { MAIN_ICON_X, 0, W - MAIN_ICON_X, MAIN_ICON_H },                           // main and aux icon
+    { 0, POP_Y, W, POP_H },                                                     // PoP bars
+    { 0, CURRENT_TEMP_TOP, W, EVENING_TEMP_TOP - CURRENT_TEMP_TOP },            // current temperature and degree sign
+    { EVENING_TEMP_X, EVENING_TEMP_TOP, W - EVENING_TEMP_X, EVENING_TEMP_H },   // evening temperature
+    { 0, 0, W, 17 }                                                             // error, no WiFi and stale marks
+  };
+
+  static_assert(EVENING_TEMP_Y < H, "The evening temperature has to fit on the screen");
+};
+
+template<uint8_t W, uint8_t H>
+constexpr SDisplayBox SWeatherLayout<W, H>::FULL_SCREEN;
+
+template<uint8_t W, uint8_t H>
+constexpr SDisplayBox SWeatherLayout<W, H>::LAYER_BOXES[DISPLAY_LAYER_COUNT];
+
+// The weather station screen on TPanel, one of the panels of DisplayPanel.h.
+// The layout follows from the panel size at compile time. The code lives in
+// WeatherDisplay.cpp, which instantiates it for CDisplayPanel only.
+template<typename TPanel>
+class CPanelWeatherDisplay
 {
   public:
-    CWeatherDisplay();
+    typedef void(*deviceStatusCb)(SDeviceStatus& status);
+    // The screen is the panel turned to portrait
+    typedef SWeatherLayout<TPanel::HEIGHT, TPanel::WIDTH> SLayout;
+
+    CPanelWeatherDisplay();
 
     void Begin();
-    void SetWeatherInfo(const SWeatherInfo& weatherInfo);
+    // The timeline is filled in place, publishing it shows the hour matching
+    // the last SetLocalTime(). Later hours are shown as time goes by, without
+    // a new forecast being needed.
+    SForecastTimeline& AcquireTimeline() { return m_timeline; }
+    void PublishTimeline();
+    const SForecastTimeline& GetTimeline() const { return m_timeline; }
+    void SetLocalTime(unsigned long localTime);
+
+    const SWeatherInfo& GetWeatherInfo() const { return m_weatherInfo[m_weatherInfoSlot]; }
     void SetDoNotDisturb(bool doNotDisturb);
     void SetIsDay(bool isDay);
     void SetErrorMark(bool error);
     void SetNoWifiConnectionMark(bool noWifi);
+    void SetStaleMark(bool stale);
     void SetCelsiusSign(bool celsiusSign);
 
     void EnableOLEDProtection(bool enable, unsigned int updateTime = WEATHER_DISPLAY_OLED_START_REFRESH, unsigned int timeOff = WEATHER_DISPLAY_OLED_END_REFRESH);
 
+    void SetMaxFrameRate(uint8_t framesPerSecond);
+    // Seconds the page stays on screen before the carousel moves on, 0 leaves
+    // it out. With no other page to go to the current one stays.
+    void SetPageInterval(EDisplayPage page, uint16_t seconds);
+    void SetDeviceStatusCb(deviceStatusCb callback) { m_deviceStatusCb = callback; }
     void UpdateDisplay();
+    // Sends what is left of the frame being transferred right away
+    void FlushDisplay() { SendPages(PAGE_COUNT); }
 
     void ResetAnimationFrames();
+    // Can be called as often as wanted, draws the next frame once it is due
     void UpdateWiFiAnimation(const char* ssidName);
     void UpdateWiFiConnectedState(const char* ssidName, const String& ipAdress);
 
     void DisplayWiFiConfigurationHelpText(const char* ssidName);
 
     void SetDisplayRotation(bool rotate);
+
+    uint32_t GetBytesSent() const { return m_bytesSent; }
+    uint32_t GetTilesSkipped() const { return m_tilesSkipped; }
+    unsigned long GetLastRenderTime() const { return m_lastRenderUs; }
+    unsigned long GetMaxRenderTime() const { return m_maxRenderUs; }
+    // Time DrawWeatherIcon() took to blit both icons the last time
+    unsigned long GetLastIconDrawTime() const { return m_lastIconDrawUs; }
+    unsigned long GetLastSendTime() const { return m_lastSendUs; }
+    unsigned long GetLastPageSendTime() const { return m_lastPageSendUs; }
+    unsigned long GetMaxPageSendTime() const { return m_maxPageSendUs; }
+    uint32_t GetPowerSaveSwitches() const { return m_powerSaveSwitches; }
+    uint32_t GetRowShiftsSkipped() const { return m_rowShiftsSkipped; }
+    uint32_t GetFramesRendered() const { return m_framesRendered; }
+    uint32_t GetFramesCoalesced() const { return m_framesCoalesced; }
+    uint32_t GetFramesDropped() const { return m_framesDropped; }
+    EDisplayPage GetCurrentPage() const { return m_currentPage; }
+    uint32_t GetPageFlips() const { return m_pageFlips; }
+
+    // Writes what the panel currently shows as a binary PBM image of the
+    // rotated screen, lit pixels white
+    void PrintScreenPbm(Print& out) const;
+
+    // The u8g2 driver, for drawing around CPanelWeatherDisplay in tests
+    TPanel& GetPanel() { return m_u8g2; }
     
   private:
+    // Frame buffer: pages of 8 panel rows, a page is a row of tiles
+    static constexpr uint8_t PAGE_COUNT = TPanel::HEIGHT / 8;
+    static constexpr uint8_t PAGE_SIZE = TPanel::WIDTH;
+    static constexpr uint16_t FRAME_SIZE = PAGE_COUNT * PAGE_SIZE;
+    static constexpr uint8_t PAGES_ALL = (1 << PAGE_COUNT) - 1;
+
+    static_assert(PAGE_COUNT <= 8, "Pending pages are kept in a byte");
+
+    // Weather info is double buffered: the back slot is filled in place and
+    // publishing only flips the slot index
+    SWeatherInfo& AcquireWeatherInfo();
+    void PublishWeatherInfo();
+    void DigestCurrentHour();
+
+    // Sends only the tiles that differ from the last frame sent. The u8g2
+    // buffer is the back buffer and m_sentFrame the front one: queued pages
+    // go out a few at a time while the next frame may already be drawn, a
+    // page changed again before it went out is simply sent as it is then.
+    void SendBuffer();
+    void QueueBuffer() { m_pendingPages = PAGES_ALL; }
+    void SendPages(uint8_t maxPages);
+    void SendPage(uint8_t page);
+    void InvalidateLayers(uint8_t layers) { m_dirtyLayers |= layers; ++m_pendingInvalidations; }
+    // Another screen took over the frame buffer, the weather screen is
+    // redrawn in full when it comes back
+    void InvalidateScreen() { m_dirtyLayers = DISPLAY_LAYERS_ALL; m_pendingInvalidations = 0; }
     void InternalUpdateWeatherDisplay();
+    // Moves to the next page once the current one had its time
+    void UpdateCarousel();
+    EDisplayPage GetNextPage() const;
+    // Switching away from the weather page keeps its frame, its layers go on
+    // being invalidated and are redrawn over that frame on the way back
+    void ShowPage(EDisplayPage page);
+    // Copies a cached page into the buffer, or draws it and caches it
+    void DrawPage(EDisplayPage page);
+    void DrawTemperatureGraph();
+    void DrawPoPChart();
+    void DrawDeviceStatus();
+    // Clears the box and redraws every layer touching it, clipped to the box
+    void RedrawBox(const SDisplayBox& box);
+    void DrawLayer(EDisplayLayer layer);
+    void DrawStatusMarks();
     void InternalOledRefresh();
-    void DrawWeatherIcon(EWeatherType weatherType);
-    void PrepareTemperatureForDisplay(const short currentTemp, const short eveningTemp, const unsigned short yOffset);
-    void DisplayTemperatureAlligment(const short temp);
-    void DrawBar(const unsigned short barPosX, const unsigned short barPosY, unsigned short barWidth, float barHeightPercent);
+    void DrawWeatherIcon(EWeatherIcon mainIcon, EWeatherAuxIcon auxIcon);
+    // Copies a bitmap from tools/generate_assets.py straight into the frame
+    // buffer pages, overwriting the whole width x height box
+    void DrawPageBitmap(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t width, u8g2_uint_t height, const uint8_t* bitmap);
+    // Copies one page of height column bytes of such a bitmap, a transparent
+    // copy leaves the pixels that are not set in it alone
+    void BlitPage(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t width, u8g2_uint_t height, uint8_t page, const uint8_t* columns, bool transparent);
+    // Draws text from the cursor x on baseline y like u8g2 would, glyphs are
+    // ORed into the frame buffer from the glyph atlas
+    void DrawGlyphText(EGlyphFont font, u8g2_uint_t x, u8g2_uint_t y, const char* text);
+    void DrawCurrentTemperature(const short currentTemp);
+    void DrawEveningTemperature(const short eveningTemp);
+    void FormatTemperature(const short temp, char (&text)[GLYPH_TEXT_SIZE]);
+    void DrawBar(const unsigned short barPosX, const unsigned short barPosY, unsigned short barWidth, uint8_t barHeightPercent);
     void DrawPoPBars();
 
     void OledStartRefresh();
     void OledEndRefresh();
-
-    EWeatherType GetWeatherType(unsigned int weatherId, bool isDay);
+    // Do not disturb and the OLED refresh put the panel in power save instead
+    // of sending it a blank frame, contrast follows day and night
+    void UpdatePanelPower();
+    // Moves the picture to the next pixel shift position. Columns move by
+    // resending the frame at another SH1106 RAM column, rows by the display
+    // start line. The start line wraps the row leaving one edge around to the
+    // other, so rows only move toward an edge whose row is blank: the step's
+    // direction if possible, the opposite one otherwise. With content on both
+    // edge rows the row shift is skipped and counted.
+    void ShiftPixels();
+    void ApplyPanelColumnShift(int8_t shift);
+    void ApplyPanelRowShift();
+    bool IsRowShiftPossible(int8_t shift) const;
+    bool IsPanelRowBlank(uint8_t row) const;
+    // Pixel x, y of the rotated screen in what the panel shows
+    bool IsSentPixelLit(uint8_t x, uint8_t y) const;
     
   private:
-    SWeatherInfo m_weatherInfo;
+    TPanel m_u8g2;
+    SWeatherInfo m_weatherInfo[2];
+    uint8_t m_weatherInfoSlot;
+    SForecastTimeline m_timeline;
+    uint8_t m_timelineIndex;
+    unsigned long m_localTime;
     bool m_doNotDisturb;
     bool m_isDay;
     bool m_errorMark;
     bool m_celsiusSign;
     bool m_noWifiConnectionMark;
-    bool m_needDisplayUpdate;
+    bool m_staleMark;
+    uint8_t m_dirtyLayers;
+    uint16_t m_pendingInvalidations;
+    unsigned long m_frameInterval;
+    unsigned long m_lastFrameTime;
+    uint32_t m_framesRendered;
+    uint32_t m_framesCoalesced;
+    uint32_t m_framesDropped;
+    uint16_t m_pageIntervals[DISPLAY_PAGE_COUNT];
+    EDisplayPage m_currentPage;
+    unsigned long m_pageShownTime;
+    unsigned long m_pageDrawTime;
+    bool m_pageDirty;
+    uint32_t m_pageFlips;
+    deviceStatusCb m_deviceStatusCb;
+    // Weather screen as it was left, its layers are only redrawn when dirty
+    bool m_weatherFrameValid;
+    uint8_t m_weatherFrame[FRAME_SIZE];
     bool m_oledProtectionEnabled;
     bool m_oledRefreshInProgress;
+    bool m_displayRotated;
+    // Drawing outside of it is dropped, DrawPageBitmap() included
+    SDisplayBox m_clip;
+
+    // Copy of what the panel shows, invalid until the first full frame
+    uint8_t m_sentFrame[FRAME_SIZE];
+    bool m_sentFrameValid;
+    uint32_t m_bytesSent;
+    uint32_t m_tilesSkipped;
+    unsigned long m_lastRenderUs;
+    unsigned long m_maxRenderUs;
+    unsigned long m_lastIconDrawUs;
+    unsigned long m_lastSendUs;
+    uint8_t m_pendingPages;
+    unsigned long m_transferUs;
+    unsigned long m_lastPageSendUs;
+    unsigned long m_maxPageSendUs;
+    bool m_panelPowerSave;
+    uint8_t m_contrast;
+    uint32_t m_powerSaveSwitches;
+    uint8_t m_pixelShiftStep;
+    int8_t m_panelColumnShift;
+    int8_t m_panelRowShift;
+    uint32_t m_rowShiftsSkipped;
 
     MillisTimer m_oledStartRefreshTimer;
     MillisTimer m_oledEndRefreshTimer;
 
     unsigned short m_currentAnimationFrame;
+    bool m_animationRunning;
+    unsigned long m_animationFrameTime;
 };
+
+typedef CPanelWeatherDisplay<CDisplayPanel> CWeatherDisplay;
 #endif
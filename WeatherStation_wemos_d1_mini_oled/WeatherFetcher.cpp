@@ -0,0 +1,456 @@
+#include "WeatherFetcher.h"
+
+static const char requestTemplate[] PROGMEM = "GET %s HTTP/1.0\r\nHost: %s\r\nUser-Agent: WeatherStation\r\nConnection: close\r\n\r\n";
+static const char headerRetryAfter[] PROGMEM = "Retry-After:";
+
+const __FlashStringHelper* FetchErrorToString(EFetchError error)
+{
+  switch(error)
+  {
+  case FETCH_ERROR_NONE:              return F("None");
+  case FETCH_ERROR_DNS:               return F("DNS");
+  case FETCH_ERROR_CONNECT:           return F("Connect");
+  case FETCH_ERROR_HTTP_UNAUTHORIZED: return F("HTTP 401");
+  case FETCH_ERROR_HTTP_RATE_LIMITED: return F("HTTP 429");
+  case FETCH_ERROR_HTTP_SERVER:       return F("HTTP 5xx");
+  case FETCH_ERROR_HTTP_OTHER:        return F("HTTP other");
+  case FETCH_ERROR_TRUNCATED:         return F("Truncated");
+  case FETCH_ERROR_PARSE:             return F("Parse");
+  case FETCH_ERROR_TIMEOUT:           return F("Timeout");
+  case FETCH_ERROR_REQUEST:           return F("Request");
+  default:                            return F("Unknown");
+  }
+}
+
+CWeatherFetcher::CWeatherFetcher()
+  : m_client()
+  , m_parser()
+  , m_forecast(nullptr)
+  , m_state(FETCH_IDLE)
+  , m_fetchDoneCb(nullptr)
+  , m_host(nullptr)
+  , m_port(80)
+  , m_requestLength(0)
+  , m_requestSent(0)
+  , m_headerLineLength(0)
+  , m_statusLineParsed(false)
+  , m_httpCode(0)
+  , m_retryAfter(0)
+  , m_bufferHead(0)
+  , m_bufferTail(0)
+  , m_bufferUsed(0)
+  , m_dnsDone(false)
+  , m_dnsFailed(false)
+  , m_connected(false)
+  , m_disconnected(false)
+  , m_overflow(false)
+  , m_startTime(0)
+  , m_maxSliceTime(0)
+  {
+    m_client.onConnect([](void* arg, AsyncClient* client) {
+      static_cast<CWeatherFetcher*>(arg)->m_connected = true;
+    }, this);
+
+    m_client.onDisconnect([](void* arg, AsyncClient* client) {
+      static_cast<CWeatherFetcher*>(arg)->m_disconnected = true;
+    }, this);
+
+    m_client.onError([](void* arg, AsyncClient* client, int8_t error) {
+      DEBUG_LOG(F("[WeatherFetcher] TCP error: "));
+      DEBUG_LOG_LN(client->errorToString(error));
+      static_cast<CWeatherFetcher*>(arg)->m_disconnected = true;
+    }, this);
+
+    m_client.onTimeout([](void* arg, AsyncClient* client, uint32_t time) {
+      DEBUG_LOG_LN(F("[WeatherFetcher] RX timeout"));
+      client->close(true);
+    }, this);
+
+    m_client.onData([](void* arg, AsyncClient* client, void* data, size_t length) {
+      // Window is reopened only once Run() has parsed the data
+      client->ackLater();
+      static_cast<CWeatherFetcher*>(arg)->OnData(static_cast<const uint8_t*>(data), length);
+    }, this);
+  }
+
+bool CWeatherFetcher::Start(const char* host, uint16_t port, const char* path, SOneCallForecast* forecast)
+{
+  if(IsBusy())
+  {
+    DEBUG_LOG_LN(F("[WeatherFetcher] Fetch already in progress"));
+    return false;
+  }
+
+  const int requestLength = snprintf_P(m_request, sizeof(m_request), requestTemplate, path, host);
+  if(requestLength <= 0 || requestLength >= static_cast<int>(sizeof(m_request)))
+  {
+    DEBUG_LOG_LN(F("[WeatherFetcher] Request doesn't fit the buffer"));
+    return false;
+  }
+
+  m_host          = host;
+  m_port          = port;
+  m_forecast      = forecast;
+  m_requestLength = requestLength;
+  m_requestSent   = 0;
+
+  m_headerLineLength = 0;
+  m_statusLineParsed = false;
+  m_httpCode         = 0;
+  m_retryAfter       = 0;
+
+  m_bufferHead = 0;
+  m_bufferTail = 0;
+  m_bufferUsed = 0;
+
+  m_dnsDone      = false;
+  m_dnsFailed    = false;
+  m_connected    = false;
+  m_disconnected = false;
+  m_overflow     = false;
+
+  m_parser.Reset(m_forecast);
+
+  m_startTime    = millis();
+  m_maxSliceTime = 0;
+
+  ip_addr_t resolved;
+  const err_t err = dns_gethostbyname(m_host, &resolved, &CWeatherFetcher::DnsFoundCb, this);
+  if(err == ERR_OK)
+  {
+    m_address = IPAddress(&resolved);
+    m_dnsDone = true;
+  }
+  else if(err != ERR_INPROGRESS)
+  {
+    m_dnsFailed = true;
+    m_dnsDone = true;
+  }
+
+  m_state = FETCH_RESOLVING;
+
+  return true;
+}
+
+void CWeatherFetcher::Run()
+{
+  if(m_state == FETCH_IDLE)
+  {
+    return;
+  }
+
+  const unsigned long sliceStart = micros();
+
+  if(millis() - m_startTime > WEATHER_FETCH_TIMEOUT)
+  {
+    DEBUG_LOG(F("[WeatherFetcher] Timed out in state: "));
+    DEBUG_LOG_LN(m_state);
+    Finish(FETCH_ERROR_TIMEOUT);
+  }
+  else
+  {
+    switch(m_state)
+    {
+    case FETCH_RESOLVING:
+      RunResolving();
+      break;
+
+    case FETCH_CONNECTING:
+      RunConnecting();
+      break;
+
+    case FETCH_SENDING:
+      RunSending();
+      break;
+
+    case FETCH_HEADERS:
+    case FETCH_BODY:
+      RunReceiving();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  const unsigned long sliceTime = micros() - sliceStart;
+  m_maxSliceTime = sliceTime > m_maxSliceTime ? sliceTime : m_maxSliceTime;
+}
+
+void CWeatherFetcher::DnsFoundCb(const char* name, const ip_addr_t* ipaddr, void* arg)
+{
+  CWeatherFetcher* fetcher = static_cast<CWeatherFetcher*>(arg);
+  if(fetcher->m_state != FETCH_RESOLVING)
+  {
+    return;
+  }
+
+  if(ipaddr)
+  {
+    fetcher->m_address = IPAddress(ipaddr);
+  }
+  else
+  {
+    fetcher->m_dnsFailed = true;
+  }
+  fetcher->m_dnsDone = true;
+}
+
+void CWeatherFetcher::OnData(const uint8_t* data, size_t length)
+{
+  if(length > WEATHER_FETCH_BUFFER_SIZE - m_bufferUsed)
+  {
+    m_overflow = true;
+    return;
+  }
+
+  for(size_t index = 0; index < length; ++index)
+  {
+    m_buffer[m_bufferHead] = data[index];
+    m_bufferHead = m_bufferHead + 1 == WEATHER_FETCH_BUFFER_SIZE ? 0 : m_bufferHead + 1;
+  }
+  m_bufferUsed += length;
+}
+
+void CWeatherFetcher::RunResolving()
+{
+  if(!m_dnsDone)
+  {
+    return;
+  }
+
+  if(m_dnsFailed)
+  {
+    DEBUG_LOG(F("[WeatherFetcher] DNS failed for "));
+    DEBUG_LOG_LN(m_host);
+    Finish(FETCH_ERROR_DNS);
+    return;
+  }
+
+  m_client.setRxTimeout(WEATHER_FETCH_RX_TIMEOUT_SEC);
+  if(!m_client.connect(m_address, m_port))
+  {
+    DEBUG_LOG_LN(F("[WeatherFetcher] Connect failed"));
+    Finish(FETCH_ERROR_CONNECT);
+    return;
+  }
+
+  m_state = FETCH_CONNECTING;
+}
+
+void CWeatherFetcher::RunConnecting()
+{
+  if(m_connected)
+  {
+    m_state = FETCH_SENDING;
+  }
+  else if(m_disconnected)
+  {
+    DEBUG_LOG_LN(F("[WeatherFetcher] Connection refused"));
+    Finish(FETCH_ERROR_CONNECT);
+  }
+}
+
+void CWeatherFetcher::RunSending()
+{
+  if(m_disconnected)
+  {
+    Finish(FETCH_ERROR_CONNECT);
+    return;
+  }
+
+  if(!m_client.canSend())
+  {
+    return;
+  }
+
+  m_requestSent += m_client.write(m_request + m_requestSent, m_requestLength - m_requestSent);
+  if(m_requestSent == m_requestLength)
+  {
+    m_state = FETCH_HEADERS;
+  }
+}
+
+void CWeatherFetcher::RunReceiving()
+{
+  if(m_overflow)
+  {
+    DEBUG_LOG_LN(F("[WeatherFetcher] Receive buffer overflow"));
+    Finish(FETCH_ERROR_TRUNCATED);
+    return;
+  }
+
+  size_t consumed = 0;
+  while(consumed < WEATHER_FETCH_SLICE_SIZE && m_bufferUsed > 0 && m_state != FETCH_IDLE)
+  {
+    if(m_state == FETCH_HEADERS)
+    {
+      const char c = m_buffer[m_bufferTail];
+      ConsumeBuffer(1);
+      ++consumed;
+
+      if(!ProcessHeaderChar(c))
+      {
+        Finish(ClassifyHttpCode(m_httpCode));
+      }
+      continue;
+    }
+
+    // Contiguous part of the ring buffer, limited by what's left of the slice
+    size_t length = WEATHER_FETCH_BUFFER_SIZE - m_bufferTail;
+    length = length < m_bufferUsed ? length : m_bufferUsed;
+    length = length < WEATHER_FETCH_SLICE_SIZE - consumed ? length : WEATHER_FETCH_SLICE_SIZE - consumed;
+
+    const size_t parsed = m_parser.Feed(reinterpret_cast<const char*>(m_buffer + m_bufferTail), length);
+    ConsumeBuffer(parsed);
+    consumed += parsed;
+
+    if(m_parser.HasError())
+    {
+      Finish(FETCH_ERROR_PARSE);
+    }
+    else if(m_parser.IsDone())
+    {
+      // Everything needed is here, the rest of the body is dropped with the connection
+      Finish(FETCH_ERROR_NONE);
+    }
+  }
+
+  if(m_state == FETCH_IDLE)
+  {
+    return;
+  }
+
+  m_client.ack(consumed);
+
+  if(m_bufferUsed == 0 && m_disconnected)
+  {
+    DEBUG_LOG_LN(F("[WeatherFetcher] Connection closed before the forecast was complete"));
+
+    // An error response cut short in its headers still says what went wrong,
+    // only a 200 or a missing status line leave nothing but the truncation
+    const bool errorStatus = m_state == FETCH_HEADERS && m_statusLineParsed && m_httpCode != 200;
+    Finish(errorStatus ? ClassifyHttpCode(m_httpCode) : FETCH_ERROR_TRUNCATED);
+  }
+}
+
+void CWeatherFetcher::ConsumeBuffer(size_t length)
+{
+  m_bufferTail = (m_bufferTail + length) % WEATHER_FETCH_BUFFER_SIZE;
+  m_bufferUsed -= length;
+}
+
+bool CWeatherFetcher::ProcessHeaderChar(char c)
+{
+  if(c == '\r')
+  {
+    return true;
+  }
+
+  if(c != '\n')
+  {
+    if(m_headerLineLength < WEATHER_FETCH_HEADER_LINE_SIZE - 1)
+    {
+      m_headerLine[m_headerLineLength++] = c;
+    }
+    return true;
+  }
+
+  m_headerLine[m_headerLineLength] = '\0';
+
+  if(!m_statusLineParsed)
+  {
+    // "HTTP/1.1 200 OK"
+    const char* code = strchr(m_headerLine, ' ');
+    m_httpCode = code ? atoi(code + 1) : 0;
+    m_statusLineParsed = true;
+
+    DEBUG_LOG(F("[WeatherFetcher] HTTP code: "));
+    DEBUG_LOG_LN(m_httpCode);
+  }
+  else if(m_headerLineLength == 0)
+  {
+    // Headers of an error response are still read through for Retry-After
+    if(m_httpCode != 200)
+    {
+      return false;
+    }
+    m_state = FETCH_BODY;
+  }
+  else
+  {
+    ProcessHeaderLine();
+  }
+
+  m_headerLineLength = 0;
+  return true;
+}
+
+void CWeatherFetcher::ProcessHeaderLine()
+{
+  const size_t nameLength = strlen_P(headerRetryAfter);
+  if(strncasecmp_P(m_headerLine, headerRetryAfter, nameLength) != 0)
+  {
+    return;
+  }
+
+  // Only the delta-seconds form is supported, an HTTP-date leaves the backoff to the caller
+  const char* value = m_headerLine + nameLength;
+  while(*value == ' ')
+  {
+    ++value;
+  }
+
+  if(isdigit(*value))
+  {
+    const unsigned long retryAfter = strtoul(value, nullptr, 10);
+    m_retryAfter = retryAfter < WEATHER_FETCH_RETRY_AFTER_MAX_SEC ? retryAfter : WEATHER_FETCH_RETRY_AFTER_MAX_SEC;
+
+    DEBUG_LOG(F("[WeatherFetcher] Retry-After: "));
+    DEBUG_LOG_LN(m_retryAfter);
+  }
+}
+
+EFetchError CWeatherFetcher::ClassifyHttpCode(int httpCode)
+{
+  if(httpCode == 200)
+  {
+    return FETCH_ERROR_NONE;
+  }
+  else if(httpCode == 401)
+  {
+    return FETCH_ERROR_HTTP_UNAUTHORIZED;
+  }
+  else if(httpCode == 429)
+  {
+    return FETCH_ERROR_HTTP_RATE_LIMITED;
+  }
+  else if(httpCode >= 500 && httpCode < 600)
+  {
+    return FETCH_ERROR_HTTP_SERVER;
+  }
+
+  return FETCH_ERROR_HTTP_OTHER;
+}
+
+void CWeatherFetcher::Finish(EFetchError error)
+{
+  m_state = FETCH_IDLE;
+
+  if(m_client.connected() || m_client.connecting())
+  {
+    m_client.close(true);
+  }
+
+  DEBUG_LOG(F("[WeatherFetcher] Done in ms: "));
+  DEBUG_LOG(millis() - m_startTime);
+  DEBUG_LOG(F(", longest slice us: "));
+  DEBUG_LOG(m_maxSliceTime);
+  DEBUG_LOG(F(", error: "));
+  DEBUG_LOG_LN(FetchErrorToString(error));
+
+  if(m_fetchDoneCb)
+  {
+    m_fetchDoneCb(error, m_httpCode);
+  }
+}
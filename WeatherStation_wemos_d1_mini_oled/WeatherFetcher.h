@@ -0,0 +1,139 @@
+#ifndef _WEATHERFETCHER_H
+#define _WEATHERFETCHER_H
+
+#include <Arduino.h>
+#include <ESPAsyncTCP.h>
+
+extern "C" {
+  #include <lwip/dns.h>
+  #include <lwip/tcp.h>
+}
+
+#include "OneCallParser.h"
+#include "DebugHelpers.h"
+
+///////////////// DEFINES
+#define WEATHER_FETCH_TIMEOUT 1000 * 20
+#define WEATHER_FETCH_RX_TIMEOUT_SEC 10
+
+// Receive buffer holds a full TCP window: data is only acknowledged after being parsed
+#define WEATHER_FETCH_BUFFER_SIZE TCP_WND
+// Bytes parsed per Run() call, bounds the time spent in a single loop() iteration
+#define WEATHER_FETCH_SLICE_SIZE 256
+
+#define WEATHER_FETCH_REQUEST_SIZE 320
+#define WEATHER_FETCH_HEADER_LINE_SIZE 64
+
+// Upper bound for a server provided Retry-After, guards against nonsense values
+#define WEATHER_FETCH_RETRY_AFTER_MAX_SEC 60UL * 60 * 24
+
+///////////////// CODE
+enum EFetchState : uint8_t
+{
+  FETCH_IDLE = 0,
+  FETCH_RESOLVING,
+  FETCH_CONNECTING,
+  FETCH_SENDING,
+  FETCH_HEADERS,
+  FETCH_BODY
+};
+
+enum EFetchError : uint8_t
+{
+  FETCH_ERROR_NONE = 0,
+  FETCH_ERROR_DNS,
+  FETCH_ERROR_CONNECT,
+  FETCH_ERROR_HTTP_UNAUTHORIZED,  // 401, wrong or blocked API key
+  FETCH_ERROR_HTTP_RATE_LIMITED,  // 429, may come with Retry-After
+  FETCH_ERROR_HTTP_SERVER,        // 5xx
+  FETCH_ERROR_HTTP_OTHER,
+  // Connection closed or receive buffer overrun before the forecast was
+  // complete. A close in the headers of a response with an error status is
+  // reported by that status instead, a 200 or an incomplete status line are
+  // reported as truncated.
+  FETCH_ERROR_TRUNCATED,
+  FETCH_ERROR_PARSE,
+  FETCH_ERROR_TIMEOUT,
+  FETCH_ERROR_REQUEST,            // Request couldn't be started at all
+
+  FETCH_ERROR_COUNT
+};
+
+const __FlashStringHelper* FetchErrorToString(EFetchError error);
+
+// Non-blocking OneCall request on top of ESPAsyncTCP. Start() only queues the
+// request, Run() has to be called from loop() and advances the fetch by one
+// bounded step (resolve, connect, send, receive/parse a slice) per call.
+class CWeatherFetcher
+{
+  public:
+    typedef void(*fetchDoneCb)(EFetchError error, int httpCode);
+
+    CWeatherFetcher();
+
+    bool Start(const char* host, uint16_t port, const char* path, SOneCallForecast* forecast);
+    void Run();
+
+    bool IsBusy() const { return m_state != FETCH_IDLE; }
+    EFetchState GetState() const { return m_state; }
+    unsigned long GetMaxSliceTime() const { return m_maxSliceTime; }
+    // Seconds from the Retry-After header of the last response, 0 if there was none
+    unsigned long GetRetryAfter() const { return m_retryAfter; }
+
+    void SetFetchDoneCb(fetchDoneCb callback) { m_fetchDoneCb = callback; }
+
+  private:
+    static void DnsFoundCb(const char* name, const ip_addr_t* ipaddr, void* arg);
+
+    void OnData(const uint8_t* data, size_t length);
+
+    void RunResolving();
+    void RunConnecting();
+    void RunSending();
+    void RunReceiving();
+
+    void ConsumeBuffer(size_t length);
+    bool ProcessHeaderChar(char c);
+    void ProcessHeaderLine();
+    void Finish(EFetchError error);
+
+    static EFetchError ClassifyHttpCode(int httpCode);
+
+  private:
+    AsyncClient m_client;
+    COneCallParser m_parser;
+    SOneCallForecast* m_forecast;
+
+    EFetchState m_state;
+    fetchDoneCb m_fetchDoneCb;
+
+    const char* m_host;
+    uint16_t m_port;
+    IPAddress m_address;
+
+    char m_request[WEATHER_FETCH_REQUEST_SIZE];
+    size_t m_requestLength;
+    size_t m_requestSent;
+
+    char m_headerLine[WEATHER_FETCH_HEADER_LINE_SIZE];
+    uint8_t m_headerLineLength;
+    bool m_statusLineParsed;
+    int m_httpCode;
+    unsigned long m_retryAfter;
+
+    uint8_t m_buffer[WEATHER_FETCH_BUFFER_SIZE];
+    size_t m_bufferHead;
+    size_t m_bufferTail;
+    size_t m_bufferUsed;
+
+    // Set from lwIP/ESPAsyncTCP callbacks, consumed by Run()
+    volatile bool m_dnsDone;
+    volatile bool m_dnsFailed;
+    volatile bool m_connected;
+    volatile bool m_disconnected;
+    volatile bool m_overflow;
+
+    unsigned long m_startTime;
+    unsigned long m_maxSliceTime;
+};
+#endif
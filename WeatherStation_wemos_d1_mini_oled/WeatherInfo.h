@@ -0,0 +1,51 @@
+#ifndef _WEATHERINFO_H
+#define _WEATHERINFO_H
+
+#include <Arduino.h>
+
+///////////////// DEFINES
+#define PROBABILITY_OF_PERCEPTION_MAX_COUNT 16
+
+#define FORECAST_TIMELINE_MAX_COUNT 48
+
+///////////////// CODE
+// What the weather screen shows for the current hour
+struct SWeatherInfo
+{
+  SWeatherInfo()
+    : m_weatherId(0)
+    , m_popCount(0)
+    , m_currentTemp(0)
+    , m_eveningTemp(0)
+    , m_minTemp(0)
+    , m_maxTemp(0)
+    , m_pop()
+    {
+    }
+
+  uint16_t m_weatherId : 10;  // OpenWeatherMap condition codes are 200..804
+  uint16_t m_popCount : 6;
+  int16_t m_currentTemp;
+  int16_t m_eveningTemp;
+  int16_t m_minTemp;
+  int16_t m_maxTemp;
+  uint8_t m_pop[PROBABILITY_OF_PERCEPTION_MAX_COUNT];  // Percent
+};
+
+struct SForecastHour
+{
+  uint16_t m_weatherId;
+  int16_t m_feelsLike;  // Rounded
+  uint8_t m_pop;        // Percent
+};
+
+// Compact copy of the hourly forecast, entries are one hour apart starting at
+// m_firstDt. Kept small: it's what gets stored in RTC memory and flash by CWeatherCache
+struct SForecastTimeline
+{
+  uint32_t m_firstDt = 0;
+  int32_t m_timezoneOffset = 0;
+  uint8_t m_count = 0;
+  SForecastHour m_hours[FORECAST_TIMELINE_MAX_COUNT];
+};
+#endif
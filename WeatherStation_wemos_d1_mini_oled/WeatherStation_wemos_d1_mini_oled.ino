@@ -1,18 +1,24 @@
 // Main libs
 #include <ESP8266WiFi.h>
-#include <ESP8266HTTPClient.h>
 #include <ArduinoJson.h>
 #include <WiFiClient.h>
 #include <NTPClient.h>
 #include <WiFiUdp.h>
-#include <RTClib.h>
 #include <Array.h>
 #include <MillisTimer.h>
 
 #include <FS.h>
+#include "DeviceConfig.h"
 #include "ConfigHTMLPage.h"
 
 #include "WeatherDisplay.h"
+#include "OneCallParser.h"
+#include "ForecastDigest.h"
+#include "WeatherCache.h"
+#include "WeatherFetcher.h"
+#include "RetryScheduler.h"
+#include "WorkQueue.h"
+#include "Snapshot.h"
 #include "DebugHelpers.h"
 
 ///////////////// DEFINES
@@ -25,16 +31,17 @@
 #define CHECK_CONNECTION_TIME_INTERVAL 1000 * 5
 
 #define CHECK_WEATHER_DECREASED_DUE_TO_FAIL_INTERVAL CHECK_WEATHER_INTERVAL
+#define CHECK_WEATHER_MAX_RETRY_INTERVAL 1000 * 60 * 5
 #else // DEBUG
-#define CHECK_WEATHER_INTERVAL 1000 * 60 * 30
+// The display rolls over to the next hour from the cached timeline on its own
+#define CHECK_WEATHER_INTERVAL 1000 * 60 * 60
 #define CHECK_SLEEP_TIME_INTERVAL 1000 * 60 * 10
 #define CHECK_CONNECTION_TIME_INTERVAL 1000 * 60 * 1
 
 #define CHECK_WEATHER_DECREASED_DUE_TO_FAIL_INTERVAL 1000 * 60 * 5
+#define CHECK_WEATHER_MAX_RETRY_INTERVAL 1000 * 60 * 60 * 2
 #endif // not DEBUG
 
-#define DEVICE_NAME "WeatherStation_OLED_1"
-
 #ifdef WIFI_MANAGER
 #define AP_WIFI_CONFIG_NAME "WPConfig"
 #define STASSID WiFi.SSID()
@@ -43,14 +50,24 @@
 #define STAPSK "ssid_password"
 #endif // not WIFI_MANAGER
 
-const char* weatherRequestURL = "http://api.openweathermap.org/data/2.5/onecall?lat=%f&lon=%f&units=%s&exclude=current,minutely,daily,alerts&appid=%s";
+const char* weatherRequestHost = "api.openweathermap.org";
+const uint16_t weatherRequestPort = 80;
+const char* weatherRequestPath = "/data/2.5/onecall?lat=%f&lon=%f&units=%s&exclude=current,minutely,daily,alerts&appid=%s";
 
-#define EVENING_TIME 18
-#define MORNING_TIME 7
+// Weather checks are paused during do not disturb, the last one runs this
+// long before it ends so the screen wakes up with a fresh forecast
+#define WEATHER_PREFETCH_BEFORE_DND_END 1000UL * 60 * 10
 
-#define PROBABILITY_OF_PERCEPTION_MAX_COUNT 16
+// How often the connection is polled while the WiFi animation runs
+#define WIFI_CONNECT_POLL_INTERVAL 20
 
-#define WEATHER_CONDITIONS_COUNT_MAX (int8_t)3
+// Configuration changes in a row only refresh the weather once they settle
+#define WORK_REFRESH_WEATHER_DELAY 2000
+// Lets the response of /restartdevice and /resetdevice reach the browser
+#define WORK_RESTART_DELAY 500
+
+#define EVENING_TIME 18
+#define MORNING_TIME 7
 
 ///////////////// GLOBALS
 #if defined(OTA) || defined(WIFI_MANAGER)
@@ -68,17 +85,28 @@ AsyncWebServer webServer(80);
 #include "src/ESPConnect/ESPConnect.h"
 #endif // WIFI_MANAGER
 
-StaticJsonDocument<22000> jsonResponse;
-StaticJsonDocument<500> deviceConfiguration;
-bool configurationUpdated = false;
+SOneCallForecast weatherForecast;
+CWeatherFetcher weatherFetcher;
+CRetryScheduler weatherRetryScheduler(CHECK_WEATHER_INTERVAL, CHECK_WEATHER_DECREASED_DUE_TO_FAIL_INTERVAL, CHECK_WEATHER_MAX_RETRY_INTERVAL);
+CDeviceConfig deviceConfig;
+// Generation of deviceConfig the device runs with
+uint32_t appliedConfigGeneration = 0;
+
+CWorkQueue workQueue;
+// Published by the web handlers, saved by JOB_SAVE_CONFIG from loop()
+CSnapshot<SDeviceConfig> pendingConfig;
 
 CWeatherDisplay weatherDisplay;
+CWeatherCache weatherCache;
+bool cachedWeatherShown = false;
 
 MillisTimer connectionCheckTimer  = MillisTimer(CHECK_CONNECTION_TIME_INTERVAL);
 MillisTimer weatherCheckTimer     = MillisTimer(CHECK_WEATHER_INTERVAL);
 MillisTimer sleepTimeCheckTimer   = MillisTimer(CHECK_SLEEP_TIME_INTERVAL);
 
-bool doNotDisturb = false;
+// Set by loop(), /telemetry reads it
+std::atomic<bool> doNotDisturb(false);
+bool weatherCheckPausedForDoNotDisturb = false;
 bool lastRequestEndedWithError = false;
 
 bool ntpFirstRun = true;
@@ -101,18 +129,20 @@ struct SEspTelemetry
   IPAddress ipAdressObtained;
   unsigned long totalWeatherRequestsFromFirstStart = 0;
   unsigned long totalWeatherRequestsFailed = 0; 
+  unsigned long maxLoopTimeDuringFetchUs = 0;
+  unsigned long maxFetchSliceUs = 0;
+  unsigned long configPageRequests = 0;
+  unsigned long configPageNotModified = 0;
+  // Longest time and lowest free heap while / and /api/config are answered,
+  // the heap is read with the response built. /exportconfig goes into the
+  // /api/config heap as well.
+  unsigned long configPageMaxUs = 0;
+  uint32_t configPageMinFreeHeap = UINT32_MAX;
+  unsigned long apiConfigMaxUs = 0;
+  uint32_t apiConfigMinFreeHeap = UINT32_MAX;
 } espTelemetry;
 #endif // TELEMETRY
 
-static const unsigned int weatherTypeWorstness[] PROGMEM = {
-  202, 212, 232, 201, 200, 231, 230, 221, 211, 210,
-  314, 302, 312, 313, 311, 321, 310, 301, 300,
-  504, 503, 511, 502, 522, 501, 531, 521, 520, 500,
-  622, 616, 621, 620, 615, 613, 612, 602, 611, 601, 600,
-  701, 711, 721, 731, 741, 751, 761, 752, 771, 781,
-  804, 803, 802, 801, 800
-};
-
 ///////////////// FORWARD DECLARATIONS
 #ifdef WIFI_MANAGER
 void UpdateWiFiStatusAnimationCb();
@@ -121,8 +151,14 @@ void WiFiStatusFailCb();
 
 void CheckConnection(MillisTimer &mt);
 void CheckWeather(MillisTimer &mt);
+void OnWeatherFetched(EFetchError error, int httpCode);
+void ScheduleWeatherCheck(unsigned long interval);
+unsigned long GetDoNotDisturbRemainingTime();
 void CheckSleepTime(MillisTimer &mt);
-unsigned int WorstWeatherCase(const Array<unsigned int, WEATHER_CONDITIONS_COUNT_MAX>& weatherArray);
+void ShowCachedWeather();
+void ApplyPageIntervals();
+void FillDeviceStatus(SDeviceStatus& status);
+bool RunJob(EWorkJob job);
 #ifdef TELEMETRY
 String GetTelemetry();
 void MonitorSerialCommunication();
@@ -136,146 +172,116 @@ void notFound(AsyncWebServerRequest *request) {
 
 void ApplyConfigurataion()
 {
+    const SDeviceConfig config = deviceConfig.Get();
+    appliedConfigGeneration = deviceConfig.GetGeneration();
+
     // Will apply after restart. Do you wish to restart?
-    WiFi.hostname(deviceConfiguration[0][PARAM_WIFINAME].as<String>());
-    weatherDisplay.EnableOLEDProtection(deviceConfiguration[0][PARAM_SCREENSAVER].as<bool>(), deviceConfiguration[0][PARAM_SCREENSAVERTIME].as<int>(), deviceConfiguration[0][PARAM_SCREENSAVERTIMEOFF].as<int>());
+    WiFi.hostname(config.m_wifiName);
+    weatherDisplay.EnableOLEDProtection(config.m_screenSaver, config.m_screenSaverTime, config.m_screenSaverTimeOff);
     CheckSleepTime(sleepTimeCheckTimer);
-    weatherDisplay.SetCelsiusSign(deviceConfiguration[0][PARAM_CELSIUSSIGN].as<bool>() && deviceConfiguration[0][PARAM_CELSIUS].as<bool>());
-    weatherDisplay.SetDisplayRotation(deviceConfiguration[0][PARAM_ROTATEDISPLAY].as<bool>());
-    CheckWeather(weatherCheckTimer); 
+    weatherDisplay.SetCelsiusSign(config.m_celsiusSign && config.m_celsius);
+    weatherDisplay.SetDisplayRotation(config.m_rotateDisplay);
+    ApplyPageIntervals();
+    workQueue.Post(JOB_REFRESH_WEATHER, WORK_REFRESH_WEATHER_DELAY);
 }
 
-void ReadConfigurationFile()
+void ApplyPageIntervals()
 {
-  DEBUG_LOG_LN(F("ReadConfigurationFile()"));
-  if(!configurationUpdated)
+  const SDeviceConfig config = deviceConfig.Get();
+  for(uint8_t page = 0; page < DISPLAY_PAGE_COUNT; ++page)
   {
-    configurationUpdated = false;
-    DEBUG_LOG_LN(F("Open configuration file"));
-    File configuration = SPIFFS.open("/configuration.json", "r");
-    if(configuration && configuration.size()) 
-    {
-      JsonArray jsonArray = deviceConfiguration.to<JsonArray>();
-      DeserializationError err = deserializeJson(deviceConfiguration, configuration);
-      DEBUG_LOG_LN(configuration);
-      if (err) {
-        DEBUG_LOG(F("deserializeJson() failed with code "));
-        DEBUG_LOG_LN(err.c_str());
-      }
-
-      DEBUG_LOG_LN("Read configuration file successfully.");
-      configuration.close();
-    }
-    else
-    {
-      DEBUG_LOG_LN("Failed to read file.");
-    }
-  }  
+    weatherDisplay.SetPageInterval(static_cast<EDisplayPage>(page), config.m_pageIntervals[page]);
+  }
 }
 
-// Replaces placeholder with stored values
-String processor(const String& var){
-  ReadConfigurationFile();
+void FillDeviceStatus(SDeviceStatus& status)
+{
+  status.m_ip = WiFi.localIP();
+  status.m_rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+  status.m_freeHeap = ESP.getFreeHeap();
+}
 
-  if(var == PARAM_WIFINAME)
-  {
-    return deviceConfiguration[0][PARAM_WIFINAME].as<String>();
-  }
-  else if (var == PARAM_COORDINATES)
-  {
-    return String(deviceConfiguration[0][PARAM_LAT].as<String>() + ", " + deviceConfiguration[0][PARAM_LON].as<String>());
-  }
-  else if (var == PARAM_LAT)
-  {
-    return deviceConfiguration[0][PARAM_LAT].as<String>();
-  }
-  else if (var == PARAM_LON)
-  {
-    return deviceConfiguration[0][PARAM_LON].as<String>();
-  }
-  else if (var == PARAM_SCREENSAVER)
-  {
-      if(deviceConfiguration[0][PARAM_SCREENSAVER].as<bool>())
-      {
-        return String(F("checked"));
-      }
-      else
-      {
-        return String();
-      }
-  }
-  else if (var == PARAM_SCREENSAVERTIME)
-  {
-    return String(static_cast<int>(deviceConfiguration[0][PARAM_SCREENSAVERTIME].as<int>()/1000/60));
-  }
-  else if (var == PARAM_SCREENSAVERTIMEOFF)
-  {
-    return String(static_cast<int>(deviceConfiguration[0][PARAM_SCREENSAVERTIMEOFF].as<int>()/1000));
-  }
-  else if (var == PARAM_DNDMODE)
-  {
-      if(deviceConfiguration[0][PARAM_DNDMODE].as<bool>())
-      {
-        return String(F("checked"));
-      }
-      else
-      {
-        return String();
-      }
-  }
-  else if (var == PARAM_DNDFROM)
+bool RunJob(EWorkJob job)
+{
+  switch(job)
   {
-    return deviceConfiguration[0][PARAM_DNDFROM].as<String>();
+    case JOB_SAVE_CONFIG:
+      // loop() applies it once it sees the new generation
+      return deviceConfig.Save(pendingConfig.Read());
+    case JOB_REFRESH_WEATHER:
+      CheckWeather(weatherCheckTimer);
+      return true;
+    case JOB_RESTART:
+      ESP.restart();
+      return true;
+    case JOB_RESET:
+      deviceConfig.Erase();
+      //ESPConnect.erase();
+      WiFi.disconnect(true);
+      ESP.eraseConfig();
+      ESP.restart();
+      return true;
+    default:
+      return false;
   }
-  else if (var == PARAM_DNDTO)
+}
+
+// The configuration the next save starts from, includes one still queued
+SDeviceConfig GetLatestConfig()
+{
+  return workQueue.IsPending(JOB_SAVE_CONFIG) ? pendingConfig.Read() : deviceConfig.Get();
+}
+
+// Answer of the handlers that leave their work to loop()
+void SendJobAccepted(AsyncWebServerRequest *request, uint16_t id)
+{
+  if(!id)
   {
-    return deviceConfiguration[0][PARAM_DNDTO].as<String>();
+    request->send(503, "text/text", F("Busy"));
+    return;
   }
-  else if (var == PARAM_CELSIUS)
-  {
-      if(deviceConfiguration[0][PARAM_CELSIUS].as<bool>())
-      {
-        return String(F("checked"));
-      }
-      else
-      {
-        return String();
-      }
-  }
-  else if (var == PARAM_CELSIUSSIGN)
+
+  const String statusUrl = String(F("/api/job?id=")) + id;
+  AsyncWebServerResponse *response = request->beginResponse(202, F("application/json"), String(F("{\"id\":")) + id + F(",\"status\":\"") + statusUrl + F("\"}"));
+  response->addHeader(F("Location"), statusUrl);
+  request->send(response);
+}
+
+// Leaves saving newConfig to loop(). Posted first so that a full queue leaves
+// the pending configuration alone, the job can't run before the publish as
+// loop() doesn't preempt the handler.
+void PostConfigSave(AsyncWebServerRequest *request, const SDeviceConfig& newConfig)
+{
+  const uint16_t id = workQueue.Post(JOB_SAVE_CONFIG);
+  if(id)
   {
-      if(deviceConfiguration[0][PARAM_CELSIUSSIGN].as<bool>())
-      {
-        return String(F("checked"));
-      }
-      else
-      {
-        return String();
-      }
+    pendingConfig.Publish(newConfig);
   }
-  else if (var == PARAM_ROTATEDISPLAY)
-  {
-      if(deviceConfiguration[0][PARAM_ROTATEDISPLAY].as<bool>())
-      {
-        return String(F("checked"));
-      }
-      else
-      {
-        return String();
-      }
-  } 
-  else if (var == PARAM_APIKEY)
+  SendJobAccepted(request, id);
+}
+
+// Config page and /exportconfig
+void SendConfigJson(AsyncWebServerRequest *request, bool download)
+{
+  AsyncResponseStream *response = request->beginResponseStream(F("application/json"));
+  response->addHeader(F("Cache-Control"), F("no-store"));
+  if(download)
   {
-    return deviceConfiguration[0][PARAM_APIKEY].as<String>();
+    response->addHeader(F("Content-Disposition"), F("attachment; filename=\"configuration.json\""));
   }
+
+  DynamicJsonDocument document(DEVICE_CONFIG_JSON_SIZE);
+  JsonObject obj = document.to<JsonObject>();
+  deviceConfig.ToJson(obj);
 #ifdef TELEMETRY
-  else if (var == PARAM_TELEMETRY)
-  {
-    return String("<a style=\"text-decoration: none;\" href=\"/telemetry\"><button class=\"button buttonSmall\" style=\"margin: auto; display: flex;\" onclick=\"\">Telemetry</button></a>");
-  }
+  obj[PARAM_TELEMETRY] = true;
 #endif // TELEMETRY
 
-  return String();
+  serializeJson(document, *response);
+#ifdef TELEMETRY
+  espTelemetry.apiConfigMinFreeHeap = min(espTelemetry.apiConfigMinFreeHeap, ESP.getFreeHeap());
+#endif // TELEMETRY
+  request->send(response);
 }
 
 void setup() 
@@ -287,49 +293,17 @@ void setup()
   DEBUG_LOG_LN(ESP.getFreeHeap());
 
   SPIFFS.begin();
-  if(!SPIFFS.exists(F("/configuration.json")))
-  {
-    File configuration = SPIFFS.open(F("/configuration.json"), "w");
-
-    String jsonData;
-    JsonObject obj = deviceConfiguration.createNestedObject();
-    obj[PARAM_WIFINAME] = DEVICE_NAME;
-    obj[PARAM_LAT] = 0;
-    obj[PARAM_LON] = 0;
-    obj[PARAM_SCREENSAVER] = true;
-    obj[PARAM_SCREENSAVERTIME] = WEATHER_DISPLAY_OLED_START_REFRESH * 1000 * 60;
-    obj[PARAM_SCREENSAVERTIMEOFF] = WEATHER_DISPLAY_OLED_END_REFRESH * 1000;
-    obj[PARAM_DNDMODE] = true;
-    obj[PARAM_DNDFROM] = 23;
-    obj[PARAM_DNDTO] = 7;
-    obj[PARAM_CELSIUS] = true;
-    obj[PARAM_CELSIUSSIGN] = true;
-    obj[PARAM_ROTATEDISPLAY] = false;
-    obj[PARAM_APIKEY] = "XXXXXXXXXXXXXXXXXXXXXXXXXX";
-    serializeJson(deviceConfiguration, jsonData);
-  
-    DEBUG_LOG_LN(jsonData.c_str());
-    
-    const int bytesWritten = configuration.print(jsonData.c_str());
-    if (bytesWritten > 0) 
-    {
-      configurationUpdated = true;
-      DEBUG_LOG(F("File was written "));
-      DEBUG_LOG_LN(bytesWritten);
-     
-    } else 
-    {
-        DEBUG_LOG_LN(F("File write failed"));
-    }
-    
-    configuration.close();
-  }
-  else
-  {
-    ReadConfigurationFile();
-  }
+  deviceConfig.Begin();
+  appliedConfigGeneration = deviceConfig.GetGeneration();
+  const SDeviceConfig config = deviceConfig.Get();
 
   weatherDisplay.Begin();
+  weatherDisplay.SetCelsiusSign(config.m_celsiusSign && config.m_celsius);
+  weatherDisplay.SetDisplayRotation(config.m_rotateDisplay);
+  weatherDisplay.SetDeviceStatusCb(FillDeviceStatus);
+  ApplyPageIntervals();
+
+  ShowCachedWeather();
   
   // Start connection to WiFi network
   DEBUG_LOG_LN(F("Initialization strarted"));
@@ -338,7 +312,7 @@ void setup()
   DEBUG_LOG(F("Connecting to "));
   DEBUG_LOG_LN(STASSID);
 
-  WiFi.hostname(deviceConfiguration[0][PARAM_WIFINAME].as<String>());
+  WiFi.hostname(config.m_wifiName);
 
   #ifdef WIFI_MANAGER
   ESPConnect.SetWiFiStatusUpdateCb(UpdateWiFiStatusAnimationCb);
@@ -355,7 +329,15 @@ void setup()
   {
     DEBUG_LOG_LN("Connected to WiFi");
     DEBUG_LOG_LN("IPAddress: "+WiFi.localIP().toString());    
-    weatherDisplay.UpdateWiFiConnectedState(STASSID.c_str(), WiFi.localIP().toString());
+    if(cachedWeatherShown)
+    {
+      weatherDisplay.SetNoWifiConnectionMark(false);
+      weatherDisplay.UpdateDisplay();
+    }
+    else
+    {
+      weatherDisplay.UpdateWiFiConnectedState(STASSID.c_str(), WiFi.localIP().toString());
+    }
   }  
   #else // WIFI_MANAGER
   WiFi.mode(WIFI_STA);
@@ -363,207 +345,267 @@ void setup()
 
   weatherDisplay.ResetAnimationFrames();
   while (WiFi.status() != WL_CONNECTED) {
-    weatherDisplay.UpdateWiFiAnimation(STASSID.c_str());
-    delay(500);
-    DEBUG_LOG(F("."));
+    if(!cachedWeatherShown)
+    {
+      weatherDisplay.UpdateWiFiAnimation(STASSID.c_str());
+    }
+    delay(WIFI_CONNECT_POLL_INTERVAL);
+  }
+  if(cachedWeatherShown)
+  {
+    weatherDisplay.SetNoWifiConnectionMark(false);
+    weatherDisplay.UpdateDisplay();
+  }
+  else
+  {
+    weatherDisplay.UpdateWiFiConnectedState(STASSID.c_str(), WiFi.localIP().toString());
   }
-  weatherDisplay.UpdateWiFiConnectedState(STASSID.c_str(), WiFi.localIP().toString());
   #endif // not WIFI_MANAGER
   
-  weatherDisplay.EnableOLEDProtection(deviceConfiguration[0][PARAM_SCREENSAVER].as<bool>(), deviceConfiguration[0][PARAM_SCREENSAVERTIME].as<int>(), deviceConfiguration[0][PARAM_SCREENSAVERTIMEOFF].as<int>());
-  weatherDisplay.SetCelsiusSign(deviceConfiguration[0][PARAM_CELSIUSSIGN].as<bool>() && deviceConfiguration[0][PARAM_CELSIUS].as<bool>());
-
-  weatherDisplay.SetDisplayRotation(deviceConfiguration[0][PARAM_ROTATEDISPLAY].as<bool>());
+  weatherDisplay.EnableOLEDProtection(config.m_screenSaver, config.m_screenSaverTime, config.m_screenSaverTimeOff);
 
 // How long we'll display obtained IP adress
+  if(!cachedWeatherShown)
+  {
 #ifdef DEBUG
-  delay(1000);
+    delay(1000);
 #else // DEBUG
-  delay(10000);
+    delay(10000);
 #endif // not DEBUG
+  }
 
 
 
 #ifdef OTA
+  // Sent as it is stored, browsers revalidate it and mostly get a 304
   webServer.on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-    request->send_P(200, "text/html", config_html_page, processor);
+#ifdef TELEMETRY
+    const unsigned long start = micros();
+#endif // TELEMETRY
+    const bool notModified = request->hasHeader(F("If-None-Match")) && request->header(F("If-None-Match")) == CONFIG_HTML_ETAG;
+
+    AsyncWebServerResponse *response;
+    if(notModified)
+    {
+      response = request->beginResponse(304);
+    }
+    else
+    {
+      response = request->beginResponse_P(200, "text/html", CONFIG_HTML, CONFIG_HTML_SIZE);
+      response->addHeader(F("Content-Encoding"), F("gzip"));
+    }
+    response->addHeader(F("ETag"), F(CONFIG_HTML_ETAG));
+    response->addHeader(F("Cache-Control"), F("no-cache"));
+#ifdef TELEMETRY
+    espTelemetry.configPageMinFreeHeap = min(espTelemetry.configPageMinFreeHeap, ESP.getFreeHeap());
+#endif // TELEMETRY
+    request->send(response);
+
+#ifdef TELEMETRY
+    ++espTelemetry.configPageRequests;
+    espTelemetry.configPageNotModified += notModified ? 1 : 0;
+    espTelemetry.configPageMaxUs = max(espTelemetry.configPageMaxUs, micros() - start);
+#endif // TELEMETRY
+  });
+
+  webServer.on("/api/config", HTTP_GET, [](AsyncWebServerRequest *request){
+#ifdef TELEMETRY
+    const unsigned long start = micros();
+#endif // TELEMETRY
+    SendConfigJson(request, false);
+#ifdef TELEMETRY
+    espTelemetry.apiConfigMaxUs = max(espTelemetry.apiConfigMaxUs, micros() - start);
+#endif // TELEMETRY
   });
 
   webServer.on("/restartdevice", HTTP_GET, [](AsyncWebServerRequest *request){
-    request->send_P(200, "text/html", "Restarting...");
-    ESP.restart();
     // Reload page after 15 seconds? Progress Bar?
+    SendJobAccepted(request, workQueue.Post(JOB_RESTART, WORK_RESTART_DELAY));
   });
 
   webServer.on("/resetdevice", HTTP_GET, [](AsyncWebServerRequest *request){
-    String operationResult = F("Failed. Configuration wasn't wiped out. Restarting.");
-    if(SPIFFS.remove(F("/configuration.json")))
-    {
-      operationResult = F("Success. Device cleared. Restarting.");
-    }
-    request->send_P(200, "text/html", operationResult.c_str());
-    //ESPConnect.erase();
-    WiFi.disconnect(true);
-    ESP.eraseConfig();
-    ESP.restart();
     // Progress Bar?
+    SendJobAccepted(request, workQueue.Post(JOB_RESET, WORK_RESTART_DELAY));
+  });
+
+  webServer.on("/api/job", HTTP_GET, [](AsyncWebServerRequest *request){
+    const uint16_t id = request->hasParam(F("id")) ? request->getParam(F("id"))->value().toInt() : 0;
+    const EJobState state = workQueue.GetState(id);
+
+    String result = String(F("{\"id\":")) + id + F(",\"state\":\"") + JobStateToString(state) + F("\"}");
+    request->send(state == JOB_STATE_UNKNOWN ? 404 : 200, F("application/json"), result);
   });
 
 #ifdef TELEMETRY
   webServer.on("/telemetry", HTTP_GET, [](AsyncWebServerRequest *request) {
     request->send(200, F("text/plain"), GetTelemetry().c_str());
   });
+
+  // What the panel shows right now, open it with any PBM capable viewer
+  webServer.on("/screen.pbm", HTTP_GET, [](AsyncWebServerRequest *request) {
+    AsyncResponseStream *response = request->beginResponseStream(F("image/x-portable-bitmap"));
+    weatherDisplay.PrintScreenPbm(*response);
+    request->send(response);
+  });
 #endif // TELEMETRY
 
   webServer.on("/saveconfig", HTTP_GET, [] (AsyncWebServerRequest *request) {
-    String operationResult;
-    if(SPIFFS.exists(F("/configuration.json")))
+    // Whatever isn't received or doesn't pass the checks keeps its current value
+    SDeviceConfig newConfig = GetLatestConfig();
+
+    //
+    // CHECK DATA BEFORE SAVE!!!!
+    //
+    // Check received coordinates
+    DEBUG_LOG(F("Previous Coordinates: "));
+    DEBUG_LOG(newConfig.m_lat);
+    DEBUG_LOG(F(", "));
+    DEBUG_LOG_LN(newConfig.m_lon);
+    
+    if(request->hasParam(PARAM_COORDINATES))
     {
-      File configuration = SPIFFS.open(F("/configuration.json"), "w");
-
-      //
-      // CHECK DATA BEFORE SAVE!!!!
-      //
-      // Check received coordinates
-      float newLat = deviceConfiguration[0][PARAM_LAT].as<float>();
-      float newLon = deviceConfiguration[0][PARAM_LON].as<float>();
+      const String paramValue = request->getParam(PARAM_COORDINATES)->value();
       
-      DEBUG_LOG(F("Previous Coordinates: "));
-      DEBUG_LOG(newLat);
-      DEBUG_LOG(F(", "));
-      DEBUG_LOG_LN(newLon);
+      DEBUG_LOG(F("Received new coordinates: "));
+      DEBUG_LOG_LN(paramValue);
       
-      if(request->hasParam(PARAM_COORDINATES))
+      float latTemp = 0;
+      float lonTemp = 0;
+      const int delimiterPos = paramValue.indexOf(",");
+      
+      DEBUG_LOG(F("Delimiter position: "));
+      DEBUG_LOG_LN(delimiterPos);
+      
+      if(delimiterPos >= 0)
       {
-        const String paramValue = request->getParam(PARAM_COORDINATES)->value();
-        
-        DEBUG_LOG(F("Received new coordinates: "));
-        DEBUG_LOG_LN(paramValue);
-        
-        float latTemp = 0;
-        float lonTemp = 0;
-        const int delimiterPos = paramValue.indexOf(",");
-        
-        DEBUG_LOG(F("Delimiter position: "));
-        DEBUG_LOG_LN(delimiterPos);
-        
-        if(delimiterPos >= 0)
-        {
 
-          String latStr = paramValue.substring(0, delimiterPos);
-          latStr.trim();
-          latTemp = latStr.toFloat();
-
-          String lonStr = paramValue.substring(delimiterPos + 1, paramValue.length());
-          lonStr.trim();
-          lonTemp = lonStr.toFloat();
-
-          DEBUG_LOG(F("Transformed Coordinates: "));
-          DEBUG_LOG(latTemp);
-          DEBUG_LOG(F(", "));
-          DEBUG_LOG_LN(lonTemp);
-
-          if(latTemp > 0.f && lonTemp > 0.f)
-          {
-            newLat = latTemp;
-            newLon = lonTemp;
-          }
-          
-          DEBUG_LOG(F("New Coordinates: "));
-          DEBUG_LOG(newLat);
-          DEBUG_LOG(F(", "));
-          DEBUG_LOG_LN(newLon);
+        String latStr = paramValue.substring(0, delimiterPos);
+        latStr.trim();
+        latTemp = latStr.toFloat();
+
+        String lonStr = paramValue.substring(delimiterPos + 1, paramValue.length());
+        lonStr.trim();
+        lonTemp = lonStr.toFloat();
+
+        DEBUG_LOG(F("Transformed Coordinates: "));
+        DEBUG_LOG(latTemp);
+        DEBUG_LOG(F(", "));
+        DEBUG_LOG_LN(lonTemp);
+
+        if(latTemp > 0.f && lonTemp > 0.f)
+        {
+          newConfig.m_lat = latTemp;
+          newConfig.m_lon = lonTemp;
         }
+        
+        DEBUG_LOG(F("New Coordinates: "));
+        DEBUG_LOG(newConfig.m_lat);
+        DEBUG_LOG(F(", "));
+        DEBUG_LOG_LN(newConfig.m_lon);
       }
+    }
+
+    // Check Display off timer, the page has minutes and seconds
+    if(request->hasParam(PARAM_SCREENSAVERTIME) && request->getParam(PARAM_SCREENSAVERTIME)->value().toInt() > 0)
+    {
+      newConfig.m_screenSaverTime = request->getParam(PARAM_SCREENSAVERTIME)->value().toInt() * 1000 * 60;
+    }
 
-      // Check Display off timer
-      int newScreenSaverTime = deviceConfiguration[0][PARAM_SCREENSAVERTIME].as<int>();
-      if(request->hasParam(PARAM_SCREENSAVERTIME) && request->getParam(PARAM_SCREENSAVERTIME)->value().toInt() > 0)
+    if(request->hasParam(PARAM_SCREENSAVERTIMEOFF) && request->getParam(PARAM_SCREENSAVERTIMEOFF)->value().toInt() > 0)
+    {
+      newConfig.m_screenSaverTimeOff = request->getParam(PARAM_SCREENSAVERTIMEOFF)->value().toInt() * 1000;
+    }
+
+    // Check DND time
+    int newDNDTimeFrom = newConfig.m_dndFrom;
+    int newDNDTimeTo = newConfig.m_dndTo;
+     
+    if(request->hasParam(PARAM_DNDFROM))
+    {
+      const int receivedDNDTimeFrom = request->getParam(PARAM_DNDFROM)->value().toInt();
+      if(receivedDNDTimeFrom > 0 && receivedDNDTimeFrom <= 24)
       {
-        newScreenSaverTime = request->getParam(PARAM_SCREENSAVERTIME)->value().toInt();
+        newDNDTimeFrom = receivedDNDTimeFrom;
       }
-
-      int newScreenSaverTimeOff = deviceConfiguration[0][PARAM_SCREENSAVERTIMEOFF].as<int>();
-      if(request->hasParam(PARAM_SCREENSAVERTIME) && request->getParam(PARAM_SCREENSAVERTIMEOFF)->value().toInt() > 0)
+      else if(newDNDTimeTo == newDNDTimeFrom)
       {
-        newScreenSaverTimeOff = request->getParam(PARAM_SCREENSAVERTIMEOFF)->value().toInt();
+        newDNDTimeFrom = newDNDTimeFrom > 1 ? newDNDTimeFrom - 1 : 24;
       }
+    }
 
-      // Check DND time
-      int newDNDTimeFrom = deviceConfiguration[0][PARAM_DNDFROM].as<int>();
-      int newDNDTimeTo = deviceConfiguration[0][PARAM_DNDTO].as<int>();
-       
-      if(request->hasParam(PARAM_DNDFROM))
+    if(request->hasParam(PARAM_DNDTO))
+    {
+      const int receivedDNDTimeTo = request->getParam(PARAM_DNDTO)->value().toInt();
+      if(receivedDNDTimeTo > 0 && receivedDNDTimeTo <= 24 && newDNDTimeFrom != receivedDNDTimeTo)
       {
-        const int receivedDNDTimeFrom = request->getParam(PARAM_DNDFROM)->value().toInt();
-        if(receivedDNDTimeFrom > 0 && receivedDNDTimeFrom <= 24)
-        {
-          newDNDTimeFrom = receivedDNDTimeFrom;
-        }
-        else if(newDNDTimeTo == newDNDTimeFrom)
-        {
-          newDNDTimeFrom = --newDNDTimeFrom < 1 ? 24 : newDNDTimeFrom;
-        }
+        newDNDTimeTo = receivedDNDTimeTo;
       }
+      else if(newDNDTimeTo == newDNDTimeFrom)
+      {
+        newDNDTimeTo = newDNDTimeTo < 24 ? newDNDTimeTo + 1 : 1;
+      }
+    }
 
-      if(request->hasParam(PARAM_DNDTO))
+    newConfig.m_dndFrom = newDNDTimeFrom;
+    newConfig.m_dndTo = newDNDTimeTo;
+    
+    // Check page intervals
+    for(uint8_t page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+    {
+      if(request->hasParam(pageIntervalParams[page]))
       {
-        const int receivedDNDTimeTo = request->getParam(PARAM_DNDTO)->value().toInt();
-        if(receivedDNDTimeTo > 0 && receivedDNDTimeTo <= 24 && newDNDTimeFrom != receivedDNDTimeTo)
-        {
-          newDNDTimeTo = receivedDNDTimeTo;
-        }
-        else if(newDNDTimeTo == newDNDTimeFrom)
+        const int receivedInterval = request->getParam(pageIntervalParams[page])->value().toInt();
+        if(receivedInterval >= 0 && receivedInterval <= PAGE_MAX_INTERVAL)
         {
-          newDNDTimeTo = ++newDNDTimeTo > 24 ? 1 : newDNDTimeTo;
+          newConfig.m_pageIntervals[page] = receivedInterval;
         }
       }
-      
-      String jsonData;
-      deviceConfiguration.clear();
-      JsonObject obj = deviceConfiguration.createNestedObject();
-      obj[PARAM_WIFINAME] = request->hasParam(PARAM_WIFINAME) ? request->getParam(PARAM_WIFINAME)->value() : deviceConfiguration[0][PARAM_WIFINAME].as<String>();
-      obj[PARAM_LAT] = newLat;
-      obj[PARAM_LON] = newLon;
-      obj[PARAM_SCREENSAVER] = request->hasParam(PARAM_SCREENSAVER) ? true : false;
-      obj[PARAM_SCREENSAVERTIME] = newScreenSaverTime * 1000 * 60;
-      obj[PARAM_SCREENSAVERTIMEOFF] = newScreenSaverTimeOff * 1000;
-      obj[PARAM_DNDMODE] = request->hasParam(PARAM_DNDMODE) ? true : false;
-      obj[PARAM_DNDFROM] = newDNDTimeFrom;
-      obj[PARAM_DNDTO] = newDNDTimeTo;
-      obj[PARAM_CELSIUS] = request->hasParam(PARAM_CELSIUS) ? true : false;
-      obj[PARAM_CELSIUSSIGN] = request->hasParam(PARAM_CELSIUSSIGN) ? true : false;
-      obj[PARAM_ROTATEDISPLAY] = request->hasParam(PARAM_ROTATEDISPLAY) ? true : false;
-      obj[PARAM_APIKEY] = request->hasParam(PARAM_APIKEY) ? request->getParam(PARAM_APIKEY)->value() : deviceConfiguration[0][PARAM_APIKEY].as<String>();
-      serializeJson(deviceConfiguration, jsonData);
+    }
     
-      DEBUG_LOG_LN(jsonData.c_str());
-      
-      const int bytesWritten = configuration.print(jsonData.c_str());
-      if (bytesWritten > 0) 
-      {
-        configurationUpdated = true;
-        DEBUG_LOG_LN(F("File was written"));
-        DEBUG_LOG_LN(bytesWritten);
-        operationResult = F("Success");
-        configurationUpdated = true;
-      } else 
-      {
-          DEBUG_LOG_LN(F("File write failed"));
-          operationResult = F("Failed");
-      }
+    if(request->hasParam(PARAM_WIFINAME))
+    {
+      strlcpy(newConfig.m_wifiName, request->getParam(PARAM_WIFINAME)->value().c_str(), sizeof(newConfig.m_wifiName));
+    }
+    if(request->hasParam(PARAM_APIKEY))
+    {
+      strlcpy(newConfig.m_apiKey, request->getParam(PARAM_APIKEY)->value().c_str(), sizeof(newConfig.m_apiKey));
+    }
 
-      if(configurationUpdated)
-      {
-        ApplyConfigurataion();
-      }
-      
-      configuration.close();
+    // Unchecked boxes aren't sent at all
+    newConfig.m_screenSaver = request->hasParam(PARAM_SCREENSAVER);
+    newConfig.m_dndMode = request->hasParam(PARAM_DNDMODE);
+    newConfig.m_celsius = request->hasParam(PARAM_CELSIUS);
+    newConfig.m_celsiusSign = request->hasParam(PARAM_CELSIUSSIGN);
+    newConfig.m_rotateDisplay = request->hasParam(PARAM_ROTATEDISPLAY);
+
+    PostConfigSave(request, newConfig);
+  });
+
+  // Backup and restore of the whole configuration as JSON
+  webServer.on("/exportconfig", HTTP_GET, [](AsyncWebServerRequest *request) {
+    SendConfigJson(request, true);
+  });
+
+  webServer.on("/importconfig", HTTP_POST, [](AsyncWebServerRequest *request) {
+    // The body handler leaves the whole body in _tempObject, the request frees it
+    const char* json = static_cast<const char*>(request->_tempObject);
+    SDeviceConfig newConfig = GetLatestConfig();
+    if(!json || !CDeviceConfig::FromJson(json, strlen(json), newConfig))
+    {
+      request->send(400, "text/text", F("Failed"));
+      return;
     }
 
-    DEBUG_LOG(F("Configuration saved: "));
-    DEBUG_LOG_LN(operationResult);
-    request->send(200, "text/text", operationResult);
+    PostConfigSave(request, newConfig);
+  }, nullptr, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+    if(index == 0 && total < DEVICE_CONFIG_JSON_SIZE)
+    {
+      request->_tempObject = calloc(total + 1, 1);
+    }
+    if(request->_tempObject && index + len <= total)
+    {
+      memcpy(static_cast<uint8_t*>(request->_tempObject) + index, data, len);
+    }
   });
 
   webServer.onNotFound(notFound);
@@ -593,6 +635,11 @@ void setup()
   weatherCheckTimer.expiredHandler(CheckWeather);
   weatherCheckTimer.start();
 
+  weatherFetcher.SetFetchDoneCb(OnWeatherFetched);
+  workQueue.SetRunJobCb(RunJob);
+  // Chip id keeps the retry jitter apart between devices, the hardware RNG between boots
+  weatherRetryScheduler.SetSeed(ESP.getChipId() ^ ESP.random());
+
   sleepTimeCheckTimer.setInterval(CHECK_SLEEP_TIME_INTERVAL);
   sleepTimeCheckTimer.expiredHandler(CheckSleepTime);
   sleepTimeCheckTimer.start();
@@ -609,6 +656,11 @@ void setup()
 
 void loop() 
 {
+#ifdef TELEMETRY
+  const unsigned long loopStart = micros();
+  bool fetchInProgress = weatherFetcher.IsBusy();
+#endif // TELEMETRY
+
 #ifdef OTA
   AsyncElegantOTA.loop();
 #endif // OTA
@@ -619,21 +671,42 @@ void loop()
   weatherCheckTimer.run();
   sleepTimeCheckTimer.run();
 
+  weatherFetcher.Run();
+  workQueue.Run();
+
+  // Saved from a web request, applied here where the display and timers are ours
+  if(deviceConfig.GetGeneration() != appliedConfigGeneration)
+  {
+    ApplyConfigurataion();
+  }
+
+  weatherDisplay.SetLocalTime(timeClient.getEpochTime());
   weatherDisplay.UpdateDisplay();
 
 #ifdef TELEMETRY
   MonitorSerialCommunication();
+
+  fetchInProgress = fetchInProgress || weatherFetcher.IsBusy();
+  if(fetchInProgress)
+  {
+    espTelemetry.maxLoopTimeDuringFetchUs = max(espTelemetry.maxLoopTimeDuringFetchUs, micros() - loopStart);
+  }
 #endif // TELEMETRY
 }
 
 #ifdef WIFI_MANAGER
 void UpdateWiFiStatusAnimationCb()
 {
-  weatherDisplay.UpdateWiFiAnimation(STASSID.c_str());
+  // Keep the cached forecast on screen while connecting
+  if(!cachedWeatherShown)
+  {
+    weatherDisplay.UpdateWiFiAnimation(STASSID.c_str());
+  }
 }
 
 void WiFiStatusFailCb()
 {
+  cachedWeatherShown = false;
   weatherDisplay.DisplayWiFiConfigurationHelpText(AP_WIFI_CONFIG_NAME);
 }
 #endif // WIFI_MANAGER
@@ -653,6 +726,32 @@ void CheckConnection(MillisTimer &mt)
 
 void CheckWeather(MillisTimer &mt)
 {
+  if(weatherFetcher.IsBusy())
+  {
+    DEBUG_LOG_LN(F("Weather request already in progress"));
+    return;
+  }
+
+  if(doNotDisturb)
+  {
+    const unsigned long remaining = GetDoNotDisturbRemainingTime();
+    if(remaining > WEATHER_PREFETCH_BEFORE_DND_END)
+    {
+      DEBUG_LOG(F("Do not disturb, weather check postponed by ms: "));
+      DEBUG_LOG_LN(remaining - WEATHER_PREFETCH_BEFORE_DND_END);
+
+      weatherCheckPausedForDoNotDisturb = true;
+      ScheduleWeatherCheck(remaining - WEATHER_PREFETCH_BEFORE_DND_END);
+      return;
+    }
+  }
+
+  if(weatherCheckPausedForDoNotDisturb)
+  {
+    weatherCheckPausedForDoNotDisturb = false;
+    ScheduleWeatherCheck(weatherRetryScheduler.GetCurrentInterval());
+  }
+
 #ifdef TELEMETRY
   ++espTelemetry.totalWeatherRequestsFromFirstStart;
 #endif // TELEMETRY
@@ -660,174 +759,143 @@ void CheckWeather(MillisTimer &mt)
   DEBUG_LOG(F("Prepare request send Free heap: "));
   DEBUG_LOG_LN(ESP.getFreeHeap());
   
-  DEBUG_LOG_LN(F("Sending request"));
-  WiFiClient client;
-  HTTPClient http;
-
-  const float lat = deviceConfiguration[0][PARAM_LAT].as<float>();
-  const float lon = deviceConfiguration[0][PARAM_LON].as<float>();
-  const char* metric = deviceConfiguration[0][PARAM_CELSIUS].as<bool>() ? "metric" : "imperial";
-  const String apiKey = deviceConfiguration[0][PARAM_APIKEY].as<String>();
+  const SDeviceConfig config = deviceConfig.Get();
+  const char* metric = config.m_celsius ? "metric" : "imperial";
 
   char requestBuffer[200];
-  sprintf(requestBuffer, weatherRequestURL, lat, lon, metric, apiKey.c_str());
+  snprintf(requestBuffer, sizeof(requestBuffer), weatherRequestPath, config.m_lat, config.m_lon, metric, config.m_apiKey);
 
-  http.begin(client, requestBuffer);
+  DEBUG_LOG_LN(F("Sending request"));
   DEBUG_LOG_LN(requestBuffer);
-  int httpResponseCode = http.GET();
 
-  if (httpResponseCode == t_http_codes::HTTP_CODE_OK) 
+  if(!weatherFetcher.Start(weatherRequestHost, weatherRequestPort, requestBuffer, &weatherForecast))
   {
-    DEBUG_LOG(F("Request done Free heap: "));
-    DEBUG_LOG_LN(ESP.getFreeHeap());
-
-    const char* payload = http.getString().c_str();
-
-    // Deserialize the JSON document
-    DeserializationError error = deserializeJson(jsonResponse, payload);
+    OnWeatherFetched(FETCH_ERROR_REQUEST, 0);
+  }
+}
 
-    // Test if parsing succeeded.
-    if (error) 
-    {
-      DEBUG_LOG(F("deserializeJson() failed: "));
-      DEBUG_LOG_LN(error.f_str());
-      DEBUG_LOG_LN(payload);
+void OnWeatherFetched(EFetchError error, int httpCode)
+{
+  DEBUG_LOG(F("Request done Free heap: "));
+  DEBUG_LOG_LN(ESP.getFreeHeap());
 
 #ifdef TELEMETRY
-      ++espTelemetry.totalWeatherRequestsFailed;
+  espTelemetry.maxFetchSliceUs = max(espTelemetry.maxFetchSliceUs, weatherFetcher.GetMaxSliceTime());
 #endif // TELEMETRY
 
-      weatherCheckTimer.setInterval(CHECK_WEATHER_DECREASED_DUE_TO_FAIL_INTERVAL);
-      weatherCheckTimer.reset();
-      weatherCheckTimer.start();
-      
-      lastRequestEndedWithError = true;
-      weatherDisplay.SetErrorMark(true);
-      
-      return;
-    }
-
-    if(lastRequestEndedWithError)
-    {
-      weatherCheckTimer.setInterval(CHECK_WEATHER_INTERVAL);
-      weatherCheckTimer.reset();
-      weatherCheckTimer.start();
-      
-      lastRequestEndedWithError = false;
-      weatherDisplay.SetErrorMark(false);
-    }
-    
-    SWeatherInfo weatherInfo;
-
-    Array<unsigned int, WEATHER_CONDITIONS_COUNT_MAX> weatherConditions;
-
-    int dt = jsonResponse["list"][0]["dt"];
-    DEBUG_LOG(F("[dt="));
-    DEBUG_LOG(dt);
-    DEBUG_LOG_LN(F("]"));
-
-    // Prophet rain for icon
-    JsonArray arr = jsonResponse["hourly"];
-    for(JsonObject repo : arr)
-    {
-      const int weatherCode = repo["weather"][0]["id"];
-      
-      DEBUG_LOG(F("[weatherCode="));
-      DEBUG_LOG(weatherCode);
-      DEBUG_LOG(F("] "));
+  // Test if parsing succeeded.
+  if(error == FETCH_ERROR_NONE && weatherForecast.m_hourly.size() == 0)
+  {
+    error = FETCH_ERROR_PARSE;
+  }
 
-      weatherConditions.push_back(weatherCode);
-      if(weatherConditions.size() == WEATHER_CONDITIONS_COUNT_MAX)
-      {
-        break;
-      }
-    }
+  if(error != FETCH_ERROR_NONE)
+  {
+    DEBUG_LOG(F("Weather request failed: "));
+    DEBUG_LOG(FetchErrorToString(error));
+    DEBUG_LOG(F(", HTTP code: "));
+    DEBUG_LOG(httpCode);
+    DEBUG_LOG(F(", hours received: "));
+    DEBUG_LOG_LN(weatherForecast.m_hourly.size());
 
-    // Gather probability of perception
-    Array<float, PROBABILITY_OF_PERCEPTION_MAX_COUNT> perceptionAll;
+#ifdef TELEMETRY
+    ++espTelemetry.totalWeatherRequestsFailed;
+#endif // TELEMETRY
 
-    const int timezoneOffset = jsonResponse["timezone_offset"];
+    ScheduleWeatherCheck(weatherRetryScheduler.OnFailure(error, weatherFetcher.GetRetryAfter()));
+    
+    lastRequestEndedWithError = true;
+    weatherDisplay.SetErrorMark(true);
+    return;
+  }
 
-    timeClient.setTimeOffset(timezoneOffset);
+  if(lastRequestEndedWithError)
+  {
+    ScheduleWeatherCheck(weatherRetryScheduler.OnSuccess());
+    
+    lastRequestEndedWithError = false;
+    weatherDisplay.SetErrorMark(false);
+  }
+  
+  const int timezoneOffset = weatherForecast.m_timezoneOffset;
+  timeClient.setTimeOffset(timezoneOffset);
 
-    DEBUG_LOG_LN(F(""));
-    DEBUG_LOG(F("POP: "));
-    arr = jsonResponse["hourly"];
-    for(JsonObject repo : arr)
-    {
-      const float perception = repo["pop"];
-      perceptionAll.push_back(perception);
+  // Built straight into the display's timeline, which digests the current hour on publish
+  BuildTimeline(weatherForecast, weatherDisplay.AcquireTimeline());
+  weatherDisplay.SetLocalTime(timeClient.getEpochTime());
+  weatherDisplay.PublishTimeline();
 
-      DEBUG_LOG(perception);
-      DEBUG_LOG(", ");
+  const SWeatherInfo& weatherInfo = weatherDisplay.GetWeatherInfo();
 
-      if(perceptionAll.size() == PROBABILITY_OF_PERCEPTION_MAX_COUNT)
-      {
-        break;
-      }
-    }
+  DEBUG_LOG(F("POP: "));
+  for(uint8_t index = 0; index < weatherInfo.m_popCount; ++index)
+  {
+    DEBUG_LOG(weatherInfo.m_pop[index]);
+    DEBUG_LOG(", ");
+  }
 
-    // Get temp
-    const float currentTemperatureRaw = jsonResponse["hourly"][0]["feels_like"];
+  DEBUG_LOG_LN(F(""));
+  DEBUG_LOG(F("Current temperature: "));
+  DEBUG_LOG_LN(weatherInfo.m_currentTemp);
+  DEBUG_LOG(F("Midnight temperature: "));
+  DEBUG_LOG_LN(weatherInfo.m_eveningTemp);
+  DEBUG_LOG(F("Min/Max temperature: "));
+  DEBUG_LOG(weatherInfo.m_minTemp);
+  DEBUG_LOG(F("/"));
+  DEBUG_LOG_LN(weatherInfo.m_maxTemp);
+  DEBUG_LOG(F("Worst weather: "));
+  DEBUG_LOG_LN(weatherInfo.m_weatherId);
+
+  weatherDisplay.SetStaleMark(false);
+
+  weatherCache.Save(weatherDisplay.GetTimeline());
+
+  bool isDay = timeClient.getHours() >= EVENING_TIME || timeClient.getHours() <= MORNING_TIME ? false : true;
+  weatherDisplay.SetIsDay(isDay);
+}
 
-    double intpart;
-    const short currentTemperature = modf(currentTemperatureRaw, &intpart) >= 0.5f ? ceil(currentTemperatureRaw) : floor(currentTemperatureRaw);
+void ScheduleWeatherCheck(unsigned long interval)
+{
+  weatherCheckTimer.setInterval(interval);
+  weatherCheckTimer.reset();
+  weatherCheckTimer.start();
+}
 
-    DEBUG_LOG_LN(F(""));
-    DEBUG_LOG(F("Current temperature: "));
-    DEBUG_LOG_LN(currentTemperature);
+unsigned long GetDoNotDisturbRemainingTime()
+{
+  const int dndTo = deviceConfig.Get().m_dndTo;
+  const unsigned long secondsInDay = 60UL * 60 * 24;
 
-    float midnightTemperatureRaw = 0;
-    arr = jsonResponse["hourly"];
-    bool skippedFirst = false; 
-    for(JsonObject repo : arr)
-    {
-      if(!skippedFirst)
-      {
-        skippedFirst = true;
-        continue;
-      }
-      const unsigned long epochTime = repo["dt"];
-      DateTime weatherTime(epochTime + timezoneOffset);
-      if(weatherTime.hour() == 0)
-      {
-        midnightTemperatureRaw = repo["feels_like"];
-        break;
-      }
-    }
+  // The last do not disturb hour is included, it ends when the next one starts
+  const unsigned long endSecond = ((dndTo + 1) % 24) * 60UL * 60;
+  const unsigned long nowSecond = timeClient.getHours() * 60UL * 60 + timeClient.getMinutes() * 60UL + timeClient.getSeconds();
 
-    const short midnightTemperature = modf(midnightTemperatureRaw, &intpart) >= 0.5f ? ceil(midnightTemperatureRaw) : floor(midnightTemperatureRaw);
+  return (endSecond + secondsInDay - nowSecond) % secondsInDay * 1000UL;
+}
 
-    DEBUG_LOG_LN(F(""));
-    DEBUG_LOG(F("Midnight temperature: "));
-    DEBUG_LOG_LN(midnightTemperature);
+void ShowCachedWeather()
+{
+  SForecastTimeline& timeline = weatherDisplay.AcquireTimeline();
 
-    weatherInfo.m_weatherId   = WorstWeatherCase(weatherConditions);
-    weatherInfo.m_pop         = perceptionAll;
-    weatherInfo.m_currentTemp = currentTemperature;
-    weatherInfo.m_eveningTemp = midnightTemperature;
+  if(!weatherCache.Load(timeline))
+  {
+    return;
+  }
 
-    DEBUG_LOG_LN(F(""));
-    DEBUG_LOG(F("Worst weather: "));
-    DEBUG_LOG_LN(weatherInfo.m_weatherId);
+  DEBUG_LOG(F("Showing cached forecast from: "));
+  DEBUG_LOG_LN(timeline.m_firstDt);
 
-    weatherDisplay.SetWeatherInfo(weatherInfo);
+  timeClient.setTimeOffset(timeline.m_timezoneOffset);
 
-    bool isDay = timeClient.getHours() >= EVENING_TIME || timeClient.getHours() <= MORNING_TIME ? false : true;
-    weatherDisplay.SetIsDay(isDay);
-  }
-  else {
-    DEBUG_LOG(F("Error code: "));
-    DEBUG_LOG(httpResponseCode);
-    DEBUG_LOG(F(" "));
-    DEBUG_LOG_LN(http.errorToString(httpResponseCode));
+  // Time isn't synced yet, the first cached hour is shown until it is
+  weatherDisplay.PublishTimeline();
+  weatherDisplay.SetStaleMark(true);
+  weatherDisplay.SetNoWifiConnectionMark(true);
+  weatherDisplay.UpdateDisplay();
+  // Connecting to WiFi blocks loop(), send the whole frame now
+  weatherDisplay.FlushDisplay();
 
-    lastRequestEndedWithError = true;
-    weatherDisplay.SetErrorMark(true);    
-  }
-  
-  // Free resources
-  http.end();
+  cachedWeatherShown = true;
 }
 
 void CheckSleepTime(MillisTimer &mt)
@@ -837,22 +905,24 @@ void CheckSleepTime(MillisTimer &mt)
   DEBUG_LOG_LN(F(";"));
 
   
-  const int dndMode = deviceConfiguration[0][PARAM_DNDMODE].as<bool>();
-  const int dndFrom = deviceConfiguration[0][PARAM_DNDFROM].as<int>();
-  const int dndTo = deviceConfiguration[0][PARAM_DNDTO].as<int>();
+  const SDeviceConfig config = deviceConfig.Get();
+  const int dndFrom = config.m_dndFrom;
+  const int dndTo = config.m_dndTo;
 
-  doNotDisturb = false;
-  if(dndMode)
+  // Stored once, /telemetry never sees it go false on the way
+  bool dndNow = false;
+  if(config.m_dndMode)
   {
     if(dndFrom > dndTo && (timeClient.getHours() >= dndFrom || timeClient.getHours() <= dndTo))
     {
-      doNotDisturb = true;
+      dndNow = true;
     }
     else if(dndFrom < dndTo && (timeClient.getHours() >= dndFrom && timeClient.getHours() <= dndTo))
     {
-      doNotDisturb = true;
+      dndNow = true;
     }
   }
+  doNotDisturb = dndNow;
 
   if(!ntpFirstRun)
   {
@@ -867,26 +937,6 @@ void CheckSleepTime(MillisTimer &mt)
   }
 }
 
-unsigned int WorstWeatherCase(const Array<unsigned int, WEATHER_CONDITIONS_COUNT_MAX>& weatherArray)
-{
-  unsigned int worstCase = 0;
-  uint8_t compareIndex = 0xFF;
-
-  for(unsigned int weatherCondition : weatherArray)
-  {
-    for(uint8_t index = 0; index < sizeof(weatherTypeWorstness) / sizeof(int) && index < compareIndex; ++index)
-    {
-      if(pgm_read_word_near(&weatherTypeWorstness[index]) == weatherCondition)
-      {
-        worstCase = weatherCondition;
-        compareIndex = index;
-      }
-    }
-  }
-
-  return worstCase;
-}
-
 #ifdef TELEMETRY
 String GetTelemetry()
 {
@@ -905,6 +955,104 @@ String GetTelemetry()
     result += F("\ntotalWeatherRequestsFailed: ");
     result += espTelemetry.totalWeatherRequestsFailed;
 
+    result += F("\nmaxLoopTimeDuringFetchUs: ");
+    result += espTelemetry.maxLoopTimeDuringFetchUs;
+
+    result += F("\nmaxFetchSliceUs: ");
+    result += espTelemetry.maxFetchSliceUs;
+
+    result += F("\nworkJobsPosted: ");
+    result += workQueue.GetJobsPosted();
+
+    result += F("\nworkJobsCoalesced: ");
+    result += workQueue.GetJobsCoalesced();
+
+    result += F("\nworkJobsRun: ");
+    result += workQueue.GetJobsRun();
+
+    result += F("\nworkJobsRejected: ");
+    result += workQueue.GetJobsRejected();
+
+    result += F("\nworkMaxJobUs: ");
+    result += workQueue.GetMaxRunTime();
+
+    result += F("\nconfigPageRequests: ");
+    result += espTelemetry.configPageRequests;
+
+    result += F("\nconfigPageNotModified: ");
+    result += espTelemetry.configPageNotModified;
+
+    result += F("\nconfigPageMaxUs: ");
+    result += espTelemetry.configPageMaxUs;
+
+    result += F("\nconfigPageMinFreeHeap: ");
+    result += espTelemetry.configPageMinFreeHeap;
+
+    result += F("\napiConfigMaxUs: ");
+    result += espTelemetry.apiConfigMaxUs;
+
+    result += F("\napiConfigMinFreeHeap: ");
+    result += espTelemetry.apiConfigMinFreeHeap;
+
+    result += F("\nweatherFailuresInARow: ");
+    result += weatherRetryScheduler.GetConsecutiveFailures();
+
+    result += F("\nweatherLastError: ");
+    result += FetchErrorToString(weatherRetryScheduler.GetLastError());
+
+    result += F("\nweatherNextCheckInMs: ");
+    result += weatherRetryScheduler.GetCurrentInterval();
+
+    for(uint8_t error = FETCH_ERROR_NONE + 1; error < FETCH_ERROR_COUNT; ++error)
+    {
+      result += F("\nweatherFailures[");
+      result += FetchErrorToString(static_cast<EFetchError>(error));
+      result += F("]: ");
+      result += weatherRetryScheduler.GetFailures(static_cast<EFetchError>(error));
+    }
+
+    result += F("\ndisplayBytesSent: ");
+    result += weatherDisplay.GetBytesSent();
+
+    result += F("\ndisplayTilesSkipped: ");
+    result += weatherDisplay.GetTilesSkipped();
+
+    result += F("\ndisplayLastRenderUs: ");
+    result += weatherDisplay.GetLastRenderTime();
+
+    result += F("\ndisplayMaxRenderUs: ");
+    result += weatherDisplay.GetMaxRenderTime();
+
+    result += F("\ndisplayLastIconDrawUs: ");
+    result += weatherDisplay.GetLastIconDrawTime();
+
+    result += F("\ndisplayLastSendUs: ");
+    result += weatherDisplay.GetLastSendTime();
+
+    result += F("\ndisplayLastPageSendUs: ");
+    result += weatherDisplay.GetLastPageSendTime();
+
+    result += F("\ndisplayMaxPageSendUs: ");
+    result += weatherDisplay.GetMaxPageSendTime();
+
+    result += F("\ndisplayPowerSaveSwitches: ");
+    result += weatherDisplay.GetPowerSaveSwitches();
+
+    result += F("\ndisplayRowShiftsSkipped: ");
+    result += weatherDisplay.GetRowShiftsSkipped();
+
+    result += F("\ndisplayFramesRendered: ");
+    result += weatherDisplay.GetFramesRendered();
+
+    result += F("\ndisplayFramesCoalesced: ");
+    result += weatherDisplay.GetFramesCoalesced();
+
+    result += F("\ndisplayFramesDropped: ");
+    result += weatherDisplay.GetFramesDropped();
+
+    result += F("\ndisplayPageFlips: ");
+    result += weatherDisplay.GetPageFlips();
+
     result += F("\ndoNotDisturb: ");
     result += doNotDisturb ? F("True") : F("False");
 
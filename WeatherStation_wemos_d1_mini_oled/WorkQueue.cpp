@@ -0,0 +1,157 @@
+#include "WorkQueue.h"
+
+const __FlashStringHelper* JobStateToString(EJobState state)
+{
+  switch(state)
+  {
+    case JOB_STATE_PENDING:
+      return F("pending");
+    case JOB_STATE_RUNNING:
+      return F("running");
+    case JOB_STATE_DONE:
+      return F("done");
+    case JOB_STATE_FAILED:
+      return F("failed");
+    default:
+      return F("unknown");
+  }
+}
+
+CWorkQueue::CWorkQueue()
+  : m_jobs()
+  , m_lastId(0)
+  , m_runJobCb(nullptr)
+  , m_jobsPosted(0)
+  , m_jobsCoalesced(0)
+  , m_jobsRun(0)
+  , m_jobsRejected(0)
+  , m_maxRunTime(0)
+  {
+  }
+
+uint16_t CWorkQueue::Post(EWorkJob job, unsigned long delay)
+{
+  const unsigned long runAfter = millis() + delay;
+
+  // 0 is never handed out
+  uint16_t id = m_lastId + 1;
+  if(id == 0)
+  {
+    ++id;
+  }
+
+  // A burst of posts of one kind holds a single slot, the pending job takes
+  // the new id and the earlier one is forgotten
+  SWorkJob* coalesced = nullptr;
+  for(SWorkJob& pending : m_jobs)
+  {
+    if(pending.m_state == JOB_STATE_PENDING && pending.m_job == job)
+    {
+      coalesced = &pending;
+      break;
+    }
+  }
+
+  SWorkJob* slot = coalesced ? coalesced : FindFreeSlot();
+  if(!slot)
+  {
+    DEBUG_LOG(F("[WorkQueue] Full, job rejected: "));
+    DEBUG_LOG_LN(job);
+    ++m_jobsRejected;
+    return 0;
+  }
+
+  if(!coalesced || static_cast<long>(runAfter - slot->m_runAfter) > 0)
+  {
+    slot->m_runAfter = runAfter;
+  }
+  slot->m_id = id;
+  slot->m_job = job;
+  slot->m_state = JOB_STATE_PENDING;
+
+  m_lastId = id;
+  ++m_jobsPosted;
+  m_jobsCoalesced += coalesced ? 1 : 0;
+  return id;
+}
+
+void CWorkQueue::Run()
+{
+  const unsigned long now = millis();
+
+  // The oldest due job, ids are handed out in order
+  SWorkJob* next = nullptr;
+  for(SWorkJob& job : m_jobs)
+  {
+    if(job.m_state != JOB_STATE_PENDING || static_cast<long>(now - job.m_runAfter) < 0)
+    {
+      continue;
+    }
+    if(!next || static_cast<uint16_t>(m_lastId - job.m_id) > static_cast<uint16_t>(m_lastId - next->m_id))
+    {
+      next = &job;
+    }
+  }
+
+  if(!next || !m_runJobCb)
+  {
+    return;
+  }
+
+  // Jobs of the same kind posted while this one runs don't join it, they
+  // only coalesce with pending ones
+  next->m_state = JOB_STATE_RUNNING;
+
+  const unsigned long runStart = micros();
+  const bool succeeded = m_runJobCb(next->m_job);
+  m_maxRunTime = max(m_maxRunTime, micros() - runStart);
+  ++m_jobsRun;
+
+  next->m_state = succeeded ? JOB_STATE_DONE : JOB_STATE_FAILED;
+}
+
+bool CWorkQueue::IsPending(EWorkJob job) const
+{
+  for(const SWorkJob& pending : m_jobs)
+  {
+    if(pending.m_state == JOB_STATE_PENDING && pending.m_job == job)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+EJobState CWorkQueue::GetState(uint16_t id) const
+{
+  for(const SWorkJob& job : m_jobs)
+  {
+    if(id != 0 && job.m_id == id)
+    {
+      return job.m_state;
+    }
+  }
+  return JOB_STATE_UNKNOWN;
+}
+
+SWorkJob* CWorkQueue::FindFreeSlot()
+{
+  // Never used slots first, then the one that finished longest ago
+  SWorkJob* oldest = nullptr;
+  for(SWorkJob& job : m_jobs)
+  {
+    if(job.m_state == JOB_STATE_UNKNOWN)
+    {
+      return &job;
+    }
+    if(job.m_state != JOB_STATE_DONE && job.m_state != JOB_STATE_FAILED)
+    {
+      continue;
+    }
+    if(!oldest || static_cast<uint16_t>(m_lastId - job.m_id) > static_cast<uint16_t>(m_lastId - oldest->m_id))
+    {
+      oldest = &job;
+    }
+  }
+  return oldest;
+}
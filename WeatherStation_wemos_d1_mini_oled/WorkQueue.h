@@ -0,0 +1,90 @@
+#ifndef _WORKQUEUE_H
+#define _WORKQUEUE_H
+
+#include <Arduino.h>
+
+#include "DebugHelpers.h"
+
+///////////////// DEFINES
+// Jobs remembered at once, pending ones plus the latest finished ones whose
+// state can still be asked for
+#define WORK_QUEUE_SIZE 8
+
+///////////////// CODE
+enum EWorkJob : uint8_t
+{
+  JOB_SAVE_CONFIG = 0,
+  JOB_REFRESH_WEATHER,
+  JOB_RESTART,
+  JOB_RESET,
+
+  WORK_JOB_COUNT
+};
+
+enum EJobState : uint8_t
+{
+  JOB_STATE_UNKNOWN = 0,
+  JOB_STATE_PENDING,
+  JOB_STATE_RUNNING,
+  JOB_STATE_DONE,
+  JOB_STATE_FAILED
+};
+
+const __FlashStringHelper* JobStateToString(EJobState state);
+
+struct SWorkJob
+{
+  uint16_t m_id;
+  EWorkJob m_job;
+  EJobState m_state;
+  unsigned long m_runAfter;  // millis()
+};
+
+// Work the web handlers would otherwise do inside the async TCP callbacks.
+// Handlers post it and answer right away, Run() does it from loop().
+//
+// Jobs of the same kind coalesce: a job posted while another one of its kind
+// is pending runs once for both, and the run is pushed back to the later of
+// the two delays. Three quick saves make one write and one weather refresh.
+// The pending job keeps its slot and takes the id of the latest post, the
+// ids handed out before read as unknown from then on.
+class CWorkQueue
+{
+  public:
+    // Returns whether the job succeeded
+    typedef bool(*runJobCb)(EWorkJob job);
+
+    CWorkQueue();
+
+    void SetRunJobCb(runJobCb callback) { m_runJobCb = callback; }
+
+    // Returns the id to ask for the job state with, 0 if the queue is full of
+    // pending jobs of other kinds
+    uint16_t Post(EWorkJob job, unsigned long delay = 0);
+    // Runs at most one due job
+    void Run();
+
+    bool IsPending(EWorkJob job) const;
+    EJobState GetState(uint16_t id) const;
+
+    unsigned long GetJobsPosted() const { return m_jobsPosted; }
+    unsigned long GetJobsCoalesced() const { return m_jobsCoalesced; }
+    unsigned long GetJobsRun() const { return m_jobsRun; }
+    unsigned long GetJobsRejected() const { return m_jobsRejected; }
+    unsigned long GetMaxRunTime() const { return m_maxRunTime; }
+
+  private:
+    SWorkJob* FindFreeSlot();
+
+  private:
+    SWorkJob m_jobs[WORK_QUEUE_SIZE];
+    uint16_t m_lastId;
+    runJobCb m_runJobCb;
+
+    unsigned long m_jobsPosted;
+    unsigned long m_jobsCoalesced;
+    unsigned long m_jobsRun;
+    unsigned long m_jobsRejected;
+    unsigned long m_maxRunTime;    // us
+};
+#endif
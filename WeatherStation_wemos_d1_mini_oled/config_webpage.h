@@ -0,0 +1,352 @@
+// Generated by tools/generate_assets.py from assets/web/config.html, do not edit.
+// Gzipped, send it with Content-Encoding: gzip.
+#ifndef _CONFIG_WEBPAGE_H_
+#define _CONFIG_WEBPAGE_H_
+
+// 22032 -> 4069 bytes
+#define CONFIG_HTML_ETAG "\"fe7d176962a8d758\""
+const uint32_t CONFIG_HTML_SIZE = 4069;
+static const uint8_t CONFIG_HTML[] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xBD, 0x1B,
+  0x6B, 0x53, 0xDB, 0xC6, 0xF6, 0xBB, 0x7E, 0xC5, 0x56, 0x4D, 0x6B, 0x39,
+  0xB5, 0xE4, 0x17, 0x10, 0x62, 0x23, 0x3A, 0x80, 0x21, 0x61, 0x2E, 0x04,
+  0x06, 0xE8, 0xA4, 0x9D, 0xB6, 0x43, 0xD6, 0xD2, 0xDA, 0x56, 0x23, 0x4B,
+  0xEE, 0x4A, 0xC6, 0x38, 0x0C, 0xFF, 0xFD, 0x9E, 0xB3, 0xBB, 0x7A, 0xD9,
+  0xB2, 0x0D, 0x09, 0x69, 0xD3, 0x60, 0xBC, 0x7B, 0xF6, 0xBC, 0x5F, 0xFB,
+  0xC8, 0xDE, 0x0F, 0xBD, 0x8B, 0xA3, 0x9B, 0x3F, 0x2E, 0x8F, 0xC9, 0xFB,
+  0x9B, 0xF3, 0xB3, 0x7D, 0x6D, 0x6F, 0x14, 0x8F, 0x7D, 0xFC, 0x60, 0xD4,
+  0x85, 0x8F, 0xD8, 0x8B, 0x7D, 0xB6, 0xFF, 0x91, 0xD1, 0x78, 0xC4, 0x38,
+  0xE9, 0x79, 0xD1, 0xC4, 0xA7, 0x73, 0x72, 0x14, 0x06, 0x03, 0x6F, 0x38,
+  0xE5, 0x34, 0xF6, 0xC2, 0x80, 0x5C, 0xD2, 0x21, 0xDB, 0xAB, 0x4B, 0x48,
+  0x6D, 0x6F, 0xCC, 0x62, 0x4A, 0x02, 0x3A, 0x66, 0xB6, 0x7E, 0xE7, 0xB1,
+  0xD9, 0x24, 0xE4, 0xB1, 0x4E, 0x9C, 0x30, 0x88, 0x59, 0x10, 0xDB, 0xFA,
+  0xCC, 0x73, 0xE3, 0x91, 0xED, 0xB2, 0x3B, 0xCF, 0x61, 0xA6, 0xF8, 0x52,
+  0x23, 0x5E, 0xE0, 0xC5, 0x1E, 0xF5, 0xCD, 0xC8, 0xA1, 0x3E, 0xB3, 0x9B,
+  0x3A, 0x20, 0x89, 0xE2, 0x39, 0x22, 0xB3, 0xFA, 0xA1, 0x3B, 0x27, 0x0F,
+  0x5A, 0x9F, 0x3A, 0x9F, 0x87, 0x3C, 0x9C, 0x06, 0xAE, 0xE9, 0x84, 0x7E,
+  0xC8, 0x3B, 0x64, 0x36, 0xF2, 0x62, 0xD6, 0xD5, 0x1E, 0x35, 0xCB, 0x01,
+  0xBC, 0x9C, 0xE1, 0x44, 0x10, 0x53, 0x2F, 0x00, 0x2E, 0x1F, 0x34, 0x81,
+  0xB8, 0x43, 0xDA, 0xDB, 0x8D, 0xC9, 0x7D, 0xB7, 0x64, 0x35, 0x1F, 0xF6,
+  0x8D, 0xE6, 0xEE, 0x4E, 0x8D, 0xB4, 0x5A, 0xDB, 0xF0, 0xA3, 0xB9, 0x55,
+  0xED, 0x6A, 0x63, 0xCA, 0x87, 0x5E, 0xD0, 0x21, 0xB0, 0x84, 0xD0, 0x69,
+  0x1C, 0xC2, 0xBA, 0x90, 0xBB, 0x8C, 0x9B, 0x9C, 0xBA, 0xDE, 0x34, 0xEA,
+  0x90, 0xA6, 0x40, 0x06, 0x14, 0xC7, 0x40, 0xA6, 0x40, 0x6E, 0x42, 0x5D,
+  0xD7, 0x0B, 0x86, 0x66, 0x1C, 0x4E, 0x3A, 0xA4, 0xB5, 0x8D, 0x60, 0xC9,
+  0x50, 0x3F, 0x8C, 0xE3, 0x70, 0x9C, 0x2C, 0x4E, 0x46, 0x7D, 0x36, 0x88,
+  0x01, 0xB2, 0x30, 0xC6, 0xBD, 0xE1, 0x28, 0x1D, 0x04, 0x2A, 0x68, 0x00,
+  0x33, 0x66, 0xF7, 0x31, 0x10, 0x18, 0x00, 0x31, 0x33, 0xF2, 0xBE, 0x30,
+  0x90, 0x49, 0xCC, 0xE3, 0xB8, 0x49, 0x7D, 0x6F, 0x08, 0x0C, 0xA3, 0x02,
+  0x18, 0xEF, 0x4A, 0xA0, 0x19, 0x93, 0x68, 0xFA, 0xA1, 0xEF, 0xE2, 0x20,
+  0x20, 0x8A, 0x98, 0x23, 0xCC, 0xF4, 0x50, 0x2E, 0x90, 0x94, 0x5B, 0xF2,
+  0x5E, 0x18, 0x59, 0xC7, 0x7A, 0xB3, 0x8C, 0xF5, 0x54, 0x41, 0x13, 0xCA,
+  0xC1, 0xFE, 0x31, 0x37, 0x33, 0xD2, 0x0A, 0xB4, 0x0C, 0x08, 0x7D, 0xA5,
+  0x28, 0xE3, 0x98, 0x01, 0x83, 0xE3, 0xA2, 0x94, 0x48, 0xB7, 0xB8, 0xCE,
+  0x0B, 0x26, 0xD3, 0xB8, 0xD4, 0x39, 0x62, 0x4E, 0x83, 0x08, 0xE0, 0x40,
+  0x31, 0x89, 0x15, 0x85, 0x5D, 0xBB, 0xDA, 0x48, 0xA9, 0x47, 0x1A, 0x49,
+  0xB9, 0x49, 0xB3, 0xD1, 0xF8, 0xA9, 0xAB, 0xA9, 0xB5, 0x3F, 0x36, 0xC4,
+  0x7F, 0x5D, 0x2D, 0x9C, 0xC6, 0x3E, 0xD8, 0xB7, 0x43, 0x82, 0x30, 0x60,
+  0xA9, 0x33, 0xA4, 0x4A, 0x01, 0x2F, 0x89, 0x42, 0xDF, 0x73, 0xA5, 0x2F,
+  0x35, 0xDE, 0xD4, 0x48, 0xF2, 0xA3, 0xAA, 0x9C, 0x64, 0x92, 0x39, 0xA2,
+  0xA4, 0x90, 0x10, 0x6F, 0xBE, 0xC9, 0xA9, 0x59, 0x31, 0x06, 0x2B, 0xDC,
+  0xC0, 0x7D, 0xC7, 0x01, 0xE1, 0x83, 0xE6, 0xCA, 0x30, 0xEB, 0x90, 0x21,
+  0x7C, 0xEF, 0x6A, 0xF8, 0x13, 0x3C, 0x61, 0x0C, 0x63, 0x31, 0x43, 0x19,
+  0xA7, 0xE3, 0x00, 0xCC, 0xC7, 0xD9, 0x04, 0xC2, 0xD2, 0x68, 0x01, 0xD1,
+  0x01, 0xAF, 0x2A, 0x30, 0xF4, 0x5C, 0x93, 0x87, 0x33, 0x34, 0xEF, 0xF6,
+  0x4A, 0x63, 0x02, 0xB5, 0xFE, 0x14, 0x06, 0x02, 0x45, 0x30, 0x61, 0xA5,
+  0x60, 0xD6, 0x45, 0x2B, 0x0B, 0x0F, 0xD9, 0x12, 0x43, 0x2F, 0xC3, 0xE0,
+  0x76, 0x91, 0x97, 0x52, 0x53, 0xFE, 0xB8, 0x73, 0x72, 0xF4, 0xE6, 0xB0,
+  0xD5, 0x25, 0xF5, 0xD7, 0xE4, 0x1D, 0x67, 0x2C, 0x20, 0xAF, 0xEB, 0xA9,
+  0x49, 0xA5, 0x65, 0x8A, 0x19, 0x21, 0x65, 0xCD, 0x0B, 0xD0, 0x7C, 0x66,
+  0xDF, 0x0F, 0x9D, 0xCF, 0xE0, 0x4A, 0xE8, 0x12, 0x1E, 0x3A, 0xA3, 0xE9,
+  0xAA, 0xBC, 0x05, 0x9A, 0xB7, 0x5A, 0x51, 0x57, 0x13, 0x60, 0xA9, 0x6D,
+  0x76, 0x91, 0xA7, 0x7F, 0xA6, 0x51, 0xEC, 0x0D, 0xE6, 0xA6, 0x4A, 0x5B,
+  0x59, 0x8C, 0x39, 0x53, 0x1E, 0x21, 0xB1, 0x49, 0xE8, 0xC9, 0x81, 0x94,
+  0xFB, 0xCE, 0x28, 0xBC, 0x13, 0xC9, 0xA0, 0x44, 0x86, 0xB6, 0xC3, 0x5A,
+  0xFD, 0x7E, 0x0E, 0xF8, 0xD0, 0x1B, 0x16, 0x62, 0x02, 0x2C, 0x45, 0xDA,
+  0x2D, 0xA4, 0x9C, 0x8B, 0x82, 0xE6, 0x4E, 0x41, 0x3D, 0xD7, 0x63, 0xEA,
+  0xFB, 0x39, 0x97, 0x6A, 0x2D, 0x1B, 0xA7, 0x68, 0xAF, 0xA2, 0xC9, 0xF3,
+  0x88, 0x5B, 0x05, 0xC4, 0x3D, 0x1A, 0x0C, 0x57, 0x71, 0x7E, 0xD2, 0x7E,
+  0xDB, 0x3A, 0xEC, 0x2D, 0x01, 0xAF, 0x13, 0x96, 0xF5, 0xB7, 0xB7, 0xDE,
+  0xEE, 0xAA, 0x14, 0xE6, 0x4F, 0x4C, 0xCE, 0x22, 0x16, 0xE7, 0x9D, 0x5A,
+  0x5A, 0xAD, 0xA0, 0xF5, 0xAD, 0xF5, 0x49, 0x2D, 0xC9, 0x7C, 0x2B, 0x72,
+  0xDC, 0x24, 0x94, 0x96, 0xED, 0x10, 0xDA, 0x87, 0x98, 0x9C, 0xA2, 0x1B,
+  0x28, 0x2D, 0x6D, 0x35, 0x0A, 0x61, 0xDF, 0x96, 0x5F, 0xBF, 0x40, 0xEE,
+  0x70, 0xD9, 0x3D, 0x2A, 0x1E, 0xA8, 0xA2, 0xE6, 0xB6, 0x31, 0x3E, 0x65,
+  0x6A, 0x13, 0xBF, 0x26, 0x01, 0x61, 0x36, 0xD1, 0x49, 0x49, 0x03, 0xFE,
+  0x98, 0xAD, 0x46, 0x43, 0x39, 0x2C, 0xF8, 0xA2, 0x77, 0x71, 0x4D, 0x44,
+  0x91, 0x22, 0xD1, 0xCC, 0x8B, 0x9D, 0x11, 0xBA, 0xA5, 0x35, 0x08, 0xF9,
+  0xD8, 0x54, 0xDF, 0x1F, 0x56, 0x79, 0xE2, 0x92, 0x0B, 0x81, 0x3C, 0xFD,
+  0xCF, 0x5E, 0x6C, 0xC6, 0x74, 0x62, 0x8E, 0x80, 0x4F, 0x1F, 0x79, 0x2D,
+  0x4D, 0x65, 0x8F, 0x45, 0x12, 0x1E, 0xFA, 0x50, 0x2A, 0x3B, 0x67, 0x10,
+  0x7D, 0xDE, 0xDD, 0xEA, 0x10, 0x50, 0x99, 0x40, 0x25, 0x6B, 0x6B, 0x9B,
+  0xB3, 0x71, 0xA6, 0xA7, 0x9D, 0x42, 0x76, 0xDC, 0x29, 0x2F, 0x9B, 0x3F,
+  0xB2, 0x1D, 0xFC, 0xB3, 0x54, 0x19, 0x5B, 0x6D, 0x84, 0x07, 0x8F, 0x88,
+  0x3D, 0x28, 0xE1, 0x89, 0x09, 0x85, 0x39, 0xA5, 0x13, 0xE6, 0xE3, 0x0F,
+  0xAC, 0x04, 0x7E, 0xDC, 0xB0, 0xDA, 0x11, 0x41, 0xEE, 0x28, 0x5F, 0x96,
+  0xAB, 0xD3, 0xE9, 0x33, 0x18, 0xC0, 0xAA, 0x90, 0x46, 0xA0, 0xAE, 0x97,
+  0x1B, 0x5A, 0x1A, 0xAD, 0x91, 0x4B, 0xE7, 0x5B, 0xAD, 0x82, 0x2C, 0xAD,
+  0x15, 0xB2, 0x0C, 0x06, 0x83, 0xE5, 0x12, 0xDF, 0x14, 0x7E, 0x88, 0xBC,
+  0x22, 0x43, 0x4A, 0xFD, 0x98, 0xD5, 0xDA, 0xAE, 0x01, 0x88, 0xA0, 0x57,
+  0xC0, 0x1F, 0x8D, 0x2A, 0x11, 0xBD, 0x0A, 0x0C, 0x36, 0x21, 0xB9, 0xC1,
+  0xFF, 0xD5, 0x32, 0x09, 0x5B, 0xDB, 0xEB, 0x44, 0xA4, 0x83, 0x58, 0x84,
+  0xD0, 0x57, 0x48, 0xD8, 0xFA, 0x56, 0x09, 0xFB, 0xE1, 0xBD, 0x19, 0x8D,
+  0xA8, 0x1B, 0xCE, 0x00, 0x31, 0xCA, 0x24, 0xFE, 0x42, 0x25, 0xA3, 0x46,
+  0x03, 0xC4, 0x93, 0xFF, 0x5B, 0xAD, 0xAD, 0xEA, 0x93, 0x94, 0x51, 0x2A,
+  0x7B, 0x44, 0x18, 0x8D, 0x18, 0x04, 0x9A, 0x09, 0x85, 0x74, 0x51, 0xFE,
+  0x0E, 0x75, 0xD0, 0x55, 0xF3, 0x6A, 0x48, 0x44, 0xDB, 0x7D, 0xA2, 0x05,
+  0x56, 0xA2, 0xC4, 0xAE, 0xA0, 0xE3, 0x8C, 0x98, 0xF3, 0x99, 0xB9, 0xE4,
+  0x97, 0x1C, 0x09, 0xB2, 0x02, 0x2B, 0xE6, 0xD9, 0x0C, 0x2D, 0x59, 0xB4,
+  0x94, 0xEC, 0x32, 0x48, 0x31, 0x7D, 0x95, 0x42, 0xE5, 0xA9, 0xC2, 0x8A,
+  0x12, 0x8B, 0x6C, 0x1D, 0xF6, 0xDE, 0xEC, 0xB4, 0x37, 0xAF, 0xCE, 0x02,
+  0x60, 0x25, 0xD3, 0xBB, 0x65, 0xDE, 0xA8, 0x2C, 0x57, 0x7D, 0x0A, 0x85,
+  0x0D, 0x5A, 0x69, 0xB5, 0x16, 0xB4, 0x02, 0x49, 0xEF, 0xC6, 0x1B, 0xC3,
+  0x12, 0xCC, 0x74, 0xB1, 0xF8, 0x6D, 0x29, 0xA9, 0xAF, 0xC9, 0xC4, 0xED,
+  0xD2, 0x4C, 0xFC, 0xE4, 0xE4, 0xDB, 0xCC, 0x9A, 0x05, 0x74, 0xAB, 0x84,
+  0xFE, 0x5A, 0xE4, 0x05, 0xE0, 0xDB, 0xDB, 0xE8, 0x0E, 0x8B, 0x6E, 0x4E,
+  0x5C, 0xA1, 0xB5, 0xDF, 0x0D, 0xB3, 0x59, 0x5D, 0x82, 0x75, 0x3C, 0xEE,
+  0xF8, 0xA2, 0x2B, 0xF5, 0x7C, 0x3F, 0x91, 0x2E, 0x8A, 0x79, 0xF8, 0x39,
+  0x6D, 0x08, 0x17, 0x56, 0x4C, 0x60, 0x87, 0x64, 0x42, 0x0A, 0x9E, 0x44,
+  0x0C, 0x3B, 0x2A, 0x09, 0x6B, 0x2A, 0xFE, 0xDE, 0x20, 0x3B, 0xC9, 0xF2,
+  0x21, 0x67, 0xF3, 0xF2, 0xE5, 0x90, 0x91, 0x61, 0x4B, 0x01, 0xB5, 0x7B,
+  0x1D, 0x02, 0x13, 0x53, 0x8A, 0x43, 0x41, 0x6F, 0xC2, 0xB7, 0x0A, 0xC1,
+  0xC2, 0xC3, 0x18, 0xAC, 0x67, 0xBC, 0x6D, 0xB8, 0x6C, 0x98, 0x8F, 0x5D,
+  0x33, 0x84, 0xAC, 0xEF, 0xE5, 0xCA, 0x6A, 0x3E, 0x60, 0x9B, 0x49, 0x96,
+  0xC2, 0xD0, 0xED, 0x0A, 0x89, 0x4D, 0x3E, 0xF5, 0xA5, 0xA0, 0x5F, 0x18,
+  0x0F, 0x33, 0xD6, 0xA1, 0x76, 0x61, 0x25, 0x3A, 0x42, 0x77, 0xDE, 0x20,
+  0x82, 0x35, 0x14, 0xDD, 0xDA, 0x83, 0x96, 0xDB, 0x72, 0xED, 0xC0, 0x66,
+  0xAB, 0xB9, 0xBB, 0x05, 0x3F, 0xDA, 0x25, 0x3A, 0x5F, 0x58, 0x1F, 0x72,
+  0x6C, 0x35, 0x32, 0x04, 0xF2, 0xFB, 0xA6, 0x55, 0x5C, 0x68, 0x3F, 0xA1,
+  0xC9, 0xDC, 0x25, 0x78, 0x9F, 0xF6, 0x99, 0x5F, 0x28, 0x9C, 0xCF, 0x71,
+  0xD5, 0x62, 0xF7, 0x3B, 0xF0, 0x19, 0x7C, 0x15, 0xE5, 0xCE, 0x84, 0xE6,
+  0x73, 0x1C, 0x65, 0x0A, 0x5E, 0xD9, 0x41, 0xE6, 0x1A, 0x9A, 0xAD, 0x5D,
+  0xE9, 0xA5, 0x7B, 0x75, 0xB5, 0xDD, 0xDD, 0x8B, 0x1C, 0xEE, 0x4D, 0xE2,
+  0x7D, 0x6D, 0x30, 0x0D, 0xE4, 0xC6, 0x09, 0x9A, 0xA7, 0x98, 0xF2, 0xB8,
+  0x27, 0xF6, 0xCB, 0x46, 0x55, 0x7B, 0xD0, 0xBC, 0x01, 0x31, 0x1C, 0xDC,
+  0x7E, 0xF3, 0xB1, 0xA1, 0x5F, 0xC9, 0x69, 0xB2, 0xB0, 0x3F, 0xFF, 0x55,
+  0xAF, 0x12, 0xDB, 0x86, 0x70, 0x9E, 0xB2, 0xAA, 0x70, 0x25, 0x80, 0x11,
+  0xB1, 0x6B, 0xB4, 0x30, 0x71, 0x46, 0x2C, 0x70, 0xAF, 0xD8, 0xBF, 0x53,
+  0x58, 0x6C, 0x54, 0xEA, 0x8A, 0x84, 0xDC, 0x92, 0x57, 0x84, 0x59, 0x1E,
+  0x0B, 0x0C, 0xB0, 0x95, 0xE4, 0x3F, 0x52, 0x8E, 0x4A, 0xFF, 0xE1, 0xAF,
+  0xE0, 0x66, 0xE4, 0x45, 0x64, 0x06, 0x9E, 0x23, 0x17, 0x88, 0x22, 0x30,
+  0x0F, 0xA7, 0x9C, 0x38, 0x85, 0x93, 0x02, 0x1A, 0xB8, 0x04, 0xA7, 0x17,
+  0xCF, 0x13, 0xBC, 0x80, 0x9C, 0x40, 0xFE, 0x0E, 0xF9, 0x1C, 0x9A, 0x2A,
+  0xF0, 0x60, 0xEB, 0xAF, 0xA0, 0x17, 0x22, 0x02, 0x32, 0xA3, 0x41, 0x4C,
+  0xE2, 0x50, 0x1C, 0x20, 0x78, 0xC1, 0x94, 0xAD, 0x13, 0xAD, 0x46, 0x2A,
+  0x59, 0xC7, 0x59, 0x29, 0x13, 0x94, 0xAD, 0x12, 0x33, 0x0F, 0xC9, 0xE5,
+  0x27, 0x4A, 0x0B, 0x54, 0xA3, 0x98, 0xDC, 0x8F, 0x38, 0xB1, 0x49, 0xC0,
+  0x66, 0xE4, 0xF7, 0xF3, 0xB3, 0xF7, 0x71, 0x3C, 0x49, 0x20, 0x01, 0x0B,
+  0xCC, 0x59, 0xE1, 0x84, 0x05, 0x46, 0xE5, 0xDD, 0xF1, 0x4D, 0xA5, 0x46,
+  0xD4, 0xE2, 0x9A, 0xE4, 0x50, 0xCE, 0x23, 0x72, 0x23, 0x98, 0xFA, 0xBE,
+  0xA0, 0x9A, 0xD2, 0x1C, 0x79, 0x2E, 0xBB, 0x96, 0x1B, 0x64, 0x03, 0x32,
+  0x91, 0xCF, 0x6A, 0x84, 0xF9, 0x6C, 0x0C, 0x7E, 0x72, 0xEA, 0xA2, 0x6C,
+  0x77, 0x10, 0x91, 0xF7, 0x40, 0xD8, 0x0D, 0x9D, 0x29, 0x8E, 0x5A, 0x43,
+  0x16, 0x1F, 0x4B, 0x80, 0xC3, 0xF9, 0xA9, 0x6B, 0x64, 0xC0, 0x5D, 0x69,
+  0x16, 0xC4, 0x61, 0x25, 0x39, 0xDE, 0xCE, 0x69, 0xE9, 0xDE, 0x12, 0x0E,
+  0x66, 0x29, 0xC7, 0x05, 0x9C, 0xBA, 0xE8, 0x09, 0xA1, 0xE1, 0x78, 0x04,
+  0x9A, 0x11, 0x2B, 0x87, 0xC1, 0x3C, 0xA7, 0x4B, 0x45, 0xD5, 0xEB, 0xE4,
+  0x66, 0xC4, 0xC8, 0x84, 0x42, 0x44, 0x82, 0xA5, 0xD1, 0x48, 0x9E, 0x23,
+  0xCC, 0xE9, 0x50, 0xA0, 0xE8, 0x82, 0xBC, 0x30, 0x7D, 0x47, 0x7D, 0x10,
+  0x1E, 0x6C, 0x05, 0x1B, 0xFA, 0x01, 0x0F, 0xC7, 0x62, 0x50, 0x6A, 0x3C,
+  0x13, 0xDB, 0x0F, 0xA9, 0x2B, 0xCF, 0x8F, 0x84, 0x43, 0x0D, 0x18, 0xD4,
+  0x27, 0xB0, 0x0E, 0x9D, 0x78, 0x75, 0xE9, 0x2C, 0x95, 0x2A, 0xD4, 0x97,
+  0x11, 0xA8, 0x14, 0x0C, 0x36, 0x01, 0x03, 0x30, 0x62, 0xEF, 0x93, 0xE4,
+  0x77, 0xEB, 0x9F, 0x08, 0xD4, 0x55, 0x4D, 0x40, 0xE4, 0x0A, 0x04, 0x48,
+  0x8C, 0x85, 0xE9, 0x6E, 0x8D, 0xD2, 0x2A, 0x09, 0x0D, 0x8C, 0x44, 0x2E,
+  0x7C, 0x19, 0x16, 0xC9, 0x22, 0x1F, 0x0E, 0xC4, 0x6A, 0x0B, 0x2C, 0xC8,
+  0xE7, 0xD7, 0xA0, 0x5E, 0xF4, 0xC8, 0x03, 0xDF, 0x37, 0x2A, 0x62, 0xFE,
+  0x4F, 0x3C, 0xA8, 0xF8, 0xBB, 0x52, 0x45, 0x8D, 0xA2, 0xBE, 0xC5, 0xA0,
+  0x15, 0xCF, 0x27, 0x4C, 0x28, 0xBB, 0x22, 0x34, 0x0F, 0x9D, 0x55, 0x45,
+  0x00, 0x88, 0xC9, 0xD4, 0x18, 0x2A, 0x0E, 0xFE, 0x94, 0xC3, 0x02, 0x51,
+  0x6A, 0xA1, 0xD4, 0x08, 0x19, 0x52, 0x71, 0x24, 0x02, 0x41, 0x21, 0x57,
+  0x65, 0xF8, 0x84, 0x82, 0x4B, 0xB1, 0xA5, 0x66, 0xBA, 0x06, 0x9E, 0x81,
+  0x22, 0x2C, 0x1E, 0x43, 0x38, 0x7A, 0x11, 0x03, 0x58, 0x37, 0x02, 0xD7,
+  0x72, 0x21, 0x43, 0xA9, 0xF1, 0x00, 0xB2, 0x5D, 0xA4, 0x82, 0x51, 0x4C,
+  0x6B, 0x42, 0x6E, 0xE5, 0x50, 0xD1, 0x9F, 0x15, 0xC8, 0x43, 0x90, 0xBC,
+  0xAF, 0x29, 0xB4, 0xF4, 0x18, 0x5C, 0x95, 0xBF, 0x53, 0xCA, 0xE7, 0x10,
+  0xB8, 0xD6, 0xC0, 0x0F, 0x43, 0xAE, 0x74, 0x6F, 0x2D, 0xC0, 0x92, 0x3A,
+  0x9E, 0x76, 0x34, 0xE0, 0x63, 0xA7, 0x21, 0x95, 0xBC, 0x06, 0xF1, 0xC5,
+  0x60, 0xF0, 0x1C, 0xDC, 0x00, 0xAE, 0xD0, 0x2F, 0x63, 0x76, 0x60, 0x19,
+  0x6C, 0x7B, 0x21, 0x79, 0x44, 0x39, 0x94, 0x0A, 0x0F, 0xF4, 0x34, 0xD0,
+  0xF4, 0x40, 0x78, 0x56, 0xE0, 0x23, 0x19, 0x0B, 0x03, 0x48, 0xE5, 0xAB,
+  0xDC, 0xC4, 0x1B, 0xE0, 0x29, 0xD3, 0x98, 0x4E, 0x2A, 0x55, 0x2B, 0xE2,
+  0x0E, 0xA0, 0xAA, 0x8C, 0x20, 0xF2, 0xA3, 0x4E, 0xBD, 0x0E, 0x83, 0x91,
+  0x35, 0x0C, 0xC3, 0x21, 0x46, 0x5B, 0x38, 0x16, 0xDF, 0x7F, 0xFD, 0xD7,
+  0xCE, 0xA3, 0x56, 0xE4, 0x8A, 0xD4, 0x70, 0xE8, 0xE7, 0x91, 0x6F, 0xB3,
+  0xE0, 0xE7, 0x2F, 0x76, 0x73, 0xEB, 0x67, 0xE8, 0x8B, 0xC1, 0x7C, 0x36,
+  0x1B, 0xF7, 0x99, 0x5B, 0x59, 0xC3, 0x4A, 0x2C, 0x84, 0x8C, 0xF9, 0x1C,
+  0x59, 0x59, 0x88, 0x51, 0x85, 0x3D, 0x05, 0x21, 0xBF, 0x92, 0x8A, 0x08,
+  0xED, 0x0A, 0xE9, 0x90, 0x0A, 0x06, 0x30, 0x60, 0xCE, 0x27, 0x9A, 0x95,
+  0x54, 0xA4, 0xAA, 0x23, 0x54, 0xF5, 0x6D, 0xE6, 0xC9, 0xA0, 0xB1, 0xFC,
+  0x84, 0x70, 0x38, 0x8C, 0x9D, 0x27, 0xA1, 0x74, 0x03, 0xB7, 0x88, 0x0A,
+  0x07, 0x9E, 0x87, 0xC2, 0x81, 0xC0, 0x80, 0x7D, 0x4B, 0x11, 0x4D, 0x32,
+  0x18, 0x41, 0xDD, 0x15, 0x99, 0x5C, 0xE4, 0xD5, 0x14, 0x07, 0x75, 0xDD,
+  0xE3, 0x3B, 0xF8, 0xE5, 0xCC, 0x8B, 0xA0, 0xF4, 0x42, 0x65, 0xA8, 0xF4,
+  0x2E, 0xCE, 0x8F, 0x64, 0x1D, 0x3E, 0x83, 0xE4, 0x03, 0xDA, 0xAE, 0xE5,
+  0xB2, 0x50, 0x8D, 0x0C, 0x28, 0x44, 0x1F, 0xE0, 0x80, 0x3A, 0xAC, 0xEA,
+  0xAF, 0x2A, 0xC4, 0xC4, 0xA5, 0x31, 0x35, 0xE5, 0x59, 0xF6, 0xE1, 0xF9,
+  0x91, 0xF9, 0xD1, 0x73, 0x81, 0x41, 0x5D, 0x0E, 0x3B, 0x03, 0x1A, 0xCD,
+  0x03, 0xC7, 0xD6, 0xC5, 0x72, 0x9D, 0x80, 0x97, 0xD8, 0x7A, 0xE2, 0x23,
+  0x8E, 0x1B, 0xFC, 0x13, 0x59, 0xFD, 0xE9, 0x7C, 0xCC, 0xA8, 0x13, 0x0E,
+  0x06, 0x4C, 0xBA, 0x4A, 0xD3, 0x6A, 0x58, 0x8D, 0xFA, 0x4C, 0xA0, 0xB1,
+  0x26, 0x3C, 0x74, 0x2D, 0x08, 0x46, 0x48, 0x69, 0x0A, 0xA5, 0xE7, 0xDA,
+  0x7A, 0x04, 0x05, 0x24, 0xF4, 0x68, 0x44, 0x03, 0x35, 0xE8, 0x32, 0xC9,
+  0x0C, 0xE8, 0xC9, 0xD6, 0xAF, 0xA7, 0x13, 0x3C, 0x50, 0x27, 0x10, 0x67,
+  0xE0, 0x50, 0x87, 0xD3, 0x39, 0xFE, 0x46, 0x89, 0x24, 0xF1, 0x83, 0x5A,
+  0x31, 0x66, 0x51, 0x04, 0x89, 0xDA, 0xD6, 0x13, 0x4E, 0xB1, 0x1B, 0xB2,
+  0x75, 0xD8, 0x0F, 0xEE, 0x36, 0xDB, 0x03, 0x35, 0x98, 0xF4, 0x3F, 0xB6,
+  0x7E, 0x85, 0x6D, 0x8E, 0x1A, 0xBD, 0xBF, 0x95, 0xCD, 0xB7, 0xAD, 0x37,
+  0x77, 0xD5, 0xD0, 0x3C, 0x3F, 0xB4, 0x9F, 0xD3, 0x51, 0x5D, 0x5D, 0x11,
+  0xE0, 0x19, 0x3D, 0x7C, 0xB8, 0xDE, 0x1D, 0x41, 0x01, 0xE8, 0x64, 0xA2,
+  0x13, 0xC7, 0xA7, 0x51, 0x64, 0xEB, 0xA2, 0xE7, 0xC2, 0x45, 0x30, 0x99,
+  0x03, 0xC9, 0xAA, 0x74, 0x0A, 0x99, 0x1B, 0xDA, 0xD7, 0x64, 0xBF, 0x41,
+  0xC4, 0xF9, 0x48, 0x40, 0x7D, 0x90, 0x71, 0x8C, 0xAD, 0xC1, 0x8C, 0x46,
+  0xB2, 0xBD, 0xB0, 0x80, 0x28, 0xDF, 0xD7, 0x2E, 0x7D, 0xDC, 0x62, 0xD6,
+  0x30, 0x08, 0xA0, 0x23, 0x16, 0x6D, 0xC2, 0xC7, 0x4B, 0x69, 0x54, 0x42,
+  0x1D, 0x07, 0xB4, 0x20, 0x0F, 0x59, 0x54, 0xFF, 0x20, 0x60, 0x16, 0x3B,
+  0x8F, 0x38, 0x94, 0x7D, 0xCA, 0x47, 0xEF, 0xC4, 0x03, 0xB4, 0x39, 0x46,
+  0x15, 0x63, 0x4B, 0xD7, 0x0B, 0xBA, 0x10, 0x01, 0xFB, 0x4D, 0xBD, 0x08,
+  0x59, 0xBC, 0x16, 0xC0, 0x49, 0x51, 0x8B, 0xA8, 0x23, 0xD5, 0x5C, 0xC7,
+  0x10, 0x92, 0xF1, 0xAA, 0x13, 0x68, 0x5B, 0xC0, 0x05, 0x40, 0x6C, 0xCF,
+  0x75, 0x59, 0x60, 0x22, 0xA0, 0xC4, 0xAB, 0x00, 0x8A, 0x98, 0xD3, 0xAB,
+  0x00, 0x7D, 0xF1, 0x26, 0xA6, 0x84, 0xE1, 0x0C, 0x58, 0x1E, 0x50, 0x81,
+  0x83, 0xA6, 0x2D, 0x67, 0x0B, 0xF7, 0x11, 0xA4, 0x70, 0x88, 0x26, 0x4E,
+  0x9B, 0xA0, 0x31, 0xD5, 0xF7, 0xCB, 0x2E, 0x75, 0x96, 0xB0, 0xAB, 0x13,
+  0xFD, 0x14, 0x77, 0xD9, 0x99, 0x61, 0xEF, 0xE4, 0xA0, 0xB7, 0xD3, 0x25,
+  0xF9, 0x8B, 0x05, 0x71, 0x58, 0xB9, 0x20, 0xD5, 0xE2, 0x2D, 0xC1, 0xAA,
+  0x69, 0x8C, 0xBF, 0x25, 0xC1, 0x85, 0xC1, 0xC8, 0x91, 0xEF, 0x81, 0x79,
+  0x12, 0x36, 0x65, 0x15, 0xC7, 0x82, 0x0C, 0x9E, 0x27, 0x14, 0x20, 0x43,
+  0x77, 0xE6, 0x0D, 0xBC, 0x0F, 0x88, 0x64, 0x09, 0xB5, 0x58, 0xA1, 0xD7,
+  0xF7, 0xCB, 0x0C, 0xFF, 0x3C, 0xF6, 0x8E, 0xB2, 0xF2, 0xB3, 0x89, 0x9D,
+  0x5C, 0xA5, 0xFA, 0x76, 0x8E, 0x64, 0x9D, 0xCA, 0x5C, 0x10, 0x62, 0x4F,
+  0x8C, 0xC8, 0x63, 0x1F, 0x5B, 0x6F, 0x80, 0xA5, 0x1C, 0x1E, 0x42, 0x27,
+  0x10, 0x0C, 0x6D, 0xE8, 0xE8, 0xA4, 0x97, 0xA5, 0xD5, 0x4D, 0xA5, 0x2D,
+  0xDA, 0x87, 0x62, 0xD4, 0xE9, 0xFB, 0x34, 0xF8, 0x8C, 0xD1, 0x2A, 0xA7,
+  0x5F, 0x40, 0x2B, 0x07, 0x97, 0xA7, 0xE4, 0x7F, 0x6C, 0xBE, 0x49, 0x23,
+  0xD0, 0xFB, 0x01, 0xD4, 0x13, 0x94, 0xF1, 0xB5, 0xFE, 0xD8, 0x3A, 0xDE,
+  0x7D, 0x8A, 0xF7, 0xC9, 0xBD, 0xA1, 0x02, 0xC8, 0x1D, 0x9F, 0x80, 0x4E,
+  0xF2, 0xAC, 0x27, 0xC5, 0x28, 0x61, 0x3F, 0xD7, 0xA5, 0xE8, 0x90, 0x96,
+  0x1D, 0xDF, 0x73, 0x3E, 0x8B, 0xD0, 0x4E, 0xEB, 0x5B, 0x0C, 0xDB, 0xA3,
+  0xF2, 0x52, 0x2A, 0xED, 0x51, 0x56, 0x7C, 0x91, 0x28, 0xDA, 0x62, 0x7F,
+  0x8F, 0x26, 0xC2, 0xA5, 0x7B, 0xD6, 0xF4, 0xAC, 0x97, 0x60, 0x74, 0x99,
+  0x5B, 0x13, 0x80, 0xBE, 0x16, 0x38, 0x88, 0x60, 0x63, 0xAF, 0x4E, 0x61,
+  0xA9, 0x10, 0x27, 0x97, 0x76, 0x97, 0xC8, 0x7F, 0x53, 0x40, 0x2A, 0x7A,
+  0x02, 0x1D, 0x91, 0xDB, 0x50, 0x43, 0xB5, 0x96, 0xD5, 0x32, 0x83, 0x07,
+  0x53, 0x68, 0x74, 0x78, 0x89, 0xCE, 0xB0, 0xB3, 0xFB, 0x9E, 0xA1, 0x99,
+  0x64, 0x0C, 0xA8, 0x91, 0xB2, 0xA4, 0x40, 0x73, 0x48, 0x0C, 0xD5, 0xF9,
+  0x3E, 0x9F, 0x55, 0x68, 0x42, 0x9F, 0xEE, 0xA9, 0xDF, 0xE4, 0xB7, 0x6F,
+  0x8E, 0xDF, 0x9E, 0xB4, 0xBE, 0xA3, 0xDF, 0xF6, 0x3E, 0xF4, 0xCE, 0x43,
+  0x97, 0xAD, 0xF7, 0xD9, 0x5C, 0xCF, 0x26, 0x7D, 0x35, 0xDF, 0xD5, 0x3D,
+  0xD7, 0x47, 0x81, 0x22, 0x41, 0x92, 0xE5, 0xFE, 0x99, 0x92, 0xDA, 0x20,
+  0x32, 0x51, 0x37, 0xA5, 0x1B, 0xCC, 0x0E, 0xB4, 0x4E, 0x70, 0x13, 0x6A,
+  0x8C, 0xA0, 0xC0, 0x57, 0xD7, 0xB9, 0x91, 0x5C, 0x70, 0x13, 0x6E, 0xF6,
+  0x05, 0x40, 0x8A, 0x38, 0x57, 0x39, 0x40, 0xA2, 0x84, 0xEC, 0xDA, 0x17,
+  0xCB, 0x5E, 0x7D, 0x13, 0xCA, 0x9B, 0xF0, 0xF9, 0x08, 0x5F, 0xCE, 0xCF,
+  0x8E, 0x9B, 0xC7, 0xCD, 0x93, 0xE6, 0x37, 0xF9, 0x59, 0x82, 0x3D, 0x3D,
+  0x19, 0x93, 0x57, 0x4E, 0xA4, 0xF4, 0x2A, 0x72, 0x83, 0x57, 0xCA, 0x33,
+  0x4C, 0x15, 0xB4, 0xCF, 0x75, 0xB0, 0x2B, 0xB1, 0x38, 0x39, 0xAC, 0x2F,
+  0xBA, 0xD9, 0x7F, 0xC2, 0xBD, 0xDA, 0x9B, 0xAC, 0x8F, 0xA9, 0xE2, 0x06,
+  0x46, 0x35, 0x7E, 0x0B, 0x3B, 0x9D, 0xE7, 0x4A, 0x7E, 0x24, 0xD7, 0x7F,
+  0x17, 0x91, 0x0B, 0x0C, 0x22, 0xD3, 0x4F, 0x53, 0xC2, 0xB5, 0x82, 0xFC,
+  0x0A, 0x31, 0x08, 0x52, 0x29, 0x37, 0xE3, 0x37, 0xB9, 0x7A, 0xFB, 0xA4,
+  0x79, 0x7C, 0xD4, 0x7D, 0x89, 0xBA, 0x87, 0x47, 0x61, 0x51, 0x5A, 0x46,
+  0x48, 0x34, 0x0A, 0x67, 0x41, 0x8D, 0x34, 0xC4, 0xA9, 0x5E, 0x24, 0x0E,
+  0xBE, 0x10, 0xA2, 0xFA, 0x84, 0xEA, 0xF5, 0xB4, 0x74, 0xA6, 0xFA, 0xDF,
+  0xCD, 0x69, 0xAC, 0xD9, 0x1A, 0x11, 0x7C, 0x8B, 0xC1, 0xA0, 0x91, 0x9F,
+  0x72, 0xB6, 0x39, 0xA7, 0x21, 0x9F, 0x0A, 0xFB, 0xF3, 0xD2, 0x10, 0x9E,
+  0x24, 0x89, 0x0E, 0x73, 0x4C, 0xEF, 0x6D, 0xBD, 0xBD, 0xD3, 0x68, 0x6C,
+  0x48, 0x75, 0x48, 0xE9, 0x26, 0x63, 0xED, 0x45, 0xA8, 0xAD, 0x56, 0xC4,
+  0xD6, 0xEE, 0x88, 0x70, 0xD8, 0x8B, 0x6D, 0x56, 0x99, 0xDA, 0x6F, 0xE2,
+  0xA9, 0xE6, 0x34, 0x7A, 0x9A, 0xC2, 0x2E, 0xC3, 0xCB, 0xFF, 0x40, 0x59,
+  0xD7, 0x82, 0xA3, 0x17, 0x21, 0x54, 0x5A, 0x28, 0x24, 0x75, 0x85, 0x5D,
+  0xBD, 0xC2, 0x49, 0x5F, 0xA8, 0xA4, 0xF8, 0x93, 0xFB, 0x38, 0xF1, 0x2A,
+  0x8E, 0x14, 0x6F, 0x3F, 0x0A, 0xBB, 0xBC, 0xB6, 0x64, 0x40, 0x4A, 0x13,
+  0x4D, 0xFB, 0x63, 0x0F, 0x98, 0x14, 0x47, 0x71, 0xB6, 0x8E, 0xFD, 0x13,
+  0xB9, 0x66, 0x71, 0x0C, 0xE9, 0x25, 0x42, 0x57, 0xAF, 0x63, 0x3E, 0x2A,
+  0x9A, 0x25, 0x7B, 0x93, 0xA4, 0x62, 0x01, 0x4F, 0x17, 0x24, 0x57, 0x65,
+  0x3C, 0x8A, 0x17, 0x31, 0x4F, 0xE2, 0x32, 0x97, 0x8E, 0x17, 0x6E, 0x54,
+  0xA0, 0x64, 0xA8, 0x3B, 0x14, 0x39, 0xB2, 0x57, 0x97, 0xB8, 0x0B, 0x19,
+  0x06, 0x7E, 0xA6, 0xD9, 0x4B, 0xBC, 0x6A, 0x70, 0x21, 0xEA, 0x93, 0x47,
+  0x44, 0xE2, 0x36, 0x50, 0x27, 0x23, 0xCE, 0x06, 0xB0, 0xC9, 0x9F, 0x4E,
+  0x5C, 0x28, 0x40, 0x90, 0xF5, 0x5E, 0x9A, 0x6F, 0x7D, 0xFF, 0x37, 0x81,
+  0x5A, 0x6D, 0xCC, 0x15, 0x97, 0x98, 0x1A, 0x17, 0x38, 0xDD, 0x44, 0x98,
+  0xE4, 0x1F, 0xF2, 0x7C, 0x85, 0xF6, 0x58, 0x51, 0x77, 0x2C, 0x26, 0xE7,
+  0xE2, 0x78, 0xE6, 0x2B, 0x35, 0xB7, 0x70, 0xB1, 0x9E, 0x2A, 0x32, 0x3D,
+  0xD2, 0x94, 0xD5, 0x27, 0xFB, 0xFA, 0x3D, 0x54, 0x7B, 0x93, 0x60, 0x2F,
+  0x57, 0x6C, 0xF9, 0x87, 0x3A, 0xF7, 0x4A, 0xCE, 0xC3, 0xEA, 0x75, 0x72,
+  0xC4, 0xF1, 0x94, 0xBD, 0x83, 0x07, 0xD9, 0x6C, 0x1A, 0x7D, 0x21, 0x57,
+  0xF3, 0xBE, 0xF3, 0x05, 0xA4, 0x72, 0xD4, 0xDD, 0xC4, 0xC9, 0x6F, 0x67,
+  0x67, 0xB7, 0xBD, 0x83, 0xEB, 0xF7, 0xB7, 0x07, 0x57, 0x57, 0x07, 0x7F,
+  0x10, 0x9B, 0xB4, 0x76, 0xDB, 0x5D, 0x35, 0xF9, 0xF1, 0xE0, 0xEA, 0xC3,
+  0xE9, 0x87, 0x77, 0xB7, 0x37, 0xEF, 0xAF, 0x8E, 0xAF, 0xDF, 0x5F, 0x9C,
+  0xF5, 0x60, 0xBA, 0xD9, 0x48, 0x66, 0x0F, 0xCE, 0x8E, 0xAF, 0x6E, 0x0A,
+  0x73, 0xDB, 0xC9, 0xD4, 0xD1, 0xC5, 0xD9, 0xC5, 0xD5, 0xED, 0xD1, 0x45,
+  0xEF, 0xF8, 0x1A, 0x86, 0xF1, 0xAA, 0x60, 0x10, 0x76, 0xB2, 0x4B, 0x50,
+  0x5D, 0x5C, 0xC4, 0xEA, 0xDA, 0x63, 0x4D, 0x9B, 0xC9, 0xFB, 0xBA, 0xE5,
+  0xC9, 0x9A, 0x16, 0x83, 0xDA, 0xA1, 0x86, 0xF9, 0x6E, 0x67, 0x99, 0x11,
+  0x5C, 0x4A, 0x7D, 0xC6, 0xE3, 0x0D, 0x0B, 0x17, 0x78, 0xC4, 0x1B, 0x89,
+  0x84, 0xC7, 0x9B, 0xD3, 0xF3, 0xE3, 0xDB, 0xB3, 0xD3, 0xF3, 0xD3, 0x1B,
+  0x14, 0xBA, 0x81, 0xD7, 0xFD, 0xB1, 0x78, 0x4E, 0x70, 0xE6, 0x41, 0x92,
+  0x80, 0xB1, 0x0C, 0x40, 0xCE, 0xE1, 0xC9, 0xE1, 0x25, 0xD8, 0x57, 0x5C,
+  0x9E, 0x34, 0xB2, 0xB1, 0x33, 0x36, 0x10, 0xE0, 0xC9, 0xD2, 0x6C, 0x86,
+  0x9F, 0x26, 0x7B, 0x3B, 0x9B, 0xE0, 0x65, 0x9B, 0x9C, 0x49, 0x6F, 0x86,
+  0x2F, 0xA1, 0xC0, 0x89, 0x7B, 0x6B, 0x98, 0xCE, 0x69, 0xCC, 0x42, 0x6D,
+  0x59, 0x8E, 0xBC, 0xD0, 0x4E, 0xEF, 0xA8, 0xC2, 0x00, 0x09, 0x44, 0xBF,
+  0x4D, 0x0C, 0xAC, 0xEB, 0xC7, 0xF9, 0x5B, 0x39, 0x6F, 0xB0, 0x3C, 0xB6,
+  0xEA, 0xF8, 0xBA, 0x08, 0xB8, 0x74, 0x78, 0xAF, 0x4E, 0xEA, 0x57, 0x1F,
+  0xFD, 0x8B, 0xB3, 0xD4, 0x92, 0x75, 0xEA, 0x5C, 0xFF, 0x51, 0x53, 0x77,
+  0x77, 0xE9, 0x7A, 0xC0, 0x27, 0x62, 0xCB, 0x82, 0xD6, 0x2A, 0xA4, 0xAE,
+  0xA1, 0x2E, 0x21, 0xF1, 0x62, 0xC8, 0xF1, 0x19, 0x4D, 0x55, 0x64, 0x14,
+  0x14, 0x56, 0xBC, 0x96, 0xCC, 0x5D, 0xA9, 0xC6, 0x89, 0x96, 0x0F, 0xF8,
+  0xB0, 0x46, 0x96, 0xC4, 0x2E, 0xB3, 0x07, 0xFC, 0x9E, 0x5F, 0xF5, 0x7C,
+  0xD9, 0x36, 0xEA, 0x44, 0x9C, 0xBC, 0xAE, 0x56, 0xCA, 0x06, 0x7A, 0x5E,
+  0x10, 0x30, 0x8E, 0x2F, 0xDD, 0x61, 0xC9, 0xA7, 0x62, 0xF1, 0x49, 0x1F,
+  0x09, 0x88, 0x07, 0xE8, 0x77, 0xC3, 0xE5, 0x09, 0xF1, 0x86, 0x04, 0x2A,
+  0x9A, 0xC7, 0x66, 0x87, 0x21, 0x14, 0x57, 0x7C, 0x99, 0x02, 0x55, 0x17,
+  0xFF, 0xEA, 0xE4, 0x7E, 0xEC, 0x07, 0x91, 0xBC, 0x01, 0xE8, 0xD4, 0xEB,
+  0xB3, 0xD9, 0xCC, 0x9A, 0xB5, 0xAD, 0x90, 0x0F, 0xEB, 0xF8, 0x6E, 0xB0,
+  0x8E, 0x0B, 0x01, 0x6D, 0x29, 0x52, 0xF9, 0xD8, 0x04, 0xA7, 0xD5, 0xB3,
+  0x93, 0x12, 0x98, 0xFC, 0xF3, 0x12, 0xE8, 0x07, 0x80, 0xF8, 0x36, 0xD0,
+  0x74, 0xE6, 0xF2, 0x93, 0xDB, 0xFA, 0xD6, 0x36, 0x9E, 0xDC, 0x49, 0x04,
+  0x80, 0x09, 0xE1, 0x35, 0x4C, 0x9C, 0x19, 0x12, 0xB3, 0xF8, 0x54, 0x42,
+  0x4F, 0xDE, 0x93, 0xB8, 0x34, 0x1A, 0x51, 0xCE, 0x29, 0xE0, 0x82, 0x74,
+  0xA4, 0x6B, 0xAB, 0xA8, 0x67, 0xAF, 0x53, 0x5E, 0x3D, 0x2C, 0x87, 0xD5,
+  0xA3, 0xAE, 0x01, 0x35, 0xED, 0x9C, 0x6C, 0x37, 0x6A, 0xF0, 0x57, 0x1B,
+  0x13, 0x73, 0x6B, 0x1B, 0x1A, 0x62, 0x8D, 0x12, 0xF8, 0xDC, 0xDA, 0x46,
+  0x55, 0xD5, 0x1A, 0xE4, 0x6D, 0xA3, 0xB6, 0x38, 0x64, 0x8A, 0x31, 0x5D,
+  0x03, 0xF6, 0x91, 0x0E, 0xA6, 0xD6, 0x21, 0xFE, 0x00, 0x95, 0xA1, 0x21,
+  0x26, 0x34, 0x20, 0x0B, 0x82, 0x88, 0xAD, 0x80, 0x5E, 0xA6, 0x26, 0x39,
+  0xB3, 0xFF, 0xEA, 0x01, 0x9B, 0x0B, 0x2A, 0xDC, 0xD8, 0x48, 0xFD, 0x54,
+  0xAB, 0x3E, 0x02, 0x56, 0xC0, 0x97, 0x26, 0xF1, 0x4F, 0x5D, 0x6D, 0x31,
+  0x75, 0x40, 0x41, 0x4B, 0xA3, 0xC4, 0xA8, 0xCA, 0x9B, 0x65, 0xBC, 0x98,
+  0xCD, 0x9C, 0xDD, 0xB6, 0xF1, 0xC9, 0xD5, 0x83, 0xB6, 0x2A, 0x49, 0xE4,
+  0x02, 0xB3, 0x90, 0xC5, 0x72, 0x5F, 0x7E, 0x81, 0xD4, 0xDE, 0x2D, 0x8F,
+  0x1F, 0x33, 0x07, 0xB7, 0xC6, 0x9B, 0x97, 0xB4, 0x51, 0x74, 0xED, 0x72,
+  0xF1, 0xF1, 0x45, 0x44, 0x7C, 0x24, 0x5C, 0xA4, 0x97, 0x18, 0xDD, 0x90,
+  0xA3, 0x57, 0x4B, 0x06, 0x4D, 0x25, 0x96, 0x6F, 0x25, 0x6A, 0xC9, 0xBD,
+  0x6B, 0x2E, 0x55, 0xE4, 0xA8, 0x20, 0x70, 0x35, 0xBD, 0x84, 0x4F, 0xAE,
+  0x98, 0x0B, 0x77, 0xBA, 0xB1, 0xBC, 0x1D, 0x16, 0xD7, 0xC2, 0x98, 0x9A,
+  0x93, 0xAD, 0x93, 0xD4, 0x0C, 0xF9, 0x09, 0x66, 0xE4, 0x43, 0x86, 0x64,
+  0x62, 0x0F, 0x48, 0x8A, 0x47, 0x1E, 0x29, 0xE0, 0xA7, 0xC6, 0xAB, 0x07,
+  0xF5, 0xED, 0xF1, 0x13, 0xB2, 0xC2, 0x19, 0x6C, 0x24, 0x02, 0xF2, 0xE9,
+  0xD5, 0x83, 0x22, 0xF9, 0xD8, 0x59, 0x80, 0xC8, 0x3D, 0xF1, 0x58, 0x2B,
+  0x64, 0xCA, 0xFB, 0x03, 0x11, 0xB5, 0xAE, 0x46, 0x54, 0xB5, 0xC4, 0x7F,
+  0x9F, 0x32, 0x08, 0xC9, 0x63, 0xB1, 0x6E, 0x74, 0x8B, 0x4E, 0xB1, 0x67,
+  0xCB, 0x55, 0x56, 0x5A, 0x0E, 0xF3, 0x75, 0x41, 0x5B, 0x67, 0xBE, 0x85,
+  0xA8, 0xAC, 0x6A, 0x96, 0xF0, 0x6B, 0xBC, 0xBD, 0x84, 0x34, 0x3E, 0x0E,
+  0xEF, 0x98, 0xA1, 0x38, 0x91, 0x65, 0xAA, 0xDA, 0xFD, 0x76, 0xBC, 0xB0,
+  0xCB, 0x37, 0x24, 0xBF, 0x09, 0xCA, 0xDC, 0x13, 0x84, 0xBC, 0x50, 0x09,
+  0xE5, 0xEF, 0x22, 0x56, 0x56, 0x7A, 0x5F, 0x4A, 0xA6, 0x45, 0x45, 0x15,
+  0xDE, 0xF8, 0x38, 0xD4, 0x77, 0xA6, 0xF8, 0xBA, 0x11, 0x1D, 0xF6, 0x84,
+  0xCB, 0x7B, 0x39, 0x23, 0x33, 0x3C, 0xA7, 0xB3, 0xFC, 0x4C, 0x52, 0xC9,
+  0x50, 0x13, 0xF5, 0x7C, 0xC3, 0xA1, 0x7C, 0x6E, 0x11, 0xDC, 0x24, 0x46,
+  0x33, 0x0F, 0x58, 0x25, 0xAF, 0x71, 0xC4, 0x5C, 0x04, 0xAC, 0x2E, 0x7A,
+  0xE5, 0x52, 0x40, 0xA6, 0x1C, 0x39, 0xC5, 0x19, 0x0C, 0x80, 0x57, 0x0F,
+  0x86, 0xB6, 0x4A, 0x90, 0xD7, 0x8B, 0x0D, 0xA6, 0x56, 0xB5, 0xE2, 0xF0,
+  0xC4, 0xBB, 0x67, 0xAE, 0xD1, 0xA8, 0x3E, 0x62, 0xB3, 0xF9, 0xE9, 0xAB,
+  0x15, 0x0D, 0x8C, 0x1E, 0xC4, 0x31, 0xF7, 0xA0, 0x3F, 0x66, 0x86, 0xBE,
+  0x58, 0x3A, 0xF4, 0xDA, 0x22, 0xB3, 0x55, 0xF5, 0xB2, 0x2D, 0xBB, 0x2D,
+  0x16, 0xFF, 0xAE, 0xEC, 0xFF, 0xB6, 0x4F, 0xF2, 0x4F, 0x6F, 0x36, 0x00,
+  0x00,
+};
+
+#endif
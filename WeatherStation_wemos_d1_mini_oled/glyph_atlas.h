@@ -0,0 +1,9 @@
+// Generated by tools/generate_assets.py from the U8g2 fonts, do not edit.
+// Glyphs are uncompressed SH1106 pages, look them up through CGlyphAtlas.
+#ifndef _GLYPH_ATLAS_H_
+#define _GLYPH_ATLAS_H_
+
+// U8g2 was not found, the atlas is empty and the display draws the
+// glyphs with the fonts through u8g2.
+
+#endif
@@ -211,6 +211,7 @@ bool ESPConnectClass::begin(AsyncWebServer* server, unsigned long timeout){
 
     // Check WiFi connection status till timeout
     unsigned long lastMillis = millis();
+    unsigned long lastProgressMillis = lastMillis;
     while(WiFi.status() != WL_CONNECTED && (unsigned long)(millis() - lastMillis) < timeout){
       
       if(_wifiStatusUpdateCb)
@@ -218,8 +219,11 @@ bool ESPConnectClass::begin(AsyncWebServer* server, unsigned long timeout){
         _wifiStatusUpdateCb();
       }
       
-      Serial.print("#");
-      delay(500);
+      if((unsigned long)(millis() - lastProgressMillis) >= ESPCONNECT_PROGRESS_INTERVAL){
+        lastProgressMillis = millis();
+        Serial.print("#");
+      }
+      delay(ESPCONNECT_STATUS_POLL_INTERVAL);
       yield();
     }
     Serial.print("]\n");
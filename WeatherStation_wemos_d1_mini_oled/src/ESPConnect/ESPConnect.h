@@ -25,6 +25,9 @@
 
 #define DEFAULT_CONNECTION_TIMEOUT 30000
 #define DEFAULT_PORTAL_TIMEOUT 180000
+// The status callback runs this often while connecting, it paces itself
+#define ESPCONNECT_STATUS_POLL_INTERVAL 20
+#define ESPCONNECT_PROGRESS_INTERVAL 500
 
 
 #if ESPCONNECT_DEBUG == 1
@@ -1,816 +1,716 @@
+// Generated by tools/generate_assets.py from assets/, do not edit.
+// Bitmaps are run length compressed SH1106 pages, draw them through CWeatherDisplay::DrawPageBitmap.
 #ifndef _WEATHER_ICONS_H_
 #define _WEATHER_ICONS_H_
 
 #define WEATHER_ICON_W 56
 #define WEATHER_ICON_H 56
 
+// 392 -> 192 bytes
 static const unsigned char thunder_light_rain_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 
-  0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0x3F, 0x00, 0x9F, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 0x8F, 0xFF, 
-  0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xF8, 0x8F, 0xFF, 
-  0x83, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0xC7, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0x80, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xE3, 0x7F, 0x88, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0x3F, 0x8C, 
-  0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0x1F, 0x8E, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 
-  0x0F, 0x8F, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0x8F, 0x8F, 0xFF, 0xF1, 0xFF, 
-  0xC7, 0xC7, 0xC7, 0x0F, 0xC0, 0xF1, 0xFF, 0xC7, 0xC7, 0xE3, 0x0F, 0xE0, 
-  0xF1, 0xFF, 0xE3, 0xEF, 0x01, 0x0E, 0xF0, 0xF1, 0xF8, 0xE1, 0xFF, 0x00, 
-  0xFE, 0xF8, 0xF1, 0xF8, 0xF0, 0x7F, 0x00, 0x7E, 0xFC, 0xF1, 0x38, 0xF0, 
-  0xFF, 0x3F, 0x3E, 0xFC, 0xFF, 0x38, 0xF8, 0xFF, 0x3F, 0x1E, 0xFE, 0xFF, 
-  0x38, 0xFE, 0xFF, 0x3F, 0x1E, 0xFF, 0xFF, 0xB8, 0xFF, 0xFF, 0x3F, 0x8E, 
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0xC6, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0x3F, 0xC2, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0xE3, 0xF1, 0xF8, 
-  0xFF, 0xFF, 0x3F, 0xF0, 0xE3, 0xF1, 0xF8, 0xFF, 0xFF, 0x3F, 0xF8, 0xE3, 
-  0xF1, 0xF8, 0xFF, 0xFF, 0x3F, 0xFC, 0xE3, 0xFF, 0xF8, 0xFF, 0xFF, 0x3F, 
-  0xFC, 0xE3, 0xFF, 0xF8, 0xFF, 0xFF, 0x3F, 0xFE, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xF0, 0x2C, 0xC1, 0x11, 0x36, 0x35, 0x34, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x36, 0x35, 0x36, 0x45, 0x35, 0x26, 0x9E, 0x13, 0x27, 0x26, 0x26, 0x26,
+  0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0xA6, 0x12, 0x27, 0x63,
+  0x63, 0x53, 0x54, 0x63, 0x72, 0x81, 0x25, 0x86, 0x22, 0x66, 0x62, 0x62,
+  0x72, 0x71, 0x81, 0x2C, 0x71, 0x62, 0x62, 0x53, 0x44, 0x35, 0x11, 0x24,
+  0x21, 0x23, 0x31, 0x13, 0x41, 0x44, 0x54, 0x63, 0x72, 0x31, 0x44, 0x44,
+  0x44, 0x53, 0x13, 0x31, 0x13, 0x22, 0x13, 0x13, 0x13, 0x27, 0x36, 0x35,
+  0x45, 0x54, 0x63, 0x72, 0x91, 0x11, 0x17, 0x17, 0x27, 0x36, 0x35, 0x45,
+  0x55, 0x54, 0x54, 0x35, 0x17, 0xDA, 0x31, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x4B, 0x71, 0x62, 0x62, 0x53, 0x44, 0x35, 0xA6, 0x2F, 0x62, 0x28, 0x62,
+  0xF9, 0x31, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3D, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0xB3, 0x2C, 0x51, 0x43, 0x14, 0x1D, 0x42, 0x14, 0xCF, 0x31, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x3D, 0x33, 0x11, 0x33, 0x35, 0x35, 0x55, 0xC3,
+  0x1B, 0x31, 0x35, 0x35, 0x44, 0x53, 0x43, 0x53, 0x53, 0x43, 0x43, 0x44,
+  0x53, 0x53, 0x62, 0xF1, 0x3A, 0x71, 0x53, 0x44, 0x54, 0x54, 0x63, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x43, 0x43, 0x34, 0x44, 0x44, 0x53, 0xF1, 0x2C,
+};
 
+// 392 -> 202 bytes
 static const unsigned char thunder_rain_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 
-  0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0x3F, 0x00, 0x9F, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 0x8F, 0xFF, 
-  0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xF8, 0x8F, 0xFF, 
-  0x83, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0xC7, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0x80, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xE3, 0x7F, 0x88, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0x3F, 0x8C, 
-  0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0x1F, 0x8E, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 
-  0x0F, 0x8F, 0xFF, 0x8F, 0xFF, 0xC7, 0xE3, 0x8F, 0x8F, 0xFF, 0x8F, 0xFF, 
-  0xC7, 0xC7, 0xC7, 0x0F, 0xC0, 0xC7, 0xFF, 0xC7, 0xC7, 0xE3, 0x0F, 0xE0, 
-  0xC7, 0xE3, 0xE3, 0xEF, 0x01, 0x0E, 0xF0, 0xC7, 0xE3, 0xE1, 0xFF, 0x00, 
-  0xFE, 0xF8, 0xE3, 0xF1, 0xF0, 0x7F, 0x00, 0x7E, 0xFC, 0xE3, 0x71, 0xF0, 
-  0xFF, 0x3F, 0x3E, 0xFC, 0xE3, 0x71, 0xF8, 0xFF, 0x3F, 0x1E, 0xFE, 0xF1, 
-  0x78, 0xFE, 0xFF, 0x3F, 0x1E, 0xFF, 0xF1, 0xF8, 0xFF, 0xFF, 0x3F, 0x8E, 
-  0xFF, 0xF1, 0xF8, 0xFF, 0xFF, 0x3F, 0xC6, 0xFF, 0x78, 0xFC, 0xFF, 0xFF, 
-  0x3F, 0xC2, 0xF1, 0x78, 0xFC, 0xFF, 0xFF, 0x3F, 0xE0, 0xF1, 0x78, 0xFC, 
-  0xFF, 0xFF, 0x3F, 0xF0, 0x78, 0x3C, 0xFE, 0xFF, 0xFF, 0x3F, 0xF8, 0xF8, 
-  0x3F, 0xFE, 0xFF, 0xFF, 0x3F, 0xFC, 0xF8, 0x3F, 0xFE, 0xFF, 0xFF, 0x3F, 
-  0x7C, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xF0, 0x2C, 0xC1, 0x11, 0x36, 0x35, 0x34, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x36, 0x35, 0x36, 0x45, 0x35, 0x26, 0x9E, 0x13, 0x27, 0x26, 0x26, 0x26,
+  0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0xA6, 0x12, 0x27, 0x63,
+  0x63, 0x53, 0x54, 0x63, 0x72, 0x81, 0x25, 0x86, 0x22, 0x66, 0x62, 0x62,
+  0x72, 0x71, 0x81, 0x2C, 0x71, 0x52, 0x63, 0x53, 0x44, 0x35, 0x11, 0x24,
+  0x21, 0x23, 0x31, 0x13, 0x41, 0x44, 0x54, 0x63, 0x72, 0x31, 0x44, 0x44,
+  0x44, 0x53, 0x13, 0x31, 0x13, 0x22, 0x13, 0x13, 0x13, 0x27, 0x36, 0x35,
+  0x45, 0x54, 0x63, 0x72, 0x91, 0x11, 0x17, 0x17, 0x27, 0x36, 0x35, 0x45,
+  0x55, 0x54, 0x54, 0x35, 0x17, 0xE8, 0x21, 0x36, 0x35, 0x35, 0x14, 0x31,
+  0x35, 0x3C, 0x71, 0x62, 0x62, 0x53, 0x44, 0x35, 0xA6, 0x2F, 0x62, 0x28,
+  0x62, 0xDD, 0x31, 0x26, 0x46, 0x54, 0x44, 0x44, 0x14, 0x31, 0x35, 0x35,
+  0x36, 0x35, 0x35, 0x36, 0x35, 0x35, 0x36, 0x35, 0xB8, 0x12, 0x35, 0x44,
+  0xD1, 0x21, 0x44, 0xF1, 0x1E, 0x71, 0x71, 0x71, 0x62, 0x62, 0x62, 0x53,
+  0x53, 0x43, 0x11, 0x33, 0x11, 0x33, 0x11, 0x63, 0x53, 0xA3, 0x1A, 0x31,
+  0x35, 0x35, 0x44, 0x53, 0x43, 0x53, 0x53, 0x43, 0x43, 0x44, 0x53, 0x53,
+  0x62, 0xF1, 0x3A, 0x71, 0x53, 0x44, 0x54, 0x54, 0x63, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x43, 0x43, 0x34, 0x44, 0x44, 0x53, 0xF1, 0x2C,
+};
 
+// 392 -> 166 bytes
 static const unsigned char thunder_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 
-  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 
-  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x3F, 0xFE, 0xFF, 0xFE, 0xE3, 0xFF, 0xFF, 0x03, 0xFF, 0x7F, 0xFE, 0xC7, 
-  0xFF, 0xFF, 0x00, 0xFF, 0x3F, 0xFE, 0xC7, 0xFF, 0x3F, 0x00, 0xFF, 0x1F, 
-  0xFE, 0x87, 0xFF, 0x1F, 0xFC, 0xFF, 0x0F, 0xFE, 0x07, 0xFE, 0x0F, 0xFF, 
-  0xFF, 0x0F, 0xFE, 0x07, 0xF8, 0x8F, 0xFF, 0xFF, 0x07, 0xFE, 0x7F, 0xF0, 
-  0xC7, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xF0, 0xC7, 0xFF, 0xFF, 0x21, 0xFE, 
-  0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 0x30, 0xFE, 0xFF, 0xE3, 0xE3, 0xFF, 0x7F, 
-  0x38, 0xFE, 0xFF, 0xC7, 0xE3, 0xFF, 0x3F, 0x3C, 0xFE, 0xFF, 0xC7, 0xE3, 
-  0xFF, 0x3F, 0x3E, 0xFE, 0xFF, 0xC7, 0xE3, 0xFF, 0x1F, 0x3F, 0x00, 0xFF, 
-  0xC7, 0xE3, 0xFF, 0x8F, 0x3F, 0x80, 0xFF, 0xC7, 0xC7, 0xFF, 0x07, 0x38, 
-  0xC0, 0xFF, 0xC7, 0xC7, 0xFF, 0x03, 0xF8, 0xE3, 0xFF, 0xE3, 0x8F, 0xFF, 
-  0x01, 0xF8, 0xF1, 0xFF, 0xE1, 0x0F, 0xFF, 0xFF, 0xF8, 0xF0, 0xFF, 0xF0, 
-  0x1F, 0xFC, 0xFF, 0x78, 0xF8, 0x7F, 0xF0, 0x3F, 0x00, 0xE0, 0x78, 0x3C, 
-  0x00, 0xF8, 0xFF, 0x00, 0xE0, 0x38, 0x1E, 0x00, 0xFE, 0xFF, 0x03, 0xE0, 
-  0x18, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xE0, 0x2A, 0x52, 0x43, 0x44, 0x43, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x63, 0x53, 0x63, 0x53, 0x54, 0x63, 0xA2, 0x4C, 0x38, 0xEE, 0x21,
+  0x86, 0x22, 0x66, 0x62, 0x62, 0x72, 0x71, 0x81, 0x3D, 0x35, 0x35, 0xC5,
+  0x72, 0x62, 0x53, 0x34, 0x36, 0x26, 0x26, 0x17, 0x98, 0x11, 0x17, 0x17,
+  0x27, 0x36, 0x35, 0x45, 0x55, 0x54, 0x54, 0x35, 0x17, 0xD8, 0x11, 0x27,
+  0x36, 0x45, 0x44, 0x54, 0x63, 0x72, 0x31, 0x71, 0x62, 0x53, 0x44, 0x44,
+  0x35, 0x35, 0x35, 0x23, 0x26, 0x36, 0x45, 0x54, 0x63, 0x22, 0x41, 0x21,
+  0x62, 0x53, 0x44, 0x44, 0x35, 0x26, 0x17, 0x98, 0x21, 0x86, 0x22, 0xC6,
+  0x2D, 0x45, 0x45, 0x55, 0x54, 0x63, 0x33, 0x26, 0x17, 0x19, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x6E, 0x51,
+  0x43, 0x14, 0x1D, 0x42, 0x14, 0xDF, 0x72, 0x81, 0x72, 0xF1, 0x1C, 0x31,
+  0x35, 0x35, 0x44, 0x53, 0x43, 0x53, 0x53, 0x43, 0x43, 0x44, 0x53, 0x53,
+  0x62, 0xF1, 0x3A, 0x71, 0x53, 0x44, 0x54, 0x54, 0x63, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x43, 0x43, 0x34, 0x44, 0x44, 0x53, 0xF1, 0x2D,
+};
 
+// 392 -> 156 bytes
 static const unsigned char light_rain_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x83, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
-  0xF8, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 
-  0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 
-  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xC7, 0xE3, 0xFF, 0xF8, 0x3F, 0xFE, 0xFF, 0xC7, 0xE3, 0xFF, 0xF8, 0x3F, 
-  0xFE, 0xFF, 0xC7, 0xC7, 0xFF, 0xF8, 0x3F, 0xFE, 0xFF, 0xC7, 0xC7, 0xFF, 
-  0x78, 0x3C, 0x1E, 0xFF, 0xE3, 0x8F, 0xFF, 0x78, 0x3C, 0x1E, 0xFF, 0xE1, 
-  0x0F, 0xFF, 0x78, 0x3C, 0x1E, 0xFF, 0xF0, 0x1F, 0xFC, 0x7F, 0xFC, 0x1F, 
-  0x7F, 0xF0, 0x3F, 0xE0, 0x7F, 0xFC, 0x1F, 0x07, 0xF8, 0xFF, 0xE0, 0x7F, 
-  0xFC, 0x1F, 0x07, 0xFE, 0xFF, 0xE3, 0xF8, 0x3F, 0xFE, 0x87, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFE, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x78, 0x3C, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x3C, 
-  0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x3C, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xE0, 0x29, 0x52, 0x43, 0x44, 0x43, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x63, 0x53, 0x63, 0x53, 0x54, 0x63, 0xA2, 0x4C, 0x33, 0x35, 0x35,
+  0xE2, 0x1E, 0x62, 0x28, 0x62, 0x26, 0x26, 0x26, 0x17, 0x17, 0xDF, 0x12,
+  0x17, 0x47, 0x44, 0x44, 0x44, 0x35, 0x35, 0x1C, 0x71, 0x71, 0x44, 0x44,
+  0x44, 0x54, 0x53, 0xD3, 0x1C, 0x71, 0x71, 0x71, 0x62, 0x53, 0x53, 0x54,
+  0x45, 0x45, 0x55, 0x73, 0x81, 0x1E, 0x62, 0x62, 0x62, 0x42, 0x44, 0x44,
+  0x62, 0x62, 0x62, 0x64, 0x62, 0x62, 0x42, 0x44, 0x44, 0x62, 0x62, 0x62,
+  0x82, 0x2D, 0x62, 0x28, 0x62, 0xDD, 0x31, 0x35, 0x45, 0x44, 0x44, 0x44,
+  0x17, 0x17, 0x1C, 0x53, 0x53, 0x44, 0x44, 0x44, 0x74, 0x71, 0xE1, 0x2B,
+  0x51, 0x43, 0x14, 0x1D, 0x42, 0x14, 0xEA, 0x42, 0x54, 0x53, 0x17, 0xCF,
+  0x11, 0x53, 0x53, 0x43, 0x34, 0x35, 0x34, 0x35, 0x35, 0x34, 0x44, 0x34,
+  0x35, 0x25, 0x16, 0xAF, 0x13, 0x37, 0x45, 0x44, 0x45, 0x35, 0x36, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x34, 0x44, 0x43, 0x44, 0x34, 0x15, 0xEF, 0x02,
+};
 
+// 392 -> 212 bytes
 static const unsigned char light_rain_day_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xBF, 0xFF, 0xE3, 0xFF, 0xFE, 0xFF, 0xFF, 0x1F, 0xFF, 0xE3, 0x7F, 
-  0xFC, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0x1F, 0xFC, 
-  0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 
-  0x7F, 0xFC, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xBE, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x3E, 
-  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xC7, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xC7, 0x01, 0xFF, 0x3F, 0x00, 0xC0, 
-  0xFF, 0xC7, 0x01, 0xFF, 0x1F, 0xF8, 0x81, 0xFF, 0xC7, 0x01, 0xFF, 0x0F, 
-  0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFE, 0xC3, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0x3F, 0xFC, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0x7F, 0xFC, 
-  0xE1, 0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0xF8, 0xF0, 0xFF, 0x1F, 0xF0, 0xFF, 
-  0xFF, 0xF8, 0xF8, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xF0, 0xFD, 0xFF, 0x83, 
-  0xFF, 0xFF, 0xFF, 0xC1, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x81, 0x1F, 
-  0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0xFE, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0x1F, 0x1E, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3E, 0xF8, 0xF8, 0xFF, 
-  0xFF, 0xFF, 0x3F, 0x7C, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFE, 
-  0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0xFC, 0xFF, 0xF0, 0xF1, 0x7F, 0xFC, 0x7F, 0xFC, 0xFF, 0xF1, 0xF1, 0x7F, 
-  0xFC, 0x3F, 0xFC, 0xFF, 0xE1, 0xF1, 0x7F, 0xFC, 0x3F, 0xFE, 0xFF, 0xC3, 
-  0xF1, 0x78, 0x3C, 0x1E, 0xFE, 0xFF, 0xC3, 0xF1, 0x78, 0x3C, 0x0E, 0xFF, 
-  0xFF, 0xC7, 0xF1, 0x78, 0x3C, 0x8E, 0xFF, 0xFF, 0xDF, 0xFF, 0xF8, 0x3F, 
-  0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF8, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0xF1, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF1, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x7F, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF1, 0x78, 0x3C, 0xFE, 0xFF, 0xFF, 0xFF, 0xF1, 0x78, 
-  0x3C, 0xFE, 0xFF, 0xFF, 0xFF, 0xF1, 0x78, 0x3C, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFE, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFE, 0xFF, 0xFF, };
+  0xD0, 0x1B, 0x51, 0x43, 0x44, 0x34, 0x44, 0x43, 0x44, 0x53, 0x53, 0x53,
+  0x53, 0x63, 0x53, 0x54, 0x44, 0x45, 0x55, 0x73, 0x91, 0x3D, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0xD3, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x9C, 0x41,
+  0x44, 0x54, 0x35, 0x45, 0x45, 0x45, 0x35, 0x26, 0xC8, 0x32, 0x35, 0x35,
+  0x35, 0x44, 0x44, 0x14, 0x17, 0x17, 0x47, 0x35, 0x35, 0x35, 0x44, 0x44,
+  0x14, 0x17, 0x17, 0x17, 0xF8, 0x11, 0x37, 0x85, 0x22, 0xF6, 0x17, 0x26,
+  0x35, 0x44, 0x35, 0x16, 0x5F, 0x62, 0x62, 0x44, 0x44, 0x44, 0x64, 0x62,
+  0xC2, 0x21, 0x26, 0x46, 0x44, 0x44, 0x44, 0x26, 0x26, 0xDD, 0x11, 0x26,
+  0x35, 0x44, 0x61, 0x61, 0x42, 0x24, 0x39, 0x53, 0x54, 0x54, 0x54, 0x64,
+  0x53, 0x62, 0xF1, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3F, 0x71, 0x71,
+  0x31, 0x22, 0x31, 0x13, 0x31, 0x45, 0x63, 0x62, 0x72, 0x71, 0x71, 0x71,
+  0x61, 0x62, 0x52, 0x33, 0x15, 0x26, 0x25, 0x44, 0x53, 0x53, 0x62, 0x62,
+  0xF1, 0x19, 0x51, 0x39, 0x3B, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0xB3,
+  0x1E, 0x71, 0x71, 0x62, 0x62, 0x62, 0x62, 0x62, 0x52, 0x52, 0x43, 0x43,
+  0x54, 0x63, 0x21, 0x61, 0x53, 0x54, 0x54, 0x53, 0x54, 0x53, 0x53, 0x53,
+  0x53, 0x43, 0x44, 0x43, 0x34, 0x44, 0x53, 0x62, 0x51, 0x61, 0x43, 0x54,
+  0x63, 0x72, 0x81, 0x3A, 0x71, 0x62, 0x53, 0x62, 0x81, 0x1A, 0x17, 0x17,
+  0x87, 0x19, 0x71, 0x62, 0x53, 0x62, 0xF1, 0x05,
+};
 
+// 392 -> 190 bytes
 static const unsigned char light_rain_night_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF8, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 
-  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xF0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x87, 0xFF, 0xDF, 0xFF, 
-  0xFF, 0x01, 0xE0, 0x0F, 0xFE, 0xC7, 0xFF, 0x7F, 0x00, 0x80, 0x1F, 0xF8, 
-  0xC1, 0xFF, 0x3F, 0xF0, 0x03, 0x3F, 0x00, 0xC0, 0xFF, 0x1F, 0xFC, 0x1F, 
-  0xFE, 0x00, 0xC0, 0xFF, 0x0F, 0xFF, 0x3F, 0xFC, 0x03, 0xE0, 0xFF, 0x87, 
-  0xFF, 0x7F, 0xF8, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0xFF, 0xE1, 
-  0xFF, 0xC0, 0xFF, 0xFF, 0xF1, 0xFF, 0xF1, 0x3F, 0xE0, 0xFF, 0xFF, 0xF1, 
-  0xFF, 0xF0, 0x0F, 0xE0, 0xFF, 0xFF, 0xE1, 0x7F, 0xF8, 0x07, 0xFF, 0xFF, 
-  0xFF, 0x83, 0x3F, 0xFC, 0x87, 0xFF, 0xFF, 0xFF, 0x03, 0x0F, 0xFE, 0xC3, 
-  0xFF, 0xFF, 0xFF, 0x0F, 0x1E, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x9C, 
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0xF8, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xF1, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xE1, 0xE3, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xE3, 0xE3, 0xFF, 0xF8, 0x7F, 
-  0xF8, 0xFF, 0xC3, 0xE3, 0xFF, 0xF8, 0x7F, 0xFC, 0xFF, 0x87, 0xE3, 0xF1, 
-  0x78, 0x3C, 0xFC, 0xFF, 0x87, 0xE3, 0xF1, 0x78, 0x1C, 0xFE, 0xFF, 0x8F, 
-  0xE3, 0xF1, 0x78, 0x1C, 0xFF, 0xFF, 0xBF, 0xFF, 0xF1, 0x7F, 0x9C, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF1, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x7F, 
-  0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 
-  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xF1, 0x78, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xF1, 0x78, 0xFC, 
-  0xFF, 0xFF, 0xFF, 0xE3, 0xF1, 0x78, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 
-  0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF1, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xE0, 0x1D, 0x51, 0x43, 0x44, 0x34, 0x44, 0x43, 0x44, 0x53, 0x53, 0x53,
+  0x53, 0x63, 0x53, 0x54, 0x44, 0x45, 0x64, 0xA2, 0x3E, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0xD3, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x9B, 0x51, 0x53,
+  0x63, 0x35, 0x45, 0x45, 0x35, 0x26, 0x17, 0xC9, 0x32, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x3D, 0x53, 0x53, 0x53, 0x53, 0x53, 0xC3, 0x2A, 0x62, 0x44,
+  0x18, 0x71, 0x53, 0x3F, 0x71, 0x71, 0xF1, 0x1C, 0x71, 0x71, 0x44, 0x44,
+  0x44, 0x54, 0x53, 0xC3, 0x11, 0x17, 0x47, 0x44, 0x44, 0x44, 0x35, 0x35,
+  0xEC, 0x11, 0x26, 0x35, 0xD2, 0x11, 0x35, 0xD3, 0x23, 0x26, 0x36, 0x35,
+  0x36, 0x45, 0x45, 0x55, 0x44, 0x35, 0x17, 0x48, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0xE2, 0x23, 0x26, 0x26, 0x23, 0x21, 0x53, 0x53, 0x24, 0x17, 0x17,
+  0x4F, 0x71, 0x61, 0x42, 0x24, 0x26, 0x25, 0x44, 0x53, 0x43, 0x53, 0x53,
+  0x62, 0xD1, 0x21, 0x35, 0x44, 0x43, 0x43, 0x34, 0x44, 0x34, 0x44, 0x34,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x45, 0x44, 0x44, 0x36, 0x8B, 0x12, 0x27,
+  0x26, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x25, 0x26, 0x23, 0x11, 0x34,
+  0x44, 0x26, 0x17, 0x4A, 0x39, 0x15, 0xCF, 0x15, 0x27, 0x36, 0x45, 0x35,
+  0x45, 0x35, 0x53, 0x63, 0x62, 0x53, 0x35, 0x17, 0x8A, 0x02,
+};
 
+// 392 -> 159 bytes
 static const unsigned char rain_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x83, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
-  0xF8, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 
-  0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 
-  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xC7, 0xE3, 0xFF, 0xC7, 0xFF, 0xF1, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 0xFF, 
-  0xF1, 0xFF, 0xC7, 0xC7, 0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 0xC7, 0xC7, 0xFF, 
-  0xE3, 0xF1, 0x78, 0xFC, 0xE3, 0x8F, 0xFF, 0xE3, 0xF1, 0x78, 0xFC, 0xE1, 
-  0x0F, 0xFF, 0xF1, 0x78, 0x3C, 0xFE, 0xF0, 0x1F, 0xFC, 0xF1, 0x78, 0x3C, 
-  0x7E, 0xF0, 0x3F, 0xE0, 0xF1, 0x78, 0x3C, 0x0E, 0xF8, 0xFF, 0xE0, 0x78, 
-  0x3C, 0x1E, 0x0F, 0xFE, 0xFF, 0xF3, 0x78, 0x3C, 0x1E, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0x78, 0x3C, 0x1E, 0xFF, 0xFF, 0xFF, 0x7F, 0x3C, 0x1E, 0x8F, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0x3C, 0x1E, 0x8F, 0xFF, 0xFF, 0xFF, 0x7F, 0x3C, 0x1E, 
-  0x8F, 0xFF, 0xFF, 0xFF, 0x3F, 0x1E, 0x8F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x1F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xE0, 0x29, 0x52, 0x43, 0x44, 0x43, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x63, 0x53, 0x63, 0x53, 0x54, 0x63, 0xE2, 0x3F, 0x72, 0x71, 0x71,
+  0xA1, 0x21, 0x54, 0x53, 0x23, 0xEE, 0x21, 0x86, 0x22, 0x66, 0x62, 0x62,
+  0x72, 0x71, 0xC1, 0x2D, 0x63, 0x53, 0x44, 0x45, 0x44, 0x44, 0x45, 0x44,
+  0x44, 0x11, 0x53, 0x53, 0x63, 0x53, 0x53, 0x63, 0x53, 0xA3, 0x1C, 0x71,
+  0x71, 0x71, 0x62, 0x53, 0x53, 0x54, 0x45, 0x45, 0x55, 0x73, 0xC1, 0x29,
+  0x13, 0x41, 0x44, 0x44, 0x45, 0x44, 0x44, 0x45, 0x44, 0x44, 0x11, 0x53,
+  0xC3, 0x38, 0x62, 0x28, 0x62, 0xDA, 0x31, 0x36, 0x35, 0x35, 0x36, 0x35,
+  0x35, 0x11, 0x44, 0x44, 0x54, 0x44, 0x44, 0x54, 0x44, 0x44, 0x36, 0x35,
+  0xBB, 0x12, 0x35, 0x44, 0xD1, 0x21, 0x44, 0xB1, 0x2E, 0x53, 0x35, 0x65,
+  0x72, 0x62, 0xD2, 0x1A, 0x31, 0x35, 0x35, 0x44, 0x53, 0x43, 0x53, 0x53,
+  0x43, 0x43, 0x44, 0x53, 0x53, 0x62, 0xF1, 0x3A, 0x71, 0x53, 0x44, 0x54,
+  0x54, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x43, 0x43, 0x34, 0x44, 0x44,
+  0x53, 0xF1, 0x2E,
+};
 
+// 392 -> 211 bytes
 static const unsigned char rain_day_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xBF, 0xFF, 0xE3, 0xFF, 0xFE, 0xFF, 0xFF, 0x1F, 0xFF, 0xE3, 0x7F, 
-  0xFC, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0x1F, 0xFC, 
-  0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 
-  0x7F, 0xFC, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xBE, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x3E, 
-  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xC7, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xC7, 0x01, 0xFF, 0x3F, 0x00, 0xC0, 
-  0xFF, 0xC7, 0x01, 0xFF, 0x1F, 0xF8, 0x81, 0xFF, 0xC7, 0x01, 0xFF, 0x0F, 
-  0xFE, 0x0F, 0xFF, 0xC7, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFE, 0xC3, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0x3F, 0xFC, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0x7F, 0xFC, 
-  0xE1, 0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0xF8, 0xF0, 0xFF, 0x1F, 0xF0, 0xFF, 
-  0xFF, 0xF8, 0xF8, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xF0, 0xFD, 0xFF, 0x83, 
-  0xFF, 0xFF, 0xFF, 0xC1, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x81, 0x1F, 
-  0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0xFE, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0x1F, 0x1E, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3E, 0xF8, 0xF8, 0xFF, 
-  0xFF, 0xFF, 0x3F, 0x7C, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFE, 
-  0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xF8, 0xE3, 0xFF, 0xF8, 0x7F, 
-  0xFC, 0xFF, 0xF8, 0xE3, 0xFF, 0xF8, 0x7F, 0xFC, 0xFF, 0xF1, 0xF1, 0x7F, 
-  0xFC, 0x3F, 0xFC, 0xFF, 0xE1, 0xF1, 0x78, 0x3C, 0x3E, 0xFE, 0xFF, 0xE3, 
-  0xF1, 0x78, 0x3C, 0x1E, 0xFE, 0xFF, 0xE3, 0x78, 0x3C, 0x1E, 0x07, 0xFF, 
-  0xFF, 0xE7, 0x78, 0x3C, 0x1E, 0x87, 0xFF, 0xFF, 0xFF, 0x78, 0x3C, 0x1E, 
-  0xC3, 0xFF, 0xFF, 0x7F, 0x3C, 0x1E, 0x8F, 0xF3, 0xFF, 0xFF, 0x7F, 0x3C, 
-  0x1E, 0x8F, 0xFF, 0xFF, 0xFF, 0x7F, 0x3C, 0x1E, 0x8F, 0xFF, 0xFF, 0xFF, 
-  0x3F, 0x1E, 0x8F, 0xC7, 0xFF, 0xFF, 0xFF, 0x3F, 0x1E, 0x8F, 0xC7, 0xFF, 
-  0xFF, 0xFF, 0x3F, 0x1E, 0x8F, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0x8F, 0xC7, 
-  0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x8F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xF1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xD0, 0x34, 0x26, 0x26, 0x26, 0x17, 0x17, 0x17, 0x1B, 0x52, 0x53, 0x43,
+  0x44, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63, 0x53, 0x54, 0x44, 0x45,
+  0x55, 0x73, 0xB1, 0x3B, 0x63, 0x53, 0x53, 0x13, 0x41, 0x44, 0x44, 0x45,
+  0x44, 0x44, 0x45, 0x44, 0x44, 0x11, 0x53, 0x53, 0x63, 0x53, 0xB3, 0x18,
+  0x44, 0x44, 0x55, 0x53, 0x54, 0x54, 0x54, 0x63, 0xB2, 0x38, 0x63, 0x53,
+  0x53, 0x13, 0x41, 0x44, 0x44, 0x45, 0x44, 0x44, 0x45, 0x44, 0x71, 0x81,
+  0x28, 0x71, 0x53, 0x28, 0x62, 0x7F, 0x61, 0x52, 0x43, 0x54, 0x63, 0xA1,
+  0x36, 0x36, 0x35, 0x35, 0x36, 0x35, 0x35, 0x36, 0x35, 0x35, 0x11, 0x44,
+  0x44, 0x54, 0x44, 0x44, 0x36, 0x35, 0xCC, 0x11, 0x26, 0x35, 0x44, 0x61,
+  0x61, 0x42, 0x24, 0x39, 0x53, 0x54, 0x54, 0x54, 0x64, 0x53, 0x62, 0x91,
+  0x2A, 0x62, 0x54, 0x44, 0x46, 0x54, 0x62, 0x72, 0x71, 0x71, 0x71, 0x61,
+  0x62, 0x52, 0x33, 0x15, 0x26, 0x25, 0x44, 0x53, 0x53, 0x62, 0x62, 0xF1,
+  0x19, 0x51, 0x39, 0x3B, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0xB3, 0x1E,
+  0x71, 0x71, 0x62, 0x62, 0x62, 0x62, 0x62, 0x52, 0x52, 0x43, 0x43, 0x54,
+  0x63, 0x21, 0x61, 0x53, 0x54, 0x54, 0x53, 0x54, 0x53, 0x53, 0x53, 0x53,
+  0x43, 0x44, 0x43, 0x34, 0x44, 0x53, 0x62, 0x51, 0x61, 0x43, 0x54, 0x63,
+  0x72, 0x81, 0x3A, 0x71, 0x62, 0x53, 0x62, 0x81, 0x1A, 0x17, 0x17, 0x87,
+  0x19, 0x71, 0x62, 0x53, 0x62, 0xF1, 0x05,
+};
 
+// 392 -> 189 bytes
 static const unsigned char rain_night_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE3, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x07, 0xF8, 0x0F, 0xFF, 0xBF, 0xFF, 0xFF, 0x01, 0xE0, 0x1F, 0xFC, 
-  0x8F, 0xFF, 0x7F, 0x00, 0x80, 0x3F, 0xF0, 0x83, 0xFF, 0x3F, 0xF0, 0x03, 
-  0x7F, 0x00, 0x80, 0xFF, 0x1F, 0xFC, 0x1F, 0xFE, 0x01, 0x80, 0xFF, 0x0F, 
-  0xFF, 0x3F, 0xFC, 0x07, 0xC0, 0xFF, 0x87, 0xFF, 0x7F, 0xF8, 0xFF, 0xC7, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0xFF, 0xC3, 0xFF, 0xC0, 0xFF, 0xFF, 0xF1, 
-  0xFF, 0xE3, 0x3F, 0xE0, 0xFF, 0xFF, 0xF1, 0xFF, 0xE1, 0x0F, 0xE0, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x83, 0x7F, 0xF8, 0x87, 
-  0xFF, 0xFF, 0xFF, 0x03, 0x1F, 0xFC, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0x3E, 
-  0xFE, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3C, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0xFC, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xF1, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xF1, 0xC7, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xF1, 0xC7, 0xFF, 0xF1, 0xFF, 
-  0xF8, 0xFF, 0xE3, 0xE3, 0xFF, 0xF8, 0x7F, 0xF8, 0xFF, 0xC3, 0xE3, 0xF1, 
-  0x78, 0x7C, 0xFC, 0xFF, 0xC7, 0xE3, 0xF1, 0x78, 0x3C, 0xFC, 0xFF, 0xC7, 
-  0xF1, 0x78, 0x3C, 0x0E, 0xFE, 0xFF, 0xCF, 0xF1, 0x78, 0x3C, 0x0E, 0xFF, 
-  0xFF, 0xFF, 0xF1, 0x78, 0x3C, 0x86, 0xFF, 0xFF, 0xFF, 0x78, 0x3C, 0x1E, 
-  0xE7, 0xFF, 0xFF, 0xFF, 0x78, 0x3C, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 
-  0x3C, 0x1E, 0xFF, 0xFF, 0xFF, 0x7F, 0x3C, 0x1E, 0x8F, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0x3C, 0x1E, 0x8F, 0xFF, 0xFF, 0xFF, 0x7F, 0x3C, 0x1E, 0x8F, 0xFF, 
-  0xFF, 0xFF, 0x3F, 0x1E, 0x8F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 
-  0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x8F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xE0, 0x25, 0x17, 0x17, 0x17, 0x4C, 0x52, 0x53, 0x43, 0x44, 0x43, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x63, 0x53, 0x54, 0x44, 0x45, 0x64, 0xC2, 0x3C,
+  0x63, 0x53, 0x44, 0x45, 0x44, 0x44, 0x45, 0x44, 0x44, 0x11, 0x53, 0x53,
+  0x63, 0x53, 0x53, 0x63, 0x53, 0xA3, 0x18, 0x35, 0x35, 0x56, 0x53, 0x54,
+  0x54, 0x63, 0x72, 0xC1, 0x38, 0x13, 0x41, 0x44, 0x44, 0x45, 0x44, 0x44,
+  0x45, 0x44, 0x44, 0x11, 0x53, 0xC3, 0x29, 0x62, 0x44, 0x18, 0x71, 0x53,
+  0xBA, 0x32, 0x36, 0x35, 0x35, 0x36, 0x35, 0x35, 0x11, 0x44, 0x44, 0x54,
+  0x44, 0x44, 0x54, 0x44, 0x44, 0x36, 0x35, 0xDB, 0x11, 0x26, 0x35, 0xD2,
+  0x11, 0x35, 0xD3, 0x33, 0x35, 0x45, 0x35, 0x36, 0x45, 0x45, 0x45, 0x35,
+  0x26, 0xFB, 0x21, 0x13, 0x42, 0x11, 0x53, 0x63, 0x44, 0x15, 0x17, 0x4F,
+  0x71, 0x61, 0x42, 0x24, 0x26, 0x25, 0x44, 0x53, 0x43, 0x53, 0x53, 0x62,
+  0xE1, 0x11, 0x26, 0x35, 0x44, 0x43, 0x34, 0x44, 0x34, 0x44, 0x34, 0x35,
+  0x35, 0x35, 0x35, 0x44, 0x54, 0x53, 0x53, 0x36, 0x8A, 0x12, 0x27, 0x26,
+  0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x25, 0x26, 0x34, 0x25, 0x35, 0x17,
+  0x5B, 0x15, 0x2B, 0x24, 0xBE, 0x15, 0x27, 0x36, 0x45, 0x45, 0x35, 0x45,
+  0x35, 0x62, 0x72, 0x71, 0x53, 0x35, 0x17, 0x99, 0x02,
+};
 
+// 392 -> 167 bytes
 static const unsigned char snow_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x83, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
-  0xF8, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 
-  0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 
-  0x8F, 0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 
-  0xFF, 0xF0, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0x7F, 
-  0xC6, 0xFC, 0xFF, 0xE3, 0xE3, 0xFF, 0x3F, 0x44, 0xF8, 0xFF, 0xC7, 0xE3, 
-  0xFF, 0x7F, 0x00, 0xFC, 0xFF, 0xC7, 0xE3, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 
-  0xC7, 0xE3, 0xFF, 0xE7, 0x01, 0xCF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 0x83, 
-  0xC7, 0xFF, 0xC7, 0xC7, 0xFF, 0x8F, 0xC7, 0xE3, 0xFF, 0xC7, 0xC7, 0xFF, 
-  0x1F, 0xC7, 0xF1, 0xFF, 0xE3, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xE1, 
-  0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 
-  0x7E, 0xF0, 0x3F, 0xE0, 0x1F, 0xC6, 0xF0, 0x0F, 0xF8, 0xFF, 0xE0, 0x0F, 
-  0xC7, 0xE1, 0x0F, 0xFE, 0xFF, 0xE3, 0x87, 0xC7, 0xC3, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0x83, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x01, 0xCF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x44, 
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC6, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0xC7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xE0, 0x29, 0x52, 0x43, 0x44, 0x43, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x63, 0x53, 0x63, 0x53, 0x54, 0x63, 0xA2, 0x4C, 0x33, 0x35, 0x35,
+  0xE2, 0x1E, 0x62, 0x28, 0x62, 0x26, 0x26, 0x26, 0x17, 0x17, 0xFF, 0x12,
+  0x26, 0x17, 0x1B, 0x52, 0x54, 0x54, 0x54, 0x3B, 0x35, 0x34, 0x34, 0x25,
+  0x2A, 0x61, 0x72, 0x81, 0x18, 0x71, 0x71, 0x71, 0x62, 0x53, 0x53, 0x54,
+  0x45, 0x45, 0x55, 0x73, 0xB1, 0x1E, 0x53, 0x53, 0x23, 0x21, 0x23, 0x12,
+  0x13, 0x19, 0x71, 0x52, 0x34, 0x35, 0x12, 0x32, 0x82, 0x33, 0x53, 0x43,
+  0x25, 0x39, 0x31, 0x21, 0x32, 0x35, 0x35, 0x35, 0xEA, 0x21, 0x86, 0x22,
+  0x96, 0x1F, 0x61, 0x53, 0x62, 0xB1, 0x21, 0x45, 0x43, 0x43, 0x43, 0x84,
+  0x13, 0x63, 0x63, 0x63, 0x22, 0x71, 0x62, 0x53, 0xD2, 0x1F, 0x51, 0x43,
+  0x14, 0x1D, 0x42, 0x14, 0xEB, 0x32, 0x45, 0x54, 0x26, 0x17, 0xBE, 0x11,
+  0x53, 0x53, 0x43, 0x34, 0x35, 0x34, 0x35, 0x35, 0x34, 0x44, 0x34, 0x35,
+  0x25, 0x16, 0xAF, 0x13, 0x37, 0x45, 0x44, 0x45, 0x35, 0x36, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x34, 0x44, 0x43, 0x44, 0x34, 0x15, 0xEF, 0x02,
+};
 
+// 392 -> 187 bytes
 static const unsigned char snow_shower_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 
-  0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 
-  0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x8F, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 
-  0x7F, 0xC6, 0xFC, 0x8F, 0xFF, 0xC7, 0xE3, 0x3F, 0x44, 0xF8, 0x8F, 0xFF, 
-  0xC7, 0xC7, 0x7F, 0x00, 0xFC, 0x8F, 0xFF, 0xC7, 0xC7, 0xFF, 0x00, 0xFE, 
-  0x8F, 0xC7, 0xE3, 0xC7, 0xE7, 0x01, 0xCF, 0x8F, 0xC7, 0xE1, 0xCF, 0xC7, 
-  0x83, 0xC7, 0x8F, 0xC7, 0xF1, 0xFF, 0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xF1, 
-  0xFF, 0x1F, 0xC7, 0xF1, 0x8F, 0xC7, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x8E, 
-  0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8E, 0xC7, 0xFF, 0xFF, 0x00, 0x00, 
-  0x00, 0xFE, 0xC7, 0xFF, 0xFF, 0x1F, 0xC6, 0xF0, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0x0F, 0xC7, 0xE1, 0xFF, 0xC7, 0xFF, 0xFF, 0x87, 0xC7, 0xC3, 0x87, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0x83, 0x87, 0x87, 0xFF, 0xFF, 0xFF, 0xE7, 0x01, 0xCF, 
-  0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x87, 0xC3, 0xFF, 0xFF, 0x7F, 
-  0x44, 0xFC, 0xFF, 0xC3, 0xFF, 0xFF, 0x3F, 0xC6, 0xF8, 0xFF, 0xC3, 0xFF, 
-  0xFF, 0x7F, 0xC7, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xC0, 0x2D, 0x52, 0x53, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63,
+  0x53, 0x63, 0x53, 0x54, 0x63, 0xF2, 0x3A, 0x61, 0x72, 0xB1, 0x21, 0x45,
+  0x45, 0x45, 0xB5, 0x53, 0x43, 0x43, 0x53, 0xA2, 0x12, 0x26, 0x17, 0x88,
+  0x21, 0x86, 0x22, 0x66, 0x62, 0x62, 0x72, 0x71, 0xB1, 0x29, 0x53, 0x53,
+  0x23, 0x21, 0x23, 0x12, 0x13, 0x19, 0x71, 0x52, 0x34, 0x35, 0x12, 0x32,
+  0x82, 0x33, 0x53, 0x43, 0x25, 0x39, 0x31, 0x21, 0x32, 0x35, 0x35, 0x35,
+  0x9A, 0x11, 0x17, 0x17, 0x27, 0x36, 0x35, 0x45, 0x55, 0x54, 0x54, 0x35,
+  0x17, 0xC9, 0x11, 0x36, 0x25, 0x16, 0x1B, 0x52, 0x34, 0x34, 0x34, 0x44,
+  0x38, 0x31, 0x36, 0x36, 0x26, 0x12, 0x27, 0x36, 0x25, 0xDE, 0x22, 0x86,
+  0x22, 0xB6, 0x1E, 0x44, 0x44, 0x44, 0x94, 0x12, 0x17, 0x33, 0x11, 0x33,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0xB8, 0x12, 0x35, 0x44,
+  0xD1, 0x21, 0x44, 0x91, 0x1C, 0x44, 0x44, 0x44, 0xD4, 0x33, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0xA9, 0x11, 0x53, 0x53, 0x43,
+  0x34, 0x35, 0x34, 0x35, 0x35, 0x34, 0x44, 0x34, 0x35, 0x25, 0x16, 0xC8,
+  0x23, 0x36, 0x35, 0x45, 0x35, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x34,
+  0x44, 0x43, 0x44, 0x34, 0x15, 0xCF, 0x02,
+};
 
+// 392 -> 193 bytes
 static const unsigned char snow_heavy_shower_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 
-  0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 
-  0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x8F, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 
-  0x7F, 0xC6, 0xFC, 0x7F, 0xFC, 0xC7, 0xE3, 0x3F, 0x44, 0xF8, 0x7F, 0xFC, 
-  0xC7, 0xC7, 0x7F, 0x00, 0xFC, 0x3F, 0xFE, 0xC7, 0xC7, 0xFF, 0x00, 0xFE, 
-  0x3F, 0x1E, 0xE7, 0x8F, 0xE7, 0x01, 0xCF, 0x3F, 0x1E, 0xE7, 0x8F, 0xC7, 
-  0x83, 0xC7, 0x1F, 0x8F, 0xF3, 0xFF, 0x8F, 0xC7, 0xE3, 0x1F, 0x8F, 0xF3, 
-  0xFF, 0x1F, 0xC7, 0xF1, 0x1F, 0x8F, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x8E, 
-  0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8E, 0xC7, 0xFF, 0xFF, 0x00, 0x00, 
-  0x00, 0x8E, 0xC7, 0xFF, 0xFF, 0x1F, 0xC6, 0xF0, 0xC7, 0xE3, 0xFF, 0xFF, 
-  0x0F, 0xC7, 0xE1, 0xFF, 0xE3, 0xFF, 0xFF, 0x87, 0xC7, 0xC3, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0xC3, 0x83, 0x87, 0xFF, 0xF1, 0xFF, 0xFF, 0xE7, 0x01, 0xCF, 
-  0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0xE1, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0x44, 0xFC, 0xE1, 0xFF, 0xFF, 0xFF, 0x3F, 0xC6, 0xF8, 0xE1, 0xF0, 0xFF, 
-  0xFF, 0x7F, 0xC7, 0xFD, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xC0, 0x2D, 0x53, 0x43, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63,
+  0x53, 0x63, 0x53, 0x54, 0x63, 0xF2, 0x3A, 0x61, 0x72, 0xB1, 0x21, 0x45,
+  0x45, 0x45, 0xB5, 0x53, 0x43, 0x43, 0x53, 0xA2, 0x12, 0x26, 0x17, 0x88,
+  0x21, 0x86, 0x22, 0x66, 0x62, 0x62, 0x72, 0x71, 0xB1, 0x29, 0x53, 0x53,
+  0x23, 0x21, 0x23, 0x12, 0x13, 0x19, 0x71, 0x52, 0x34, 0x35, 0x12, 0x32,
+  0x82, 0x33, 0x53, 0x43, 0x25, 0x39, 0x31, 0x21, 0x32, 0x35, 0x35, 0x35,
+  0x9A, 0x11, 0x17, 0x17, 0x27, 0x36, 0x35, 0x45, 0x55, 0x54, 0x54, 0x35,
+  0x17, 0xC9, 0x11, 0x36, 0x25, 0x16, 0x1B, 0x52, 0x34, 0x34, 0x34, 0x44,
+  0x38, 0x31, 0x36, 0x36, 0x26, 0x12, 0x27, 0x36, 0x25, 0xDE, 0x22, 0x86,
+  0x22, 0x96, 0x1C, 0x44, 0x44, 0x44, 0xE4, 0x33, 0x12, 0x33, 0x11, 0x33,
+  0x11, 0x33, 0x36, 0x35, 0x35, 0x26, 0x26, 0x26, 0x17, 0x17, 0xAF, 0x12,
+  0x35, 0x44, 0xD1, 0x21, 0x44, 0xF1, 0x19, 0x44, 0x44, 0x44, 0xD4, 0x33,
+  0x36, 0x35, 0x35, 0x36, 0x35, 0x35, 0x36, 0x35, 0x35, 0x11, 0x44, 0x44,
+  0x27, 0x26, 0x7D, 0x31, 0x35, 0x35, 0x44, 0x53, 0x43, 0x53, 0x53, 0x43,
+  0x43, 0x44, 0x53, 0x53, 0x62, 0x81, 0x3C, 0x72, 0x62, 0x72, 0x62, 0x62,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x43, 0x43, 0x34, 0x44, 0x44, 0x53, 0xF1,
+  0x2C,
+};
 
+// 392 -> 183 bytes
 static const unsigned char snow_rain_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 
-  0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 
-  0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x8F, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 
-  0x7F, 0xC6, 0xFC, 0xFF, 0xFF, 0xC7, 0xE3, 0x3F, 0x44, 0xF8, 0x8F, 0xFF, 
-  0xC7, 0xC7, 0x7F, 0x00, 0xFC, 0x8F, 0xFF, 0xC7, 0xC7, 0xFF, 0x00, 0xFE, 
-  0x8F, 0xFF, 0xE3, 0xC7, 0xE7, 0x01, 0xCF, 0x8F, 0xC7, 0xE1, 0xCF, 0xC7, 
-  0x83, 0xC7, 0x8F, 0xC7, 0xF1, 0xFF, 0x8F, 0xC7, 0xE3, 0x8F, 0xC7, 0xF1, 
-  0xFF, 0x1F, 0xC7, 0xF1, 0xFF, 0xC7, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0xFE, 
-  0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xC7, 0xFF, 0xFF, 0x00, 0x00, 
-  0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0x1F, 0xC6, 0xF0, 0x8F, 0xFF, 0xFF, 0xFF, 
-  0x0F, 0xC7, 0xE1, 0x8F, 0xFF, 0xFF, 0xFF, 0x87, 0xC7, 0xC3, 0x8F, 0xC7, 
-  0xFF, 0xFF, 0xC3, 0x83, 0x87, 0x8F, 0xC7, 0xFF, 0xFF, 0xE7, 0x01, 0xCF, 
-  0x8F, 0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0xC7, 0xFF, 0xFF, 0x7F, 
-  0x44, 0xFC, 0xFF, 0xC7, 0xFF, 0xFF, 0x3F, 0xC6, 0xF8, 0xFF, 0xC7, 0xFF, 
-  0xFF, 0x7F, 0xC7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xC0, 0x2D, 0x52, 0x53, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63,
+  0x53, 0x63, 0x53, 0x54, 0x63, 0xF2, 0x3A, 0x61, 0x72, 0xB1, 0x21, 0x45,
+  0x45, 0x45, 0xB5, 0x53, 0x43, 0x43, 0x53, 0xA2, 0x12, 0x26, 0x17, 0x88,
+  0x21, 0x86, 0x22, 0x66, 0x62, 0x62, 0x72, 0x71, 0xB1, 0x29, 0x53, 0x53,
+  0x23, 0x21, 0x23, 0x12, 0x13, 0x19, 0x71, 0x52, 0x34, 0x35, 0x12, 0x32,
+  0x82, 0x33, 0x53, 0x43, 0x25, 0x39, 0x31, 0x21, 0x32, 0x35, 0x35, 0x35,
+  0x9A, 0x11, 0x17, 0x17, 0x27, 0x36, 0x35, 0x45, 0x55, 0x54, 0x54, 0x35,
+  0x17, 0xC9, 0x11, 0x36, 0x25, 0x16, 0x1B, 0x52, 0x34, 0x34, 0x34, 0x44,
+  0x38, 0x31, 0x36, 0x36, 0x26, 0x12, 0x27, 0x36, 0x25, 0xDE, 0x22, 0x86,
+  0x22, 0xC6, 0x1F, 0x53, 0x53, 0x53, 0x53, 0x13, 0x31, 0x13, 0x71, 0xB1,
+  0x32, 0x35, 0x35, 0x35, 0x35, 0x35, 0xC8, 0x12, 0x35, 0x44, 0xD1, 0x21,
+  0x44, 0xA1, 0x1D, 0x53, 0x53, 0x53, 0x53, 0x53, 0xD3, 0x33, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0xB9, 0x11, 0x53, 0x53, 0x43, 0x34, 0x35, 0x34, 0x35,
+  0x35, 0x34, 0x44, 0x34, 0x35, 0x25, 0x16, 0xC8, 0x23, 0x36, 0x35, 0x45,
+  0x35, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x34, 0x44, 0x43, 0x44, 0x34,
+  0x15, 0xCF, 0x02,
+};
 
+// 392 -> 190 bytes
 static const unsigned char snow_heavy_rain_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 
-  0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 
-  0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x8F, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 
-  0x7F, 0xC6, 0xFC, 0x7F, 0xFC, 0xC7, 0xE3, 0x3F, 0x44, 0xF8, 0x7F, 0xFC, 
-  0xC7, 0xC7, 0x7F, 0x00, 0xFC, 0x3F, 0xFE, 0xC7, 0xC7, 0xFF, 0x00, 0xFE, 
-  0x3F, 0x1E, 0xE7, 0x8F, 0xE7, 0x01, 0xCF, 0x3F, 0x1E, 0xE7, 0x8F, 0xC7, 
-  0x83, 0xC7, 0x1F, 0x8F, 0xF3, 0xFF, 0x8F, 0xC7, 0xE3, 0x1F, 0x8F, 0xF3, 
-  0xFF, 0x1F, 0xC7, 0xF1, 0x1F, 0x8F, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x8E, 
-  0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8E, 0xC7, 0xFF, 0xFF, 0x00, 0x00, 
-  0x00, 0x8E, 0xC7, 0xFF, 0xFF, 0x1F, 0xC6, 0xF0, 0xC7, 0xE3, 0xFF, 0xFF, 
-  0x0F, 0xC7, 0xE1, 0xC7, 0xE3, 0xFF, 0xFF, 0x87, 0xC7, 0xC3, 0xC7, 0xE3, 
-  0xFF, 0xFF, 0xC3, 0x83, 0x87, 0xE3, 0xF1, 0xFF, 0xFF, 0xE7, 0x01, 0xCF, 
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0xF1, 0xFF, 0xFF, 0x7F, 
-  0x44, 0xFC, 0xFF, 0xF8, 0xFF, 0xFF, 0x3F, 0xC6, 0xF8, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0xC7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xC0, 0x2D, 0x53, 0x43, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63,
+  0x53, 0x63, 0x53, 0x54, 0x63, 0xF2, 0x3A, 0x61, 0x72, 0xB1, 0x21, 0x45,
+  0x45, 0x45, 0xB5, 0x53, 0x43, 0x43, 0x53, 0xA2, 0x12, 0x26, 0x17, 0x88,
+  0x21, 0x86, 0x22, 0x66, 0x62, 0x62, 0x72, 0x71, 0xB1, 0x29, 0x53, 0x53,
+  0x23, 0x21, 0x23, 0x12, 0x13, 0x19, 0x71, 0x52, 0x34, 0x35, 0x12, 0x32,
+  0x82, 0x33, 0x53, 0x43, 0x25, 0x39, 0x31, 0x21, 0x32, 0x35, 0x35, 0x35,
+  0x9A, 0x11, 0x17, 0x17, 0x27, 0x36, 0x35, 0x45, 0x55, 0x54, 0x54, 0x35,
+  0x17, 0xC9, 0x11, 0x36, 0x25, 0x16, 0x1B, 0x52, 0x34, 0x34, 0x34, 0x44,
+  0x38, 0x31, 0x36, 0x36, 0x26, 0x12, 0x27, 0x36, 0x25, 0xDE, 0x22, 0x86,
+  0x22, 0xA6, 0x28, 0x63, 0x53, 0x53, 0x23, 0x31, 0x13, 0x31, 0x13, 0x31,
+  0x63, 0x53, 0x53, 0x63, 0x62, 0x62, 0x72, 0x71, 0xF1, 0x2A, 0x51, 0x43,
+  0x14, 0x1D, 0x42, 0x14, 0xDF, 0x31, 0x36, 0x35, 0x35, 0x36, 0x35, 0x35,
+  0x36, 0x35, 0x35, 0x36, 0x35, 0x35, 0x11, 0x44, 0x44, 0x27, 0x26, 0x7D,
+  0x31, 0x35, 0x35, 0x44, 0x53, 0x43, 0x53, 0x53, 0x43, 0x43, 0x44, 0x53,
+  0x53, 0x62, 0x81, 0x3C, 0x72, 0x62, 0x72, 0x62, 0x62, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x43, 0x43, 0x34, 0x44, 0x44, 0x53, 0xF1, 0x2C,
+};
 
+// 392 -> 64 bytes
 static const unsigned char mist_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 
-  0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 
-  0xFF, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xE0, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 
-  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xE0, 0x9F, 0x21, 0x35, 0x35, 0xAA, 0x62, 0x71, 0x71, 0xAF, 0x12, 0x26,
+  0x26, 0x4A, 0x16, 0x17, 0x87, 0x84, 0x93, 0xF4, 0xB2, 0x54, 0x62, 0x62,
+  0x48, 0x38, 0xA8, 0x32, 0x45, 0x44, 0x4C, 0x53, 0x44, 0xC4, 0x84, 0x83,
+  0x84, 0x83, 0x84, 0x83, 0x84, 0x83, 0x49, 0x71, 0xF1, 0x84, 0x83, 0x84,
+  0x83, 0x84, 0x83, 0x4F, 0x71, 0x62, 0xE2, 0x54, 0x63, 0x62, 0x4A, 0x62,
+  0x53, 0xD3, 0x89, 0x01,
+};
 
+// 392 -> 142 bytes
 static const unsigned char sun_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 
-  0xFF, 0xE3, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 
-  0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0x0F, 0xFE, 0x80, 0x3F, 0xF8, 0xFF, 0xFF, 0x1F, 0x1F, 
-  0x00, 0x7C, 0xFC, 0xFF, 0xFF, 0xBF, 0x0F, 0x00, 0xF8, 0xFE, 0xFF, 0xFF, 
-  0xFF, 0x03, 0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xC1, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 
-  0x87, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0xFC, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0x3F, 0xFE, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x3F, 
-  0xFE, 0xFF, 0x0F, 0x38, 0xFE, 0xFF, 0x3F, 0x0E, 0xF8, 0x0F, 0x38, 0xFE, 
-  0xFF, 0x3F, 0x0E, 0xF8, 0x0F, 0x38, 0xFE, 0xFF, 0x3F, 0x0E, 0xF8, 0xFF, 
-  0x3F, 0xFE, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x3F, 0xFE, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 
-  0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xC3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC1, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x7F, 0xE0, 
-  0xFF, 0xFF, 0xFF, 0xBF, 0x0F, 0x00, 0xF8, 0xFE, 0xFF, 0xFF, 0x1F, 0x1F, 
-  0x00, 0x7C, 0xFC, 0xFF, 0xFF, 0x0F, 0xFE, 0x80, 0x3F, 0xF8, 0xFF, 0xFF, 
-  0x07, 0xFF, 0xFF, 0x7F, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE0, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE7, 0xFF, 0xE3, 
-  0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xC0, 0x3B, 0x44, 0x44, 0xB4, 0x4D, 0x52, 0x44, 0x45, 0x45, 0x54, 0x63,
+  0x81, 0x15, 0x17, 0x17, 0x26, 0x56, 0x53, 0x53, 0x23, 0x26, 0x26, 0x17,
+  0x17, 0x17, 0x4E, 0x61, 0x43, 0x34, 0x25, 0x35, 0x54, 0xB2, 0x39, 0xC1,
+  0x31, 0x44, 0x62, 0x51, 0x43, 0x43, 0x34, 0x25, 0x26, 0x16, 0x17, 0x17,
+  0x17, 0x17, 0x17, 0x17, 0x27, 0x26, 0x36, 0x45, 0x45, 0x54, 0x64, 0x44,
+  0x45, 0xC9, 0x32, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3B, 0x17, 0x28,
+  0x17, 0xBF, 0x82, 0xB3, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0xBA,
+  0x12, 0x46, 0x45, 0x55, 0x54, 0x44, 0x45, 0x45, 0x35, 0x35, 0x26, 0x26,
+  0x26, 0x26, 0x26, 0x26, 0x26, 0x35, 0x35, 0x44, 0x43, 0x43, 0x53, 0x52,
+  0x33, 0x25, 0x15, 0x26, 0x17, 0x8A, 0x23, 0x45, 0x53, 0x43, 0x34, 0x25,
+  0x16, 0x7F, 0x71, 0x71, 0x31, 0x35, 0x35, 0x75, 0xF1, 0x17, 0x27, 0x36,
+  0x45, 0x54, 0x44, 0x25, 0xDC, 0x34, 0x35, 0x35, 0xAD, 0x03,
+};
 
+// 392 -> 119 bytes
 static const unsigned char night_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x3F, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x8E, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x0F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x8F, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xE3, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x8F, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF1, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0xFC, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0x3F, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0xFC, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0x83, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0xFC, 0xFF, 0x07, 0xFE, 0x7F, 0xFE, 0x7F, 0xF8, 0xFF, 0x1F, 
-  0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 
-  0x87, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC3, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 
-  0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x7F, 0xF8, 
-  0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF, 
-  0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x03, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xF0, 0x2F, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xF1, 0x4B,
+  0x61, 0x52, 0x43, 0x34, 0x34, 0x44, 0x43, 0x44, 0x43, 0x44, 0x53, 0x53,
+  0x53, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x53, 0x53, 0x53,
+  0x54, 0x53, 0x54, 0x53, 0x54, 0x54, 0x54, 0x63, 0x72, 0xF1, 0x2A, 0x41,
+  0x24, 0x2B, 0x33, 0x15, 0x8E, 0x12, 0x26, 0x26, 0x35, 0x35, 0x35, 0x35,
+  0x34, 0x35, 0x35, 0x35, 0x35, 0x35, 0x11, 0x33, 0x31, 0x31, 0x81, 0x22,
+  0x46, 0x84, 0x1F, 0x38, 0xCE, 0x21, 0x35, 0x53, 0x52, 0x52, 0x52, 0x43,
+  0x34, 0x25, 0x16, 0x17, 0xEF, 0x11, 0x17, 0xFF, 0x41, 0x64, 0x82, 0x31,
+  0x55, 0x73, 0xC1, 0x86, 0x43, 0xF1, 0x5A, 0x71, 0x62, 0x53, 0x54, 0x54,
+  0x54, 0x53, 0x54, 0x13, 0x38, 0x44, 0x17, 0xF8, 0x16, 0xFF, 0x03,
+};
 
+// 392 -> 193 bytes
 static const unsigned char small_clouds_day_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7F, 
-  0xFC, 0xDF, 0xFF, 0xFF, 0xFF, 0xE3, 0x7F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 
-  0xC1, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x83, 0xFF, 
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x8F, 0x1F, 0xF0, 
-  0xE3, 0xFF, 0xFF, 0xFF, 0xDF, 0x07, 0xC0, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0x3F, 0xFC, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 
-  0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xF8, 0xFF, 0xFF, 0x0F, 
-  0x38, 0xFE, 0xFF, 0x38, 0xE0, 0xFF, 0x0F, 0x38, 0xFE, 0xFF, 0x38, 0xE0, 
-  0xFF, 0x0F, 0x38, 0xFE, 0xFF, 0x38, 0xE0, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 
-  0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0xFC, 0x7F, 0xFC, 0xFF, 0xFF, 0x7F, 0x70, 0xF8, 0x3F, 0xFC, 0xFF, 0xFF, 
-  0x3F, 0xF8, 0xF0, 0x1F, 0xFE, 0xFF, 0xFF, 0x1F, 0xFE, 0xC1, 0x07, 0xFF, 
-  0xFF, 0xFF, 0x0F, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0x8F, 0xDF, 0x07, 
-  0xC0, 0xF7, 0xFF, 0xFF, 0x81, 0x8F, 0x1F, 0xF0, 0xE3, 0xFF, 0x7F, 0xC0, 
-  0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0x1F, 0xC0, 0x83, 0xFF, 0xFF, 0x83, 0xFF, 
-  0x0F, 0xFE, 0xC1, 0xFF, 0x9F, 0x07, 0xFF, 0x0F, 0xFF, 0xE3, 0x7F, 0x1C, 
-  0x8F, 0xFF, 0x87, 0xFF, 0xF7, 0x7F, 0x1C, 0xDE, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0x7F, 0x7C, 0xFC, 0xFF, 0xE3, 0xFF, 0xFF, 0x7F, 0xFC, 0xF8, 0xFF, 0xE3, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0xF0, 0xFF, 0xE3, 0xFF, 0xFF, 0x7F, 0xFC, 0xF1, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0x7F, 0xFC, 0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xC7, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x1F, 
-  0xFC, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xF0, 0x14, 0x35, 0x44, 0x44, 0x43, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x36, 0x45, 0x45, 0x44, 0x35, 0x17, 0xD9, 0x84, 0xF3, 0x1C, 0x71,
+  0x26, 0x36, 0x56, 0x53, 0x54, 0x63, 0x72, 0xC1, 0x43, 0x44, 0x44, 0x98,
+  0x83, 0xB3, 0x1B, 0x61, 0x43, 0x45, 0x45, 0x45, 0x63, 0xA1, 0x11, 0x37,
+  0x45, 0x13, 0x17, 0x26, 0x56, 0x53, 0x53, 0x23, 0x26, 0x26, 0x17, 0x17,
+  0x3D, 0x61, 0x43, 0x25, 0x25, 0x45, 0x63, 0xC1, 0x1B, 0x38, 0x6F, 0x71,
+  0x71, 0x71, 0x71, 0x71, 0x71, 0xD1, 0x33, 0x53, 0x62, 0x51, 0x42, 0x34,
+  0x25, 0x26, 0x16, 0x17, 0x17, 0x17, 0x17, 0x27, 0x26, 0x36, 0x45, 0x55,
+  0x64, 0x53, 0x35, 0x3F, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x81, 0x66,
+  0x82, 0x52, 0x73, 0x81, 0x24, 0x26, 0x26, 0x26, 0x26, 0x35, 0x53, 0x33,
+  0x25, 0x29, 0x44, 0x26, 0x47, 0x55, 0x63, 0x72, 0x71, 0xF1, 0x15, 0x17,
+  0x26, 0x35, 0xC3, 0x11, 0x26, 0xC4, 0x23, 0x26, 0x26, 0x26, 0x26, 0x26,
+  0x26, 0x8E, 0x11, 0x27, 0x36, 0x35, 0x45, 0x35, 0x35, 0x35, 0x35, 0x44,
+  0x34, 0x25, 0x16, 0x14, 0x36, 0x54, 0x52, 0x52, 0x34, 0x16, 0x2C, 0x71,
+  0x62, 0x62, 0x53, 0x53, 0x33, 0x35, 0x35, 0x55, 0x53, 0x62, 0x62, 0xA1,
+  0x13, 0x36, 0x54, 0x54, 0x54, 0x34, 0x16, 0xFA, 0x54, 0x53, 0x53, 0xEB,
+  0x02,
+};
 
+// 392 -> 148 bytes
 static const unsigned char small_clouds_night_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x7F, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1C, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0x3F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x7F, 0xFC, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xC7, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 
-  0xF0, 0xFF, 0xFB, 0xFF, 0xFF, 0xC7, 0xFF, 0xC1, 0xFF, 0xF8, 0xFF, 0xFF, 
-  0xC7, 0xFF, 0x03, 0x3F, 0xF8, 0xFF, 0xFF, 0xC7, 0xFF, 0x07, 0x00, 0xF8, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0xFF, 0x8F, 0xFF, 0x7F, 
-  0x00, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0x0E, 
-  0xFF, 0xFF, 0x3F, 0xFC, 0xFF, 0x7F, 0x1C, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 
-  0x3F, 0x1C, 0xFE, 0xFF, 0x1F, 0xFE, 0xFF, 0x3F, 0x3E, 0xFC, 0xFF, 0x0F, 
-  0xFF, 0xFF, 0x07, 0x7E, 0xF8, 0xFF, 0x87, 0xFF, 0xFF, 0x01, 0xFF, 0xE0, 
-  0xFF, 0xC1, 0xFF, 0x7F, 0x00, 0xFF, 0x01, 0x3F, 0xE0, 0xFF, 0x3F, 0xF8, 
-  0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x3F, 0xFC, 0xFF, 0x0F, 0x00, 0xFC, 0xFF, 
-  0x1F, 0xFE, 0xFF, 0x7F, 0x80, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x8F, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0x3F, 0xFC, 
-  0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0x7F, 0xF0, 0xFF, 
-  0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xF0, 0x17, 0x26, 0x26, 0x35, 0x35, 0x34, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x36, 0x35, 0x26, 0x26, 0x17, 0xEB, 0x54, 0xA1, 0x52, 0x62, 0xF1, 0x18,
+  0x71, 0x62, 0x53, 0x18, 0x71, 0x53, 0x26, 0x26, 0x17, 0x98, 0x84, 0x83,
+  0x28, 0x61, 0x52, 0x34, 0x35, 0x34, 0x44, 0x53, 0x43, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x63, 0x53, 0x53, 0x54, 0x53, 0x63, 0x72, 0x81,
+  0x1F, 0x38, 0xBF, 0x11, 0x44, 0x62, 0xC1, 0x31, 0x53, 0x62, 0xE1, 0x1A,
+  0x71, 0x61, 0x62, 0x52, 0x53, 0x53, 0x44, 0x35, 0x26, 0x1B, 0x71, 0x62,
+  0x44, 0x17, 0xA8, 0x81, 0x73, 0x81, 0x1A, 0x17, 0x28, 0x26, 0x7F, 0x51,
+  0x33, 0x25, 0x16, 0x25, 0x44, 0x53, 0x62, 0x62, 0x71, 0xF1, 0x16, 0x17,
+  0x17, 0x27, 0xBE, 0x21, 0x36, 0x45, 0x45, 0x35, 0x45, 0x35, 0x35, 0x35,
+  0x35, 0x44, 0x34, 0x2B, 0x62, 0x44, 0x45, 0x55, 0x54, 0x54, 0x63, 0x62,
+  0x72, 0x39, 0x26, 0x88, 0x16, 0x17, 0x27, 0x26, 0x26, 0x36, 0x35, 0x35,
+  0x35, 0x17, 0xCD, 0x02,
+};
 
+// 392 -> 160 bytes
 static const unsigned char medium_clouds_day_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xBF, 0xFF, 0xE3, 0xFF, 0xFE, 0xFF, 0xFF, 0x1F, 0xFF, 0xE3, 0x7F, 0xFC, 
-  0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 
-  0x1F, 0xFC, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x7F, 
-  0xFC, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xBE, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x3E, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0xFF, 0xC7, 0xFF, 
-  0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xC7, 0x01, 0xFF, 0x3F, 0x00, 0xC0, 0xFF, 
-  0xC7, 0x01, 0xFF, 0x1F, 0xF8, 0x81, 0xFF, 0xC7, 0x01, 0xFF, 0x0F, 0xFE, 
-  0x0F, 0xFF, 0xC7, 0xFF, 0xFF, 0x87, 0xFF, 0x1F, 0xFE, 0xC3, 0xFF, 0xFF, 
-  0xC3, 0xFF, 0x3F, 0xFC, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0x7F, 0xFC, 0xE1, 
-  0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0xF8, 0xF0, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 
-  0xF8, 0xF8, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xF0, 0xFD, 0xFF, 0x83, 0xFF, 
-  0xFF, 0xFF, 0xC1, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x81, 0x1F, 0xFF, 
-  0xE1, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0xFE, 0xF1, 0xFF, 0xFF, 0xFF, 0x1F, 
-  0x1E, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3E, 0xF8, 0xF8, 0xFF, 0xFF, 
-  0xFF, 0x3F, 0x7C, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFE, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 
-  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0x3F, 0xFC, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xC3, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 
-  0x07, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xC0, 
-  0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xF0, 0x15, 0x35, 0x53, 0x52, 0x43, 0x43, 0x34, 0x34, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x36, 0x45, 0x45, 0x54, 0x54, 0x35, 0x17, 0xC8, 0x84, 0x83,
+  0x1E, 0x44, 0x44, 0x55, 0x53, 0x54, 0x54, 0x54, 0x63, 0x82, 0x3E, 0x38,
+  0xC8, 0x12, 0x37, 0x85, 0x22, 0xF6, 0x17, 0x26, 0x35, 0x44, 0x35, 0x16,
+  0xF9, 0x81, 0xF3, 0x29, 0x61, 0x52, 0x43, 0x14, 0x16, 0x26, 0x44, 0x92,
+  0x33, 0x45, 0x45, 0x45, 0x45, 0x36, 0x25, 0x16, 0x9F, 0x42, 0x64, 0x72,
+  0x54, 0x35, 0x26, 0x26, 0x17, 0x17, 0x17, 0x17, 0x26, 0x26, 0x35, 0x53,
+  0x61, 0x52, 0x42, 0x34, 0x35, 0x25, 0x26, 0x16, 0x9F, 0x11, 0x95, 0xB3,
+  0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0xEB, 0x11, 0x17, 0x27, 0x26,
+  0x26, 0x26, 0x26, 0x26, 0x25, 0x35, 0x34, 0x44, 0x35, 0x16, 0x12, 0x36,
+  0x45, 0x45, 0x35, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x44, 0x34, 0x44,
+  0x43, 0x34, 0x25, 0x16, 0x15, 0x36, 0x44, 0x35, 0x26, 0x17, 0xA8, 0x13,
+  0x27, 0x36, 0x25, 0x16, 0xA8, 0x71, 0x71, 0x71, 0x98, 0x11, 0x27, 0x36,
+  0x25, 0x16, 0xAF, 0x01,
+};
 
+// 392 -> 144 bytes
 static const unsigned char medium_clouds_night_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF8, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xE1, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0xFC, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x87, 0xFF, 0xDF, 0xFF, 0xFF, 
-  0x01, 0xE0, 0x0F, 0xFE, 0xC7, 0xFF, 0x7F, 0x00, 0x80, 0x1F, 0xF8, 0xC1, 
-  0xFF, 0x3F, 0xF0, 0x03, 0x3F, 0x00, 0xC0, 0xFF, 0x1F, 0xFC, 0x1F, 0xFE, 
-  0x00, 0xC0, 0xFF, 0x0F, 0xFF, 0x3F, 0xFC, 0x03, 0xE0, 0xFF, 0x87, 0xFF, 
-  0x7F, 0xF8, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0xFF, 0xE1, 0xFF, 
-  0xC0, 0xFF, 0xFF, 0xF1, 0xFF, 0xF1, 0x3F, 0xE0, 0xFF, 0xFF, 0xF1, 0xFF, 
-  0xF0, 0x0F, 0xE0, 0xFF, 0xFF, 0xE1, 0x7F, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 
-  0x83, 0x3F, 0xFC, 0x87, 0xFF, 0xFF, 0xFF, 0x03, 0x0F, 0xFE, 0xC3, 0xFF, 
-  0xFF, 0xFF, 0x0F, 0x1E, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x9C, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0xF8, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xF1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF8, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xF1, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 
-  0x3F, 0xFC, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0x0F, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
+  0xE0, 0x18, 0x42, 0x34, 0x35, 0x34, 0x44, 0x43, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x63, 0x53, 0x54, 0x44, 0x45, 0x64, 0x82, 0x4D, 0x38, 0xE8, 0x51,
+  0x53, 0x63, 0x35, 0x45, 0x45, 0x35, 0x26, 0x17, 0xE8, 0x83, 0x83, 0x2C,
+  0x62, 0x44, 0x18, 0x71, 0x53, 0x3F, 0x71, 0x71, 0x81, 0x2E, 0x38, 0xAF,
+  0x12, 0x26, 0x35, 0xD2, 0x11, 0x35, 0xD3, 0x23, 0x26, 0x36, 0x35, 0x36,
+  0x45, 0x45, 0x55, 0x44, 0x35, 0x17, 0xE8, 0x51, 0x73, 0x81, 0x41, 0x64,
+  0x72, 0x71, 0xF1, 0x14, 0x17, 0x26, 0x44, 0x62, 0x52, 0x42, 0x34, 0x35,
+  0x34, 0x35, 0x25, 0x16, 0x1D, 0x52, 0x43, 0x34, 0x34, 0x44, 0x43, 0x44,
+  0x43, 0x44, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x44, 0x44, 0x64, 0xB3,
+  0x28, 0x71, 0x62, 0x62, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x62, 0x32,
+  0x12, 0x41, 0x43, 0x64, 0x72, 0xA1, 0x94, 0x53, 0xF1, 0x5C, 0x71, 0x62,
+  0x53, 0x54, 0x53, 0x54, 0x33, 0x35, 0x26, 0x36, 0x55, 0x73, 0xA1, 0x2D,
+};
 
+// 392 -> 105 bytes
 static const unsigned char clouds_56x56_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x01, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xC1, 
-  0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xF0, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x3F, 
-  0xFE, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 
-  0x87, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x07, 0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xE1, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 
-  0xFC, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, };
-
-
-///////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////
+  0xE0, 0x1D, 0x52, 0x43, 0x44, 0x43, 0x53, 0x43, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x63, 0x53, 0x63, 0x53, 0x54, 0x63, 0xA2, 0x4C, 0x38, 0xEE, 0x21,
+  0x86, 0x22, 0x66, 0x62, 0x62, 0x72, 0x71, 0x81, 0x3D, 0x38, 0xB8, 0x12,
+  0x17, 0x17, 0x27, 0x36, 0x35, 0x45, 0x55, 0x54, 0x54, 0x35, 0x17, 0xE8,
+  0x82, 0x83, 0x3C, 0x62, 0x28, 0x62, 0xD8, 0x82, 0xF3, 0x39, 0x51, 0x43,
+  0x14, 0x1D, 0x42, 0x14, 0xDF, 0x72, 0x81, 0x72, 0xF1, 0x1C, 0x31, 0x35,
+  0x35, 0x44, 0x53, 0x43, 0x53, 0x53, 0x43, 0x43, 0x44, 0x53, 0x53, 0x62,
+  0xF1, 0x3A, 0x71, 0x53, 0x44, 0x54, 0x54, 0x63, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x43, 0x43, 0x34, 0x44, 0x44, 0x53, 0xF1, 0x3A,
+};
 
 #define WEATHER_ADDITIONAL_ICON_W 25
 #define WEATHER_ADDITIONAL_ICON_H 25
+
+// 100 -> 70 bytes
 static const unsigned char more_rain_25x25_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x9F, 0xFF, 0x01, 0xFF, 0x0F, 0xFF, 0x01, 
-  0xFF, 0x4F, 0xFE, 0x01, 0xFF, 0xE7, 0xFC, 0x01, 0xFF, 0xF7, 0xFC, 0x01, 
-  0xFF, 0xF3, 0xFD, 0x01, 0xFF, 0xF3, 0xF9, 0x01, 0xFF, 0xF3, 0xF9, 0x01, 
-  0xFF, 0xF3, 0xFD, 0x01, 0x3F, 0x47, 0xFC, 0x01, 0x3F, 0x0E, 0xFE, 0x01, 
-  0x9F, 0xFC, 0xFF, 0x01, 0xCF, 0xF9, 0xFD, 0x01, 0xEF, 0xF9, 0xF8, 0x01, 
-  0xE7, 0x7B, 0xF2, 0x01, 0xE7, 0x73, 0xE7, 0x01, 0xE7, 0x33, 0xE7, 0x01, 
-  0xE7, 0xBB, 0xCF, 0x01, 0xCF, 0x98, 0xCF, 0x01, 0x1F, 0x9C, 0xCF, 0x01, 
-  0xFF, 0x9F, 0xCF, 0x01, 0xFF, 0x3F, 0xE7, 0x01, 0xFF, 0x7F, 0xE0, 0x01, 
-  0xFF, 0xFF, 0xF9, 0x01, };
+  0xD0, 0x34, 0x24, 0x25, 0x26, 0x26, 0x26, 0x17, 0x27, 0x27, 0x27, 0x26,
+  0xBF, 0x11, 0x26, 0x25, 0x21, 0x23, 0x31, 0x22, 0x13, 0x13, 0x23, 0x22,
+  0x22, 0x13, 0x12, 0x14, 0x21, 0x26, 0x25, 0x16, 0x43, 0x33, 0x11, 0x22,
+  0x26, 0x26, 0x26, 0x17, 0x27, 0x27, 0x11, 0x44, 0x25, 0x1A, 0x52, 0x65,
+  0x72, 0x62, 0x62, 0x62, 0x52, 0x62, 0x32, 0x11, 0x42, 0x63, 0xE1, 0x11,
+  0x27, 0x17, 0x27, 0x26, 0x16, 0x26, 0x26, 0x16, 0xCF, 0x03,
+};
 
+// 100 -> 48 bytes
 static const unsigned char thunder_25x25_bits[] PROGMEM = {
-  0xFF, 0xBF, 0xFF, 0x01, 0xFF, 0xBF, 0xFF, 0x01, 0xFF, 0x9F, 0xFF, 0x01, 
-  0xFF, 0x8F, 0xFF, 0x01, 0xFF, 0x87, 0xFF, 0x01, 0xFF, 0x87, 0xFF, 0x01, 
-  0xFF, 0x93, 0xFF, 0x01, 0xFF, 0x99, 0xFF, 0x01, 0xFF, 0x99, 0xFF, 0x01, 
-  0xFF, 0x9C, 0xFF, 0x01, 0x7F, 0x9E, 0xFF, 0x01, 0x7F, 0x1E, 0xF0, 0x01, 
-  0x3F, 0x10, 0xF8, 0x01, 0x1F, 0xF0, 0xFC, 0x01, 0xFF, 0xF3, 0xFC, 0x01, 
-  0xFF, 0x73, 0xFE, 0x01, 0xFF, 0x33, 0xFF, 0x01, 0xFF, 0x33, 0xFF, 0x01, 
-  0xFF, 0x93, 0xFF, 0x01, 0xFF, 0xC3, 0xFF, 0x01, 0xFF, 0xC3, 0xFF, 0x01, 
-  0xFF, 0xE3, 0xFF, 0x01, 0xFF, 0xF3, 0xFF, 0x01, 0xFF, 0xFB, 0xFF, 0x01, 
-  0xFF, 0xFB, 0xFF, 0x01, };
+  0xD0, 0x1B, 0x63, 0x72, 0x71, 0xA1, 0x1A, 0x71, 0x71, 0x62, 0x53, 0x44,
+  0x44, 0x12, 0x32, 0x22, 0x22, 0x22, 0x22, 0x32, 0x21, 0x42, 0x44, 0x14,
+  0x44, 0x44, 0x12, 0x32, 0x22, 0x22, 0x22, 0x22, 0x32, 0x12, 0x42, 0x44,
+  0x54, 0x63, 0x72, 0x71, 0x91, 0x19, 0x71, 0x62, 0x62, 0x53, 0xC4, 0x4C,
+};
 
+// 100 -> 91 bytes
 static const unsigned char snow_25x25_bits[] PROGMEM = {
-  0xBF, 0x93, 0xFB, 0x01, 0x9F, 0x93, 0xF3, 0x01, 0x1F, 0x39, 0xF1, 0x01, 
-  0x3F, 0x38, 0xF8, 0x01, 0x37, 0x38, 0xDC, 0x01, 0x07, 0x38, 0xC0, 0x01, 
-  0x0F, 0x7C, 0xE0, 0x01, 0xFD, 0x38, 0x7E, 0x01, 0xF9, 0x39, 0x3F, 0x01, 
-  0xF3, 0x93, 0x9F, 0x01, 0xE3, 0x83, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x83, 0x8F, 0x01, 
-  0xF3, 0x93, 0x9F, 0x01, 0xF9, 0x39, 0x3F, 0x01, 0xFD, 0x38, 0x7E, 0x01, 
-  0x0F, 0x7C, 0xE0, 0x01, 0x07, 0x38, 0xC0, 0x01, 0x37, 0x38, 0xDC, 0x01, 
-  0x3F, 0x38, 0xF8, 0x01, 0x1F, 0x39, 0xF1, 0x01, 0x9F, 0x93, 0xF3, 0x01, 
-  0xBF, 0x93, 0xFB, 0x01, };
-  #endif
+  0x60, 0x61, 0x62, 0x63, 0x32, 0x21, 0x32, 0x45, 0x14, 0x71, 0x72, 0x62,
+  0x33, 0x38, 0x32, 0x25, 0x25, 0x16, 0x1A, 0x34, 0x35, 0x21, 0x62, 0x52,
+  0x53, 0x72, 0x31, 0x12, 0x32, 0x12, 0x22, 0x32, 0x35, 0x35, 0x35, 0x54,
+  0x34, 0x12, 0x32, 0x22, 0x12, 0x32, 0x15, 0x38, 0x52, 0x23, 0x21, 0x22,
+  0x53, 0x43, 0x45, 0x53, 0x53, 0x23, 0x21, 0x23, 0x22, 0x21, 0x23, 0x21,
+  0x13, 0x27, 0x35, 0x34, 0x25, 0x13, 0x62, 0x52, 0x13, 0x16, 0x26, 0x25,
+  0x35, 0x81, 0x43, 0x63, 0x72, 0x63, 0x36, 0x26, 0x32, 0x21, 0x63, 0x63,
+  0x62, 0xD1, 0x1B, 0x71, 0x71, 0xF1, 0x1B,
+};
+
+#define WEATHER_SMALL_ICON_W 28
+#define WEATHER_SMALL_ICON_H 28
+
+// 112 -> 93 bytes
+static const unsigned char thunder_light_rain_28x28_bits[] PROGMEM = {
+  0xF0, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x53, 0x21, 0x41, 0x21,
+  0x32, 0x21, 0x23, 0x21, 0x14, 0x21, 0x36, 0x36, 0x56, 0x35, 0x17, 0x17,
+  0xA8, 0x11, 0x24, 0x21, 0x23, 0x31, 0x22, 0x31, 0x15, 0x21, 0x14, 0x31,
+  0x13, 0x32, 0x12, 0x51, 0x53, 0x11, 0x21, 0x44, 0x44, 0x35, 0x35, 0x26,
+  0x14, 0x17, 0x27, 0x26, 0x46, 0x75, 0x53, 0x6C, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x62, 0x22, 0x12, 0x41, 0x12, 0x23, 0x12, 0x23, 0x22, 0xD2, 0x14,
+  0x35, 0x35, 0x25, 0x26, 0x25, 0x35, 0x34, 0x43, 0x24, 0xBE, 0x21, 0x26,
+  0x36, 0x26, 0x26, 0x26, 0x35, 0x25, 0x26, 0xAE, 0x01,
+};
+
+// 112 -> 97 bytes
+static const unsigned char thunder_rain_28x28_bits[] PROGMEM = {
+  0xF0, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x53, 0x21, 0x41, 0x21,
+  0x32, 0x21, 0x23, 0x21, 0x14, 0x21, 0x36, 0x36, 0x56, 0x35, 0x17, 0x17,
+  0xA8, 0x11, 0x22, 0x23, 0x22, 0x32, 0x21, 0x41, 0x21, 0x12, 0x21, 0x14,
+  0x31, 0x13, 0x32, 0x12, 0x51, 0x53, 0x11, 0x21, 0x44, 0x44, 0x35, 0x35,
+  0x26, 0x14, 0x17, 0x27, 0x26, 0x46, 0x75, 0x53, 0x6A, 0x72, 0x32, 0x12,
+  0x32, 0x12, 0x32, 0x22, 0x22, 0x13, 0x12, 0x11, 0x12, 0x12, 0x11, 0x22,
+  0x22, 0x63, 0xB2, 0x13, 0x35, 0x35, 0x25, 0x26, 0x25, 0x35, 0x34, 0x43,
+  0x24, 0xBE, 0x21, 0x26, 0x36, 0x26, 0x26, 0x26, 0x35, 0x25, 0x26, 0xAE,
+  0x01,
+};
+
+// 112 -> 77 bytes
+static const unsigned char thunder_28x28_bits[] PROGMEM = {
+  0xC0, 0x18, 0x24, 0x26, 0x52, 0x62, 0x62, 0x62, 0x62, 0x72, 0x62, 0x46,
+  0x74, 0x71, 0x71, 0xC1, 0x19, 0x71, 0x62, 0x62, 0x53, 0x17, 0x17, 0x12,
+  0x37, 0x15, 0x21, 0x32, 0x31, 0x22, 0x31, 0x13, 0x41, 0x54, 0x63, 0x72,
+  0x72, 0x71, 0x62, 0x63, 0x54, 0x56, 0x83, 0x1A, 0x11, 0x18, 0x71, 0x36,
+  0x45, 0x14, 0x17, 0x17, 0x17, 0x44, 0x44, 0x24, 0x11, 0x24, 0x35, 0x25,
+  0x44, 0x52, 0x33, 0x15, 0xAF, 0x11, 0x27, 0x36, 0x26, 0x26, 0x26, 0x26,
+  0x35, 0x25, 0x16, 0xAF, 0x01,
+};
+
+// 112 -> 77 bytes
+static const unsigned char light_rain_28x28_bits[] PROGMEM = {
+  0xD0, 0x27, 0x44, 0x33, 0x34, 0x25, 0x26, 0x26, 0x26, 0x36, 0x36, 0x56,
+  0x35, 0x17, 0x17, 0xAB, 0x21, 0x26, 0x23, 0x21, 0x32, 0x21, 0x32, 0x15,
+  0x23, 0x23, 0x21, 0x32, 0x21, 0x32, 0x35, 0x15, 0x58, 0x71, 0x71, 0x62,
+  0x62, 0x54, 0x37, 0xA5, 0x26, 0x26, 0x14, 0x21, 0x14, 0x21, 0x14, 0x34,
+  0x22, 0x41, 0x21, 0x23, 0x21, 0x14, 0x17, 0x3E, 0x51, 0x53, 0x53, 0x62,
+  0x52, 0x52, 0x43, 0x33, 0x44, 0xE2, 0x1B, 0x62, 0x62, 0x63, 0x62, 0x62,
+  0x52, 0x53, 0x62, 0xE2, 0x1B,
+};
+
+// 112 -> 98 bytes
+static const unsigned char light_rain_day_28x28_bits[] PROGMEM = {
+  0xC0, 0x21, 0x26, 0x26, 0x26, 0x14, 0x26, 0x21, 0x32, 0x21, 0x22, 0x22,
+  0x22, 0x26, 0x26, 0x36, 0x56, 0x54, 0x26, 0x36, 0x26, 0xA8, 0x21, 0x35,
+  0x21, 0x32, 0x21, 0x12, 0x23, 0x23, 0x21, 0x32, 0x35, 0x21, 0x32, 0x21,
+  0x12, 0x23, 0x7A, 0x52, 0x28, 0x1F, 0x63, 0x32, 0x22, 0x21, 0x44, 0x63,
+  0xC1, 0x12, 0x17, 0x17, 0x1F, 0x71, 0x11, 0x51, 0x11, 0x42, 0x11, 0x63,
+  0x62, 0x62, 0x22, 0x21, 0x13, 0x26, 0x15, 0x21, 0x23, 0x22, 0x31, 0x13,
+  0x41, 0x62, 0x62, 0x62, 0x52, 0x13, 0x26, 0x15, 0x62, 0x12, 0x42, 0x11,
+  0x62, 0x62, 0xD2, 0x1A, 0x71, 0x62, 0xF1, 0x44, 0x44, 0x4C, 0x71, 0x62,
+  0xF1, 0x02,
+};
+
+// 112 -> 89 bytes
+static const unsigned char light_rain_night_28x28_bits[] PROGMEM = {
+  0xD0, 0x22, 0x26, 0x26, 0x26, 0x14, 0x35, 0x21, 0x32, 0x21, 0x31, 0x22,
+  0x21, 0x26, 0x36, 0x36, 0x65, 0x44, 0x36, 0x26, 0x17, 0xA8, 0x21, 0x35,
+  0x22, 0x31, 0x22, 0x11, 0x24, 0x22, 0x22, 0x31, 0x35, 0x22, 0x31, 0x22,
+  0x11, 0x24, 0x79, 0x52, 0x29, 0x1C, 0x62, 0x63, 0x62, 0x63, 0x63, 0x82,
+  0x12, 0x17, 0x17, 0x1F, 0x71, 0x11, 0x42, 0x11, 0x33, 0x21, 0x62, 0x63,
+  0x52, 0x53, 0x12, 0x12, 0x14, 0x36, 0x63, 0x62, 0x31, 0x24, 0x16, 0x44,
+  0x52, 0x53, 0x62, 0x62, 0x62, 0x62, 0x72, 0xD2, 0x1D, 0x71, 0x62, 0x62,
+  0x53, 0x53, 0x63, 0xD2, 0x18,
+};
+
+// 112 -> 79 bytes
+static const unsigned char rain_28x28_bits[] PROGMEM = {
+  0xF0, 0x15, 0x17, 0x15, 0x45, 0x33, 0x34, 0x25, 0x26, 0x26, 0x26, 0x36,
+  0x36, 0x56, 0x35, 0x17, 0x17, 0xAA, 0x21, 0x26, 0x14, 0x31, 0x31, 0x22,
+  0x41, 0x21, 0x32, 0x31, 0x31, 0x22, 0x11, 0x21, 0x21, 0x23, 0x26, 0x5D,
+  0x71, 0x71, 0x62, 0x62, 0x54, 0x37, 0x95, 0x26, 0x26, 0x36, 0x26, 0x14,
+  0x21, 0x32, 0x31, 0x31, 0x22, 0x32, 0x21, 0x23, 0x26, 0x3D, 0x51, 0x53,
+  0x53, 0x62, 0x52, 0x52, 0x43, 0x33, 0x44, 0xE2, 0x1B, 0x62, 0x62, 0x63,
+  0x62, 0x62, 0x52, 0x53, 0x62, 0xE2, 0x1B,
+};
+
+// 112 -> 98 bytes
+static const unsigned char rain_day_28x28_bits[] PROGMEM = {
+  0x50, 0x72, 0x22, 0x13, 0x32, 0x12, 0x32, 0x22, 0x31, 0x13, 0x11, 0x12,
+  0x12, 0x14, 0x22, 0x22, 0x13, 0x32, 0x12, 0x62, 0x62, 0x63, 0x45, 0x65,
+  0x62, 0x63, 0xC2, 0x1A, 0x72, 0x22, 0x13, 0x32, 0x12, 0x12, 0x11, 0x22,
+  0x13, 0x13, 0x23, 0x12, 0x14, 0x22, 0x31, 0x63, 0x92, 0x26, 0x85, 0xF2,
+  0x31, 0x26, 0x23, 0x12, 0x42, 0x34, 0x16, 0x7D, 0x62, 0x43, 0x11, 0x63,
+  0x62, 0x62, 0x22, 0x21, 0x13, 0x26, 0x15, 0x21, 0x23, 0x22, 0x31, 0x13,
+  0x41, 0x62, 0x62, 0x62, 0x52, 0x13, 0x26, 0x15, 0x62, 0x12, 0x42, 0x11,
+  0x62, 0x62, 0xD2, 0x1A, 0x71, 0x62, 0xF1, 0x44, 0x44, 0x4C, 0x71, 0x62,
+  0xF1, 0x02,
+};
+
+// 112 -> 92 bytes
+static const unsigned char rain_night_28x28_bits[] PROGMEM = {
+  0xE0, 0x21, 0x23, 0x21, 0x23, 0x12, 0x33, 0x11, 0x24, 0x11, 0x12, 0x21,
+  0x23, 0x31, 0x22, 0x22, 0x21, 0x23, 0x21, 0x26, 0x27, 0x36, 0x56, 0x35,
+  0x36, 0x26, 0x17, 0xAD, 0x21, 0x23, 0x21, 0x11, 0x21, 0x32, 0x31, 0x31,
+  0x22, 0x41, 0x21, 0x32, 0x31, 0x31, 0x22, 0x11, 0x24, 0x79, 0x33, 0x1B,
+  0x51, 0x1E, 0x62, 0x72, 0x62, 0x63, 0x92, 0x27, 0x45, 0x14, 0x31, 0x13,
+  0x32, 0x26, 0x26, 0x35, 0x34, 0x12, 0x31, 0x52, 0x25, 0x26, 0x43, 0x52,
+  0x42, 0x33, 0x25, 0x35, 0x25, 0x26, 0x26, 0x36, 0x35, 0xDD, 0x11, 0x27,
+  0x36, 0x26, 0x35, 0x45, 0x35, 0x17, 0x8C, 0x01,
+};
+
+// 112 -> 77 bytes
+static const unsigned char snow_28x28_bits[] PROGMEM = {
+  0xD0, 0x27, 0x44, 0x33, 0x34, 0x25, 0x26, 0x26, 0x26, 0x36, 0x36, 0x56,
+  0x35, 0x17, 0x17, 0xAD, 0x21, 0x14, 0x21, 0x54, 0x21, 0x41, 0x31, 0x31,
+  0x52, 0x81, 0x12, 0x13, 0x13, 0x12, 0x34, 0x35, 0x64, 0x92, 0x12, 0x17,
+  0x27, 0x26, 0x46, 0x75, 0x53, 0x78, 0x71, 0x62, 0x11, 0x61, 0x23, 0x35,
+  0x27, 0x46, 0x52, 0x11, 0x51, 0x62, 0xE1, 0x11, 0x35, 0x35, 0x25, 0x26,
+  0x25, 0x35, 0x34, 0x43, 0x24, 0xBE, 0x21, 0x26, 0x36, 0x26, 0x26, 0x26,
+  0x35, 0x25, 0x26, 0xBE, 0x01,
+};
+
+// 112 -> 92 bytes
+static const unsigned char snow_shower_28x28_bits[] PROGMEM = {
+  0xF0, 0x13, 0x17, 0x25, 0x36, 0x26, 0x44, 0x44, 0x12, 0x32, 0x21, 0x22,
+  0x22, 0x14, 0x21, 0x14, 0x21, 0x26, 0x36, 0x36, 0x56, 0x35, 0x17, 0x17,
+  0x89, 0x21, 0x26, 0x11, 0x63, 0x52, 0x11, 0x32, 0x61, 0x31, 0x81, 0x12,
+  0x13, 0x12, 0x15, 0x11, 0x26, 0x13, 0x41, 0xD2, 0x14, 0x17, 0x27, 0x26,
+  0x46, 0x75, 0x53, 0x5D, 0x62, 0x22, 0x13, 0x22, 0x93, 0x21, 0x11, 0x21,
+  0x21, 0x11, 0x21, 0x21, 0x23, 0x21, 0x23, 0x21, 0x23, 0x26, 0x3B, 0x51,
+  0x53, 0x53, 0x62, 0x52, 0x52, 0x43, 0x33, 0x44, 0xE2, 0x1B, 0x62, 0x62,
+  0x63, 0x62, 0x62, 0x52, 0x53, 0x62, 0xE2, 0x1A,
+};
+
+// 112 -> 94 bytes
+static const unsigned char snow_heavy_shower_28x28_bits[] PROGMEM = {
+  0xF0, 0x13, 0x17, 0x25, 0x36, 0x26, 0x44, 0x44, 0x22, 0x31, 0x31, 0x21,
+  0x22, 0x14, 0x21, 0x14, 0x21, 0x26, 0x36, 0x36, 0x56, 0x35, 0x17, 0x17,
+  0x89, 0x21, 0x26, 0x11, 0x63, 0x52, 0x11, 0x32, 0x61, 0x31, 0x81, 0x12,
+  0x13, 0x12, 0x15, 0x11, 0x26, 0x13, 0x41, 0xD2, 0x14, 0x17, 0x27, 0x26,
+  0x46, 0x75, 0x53, 0x4C, 0x62, 0x22, 0x13, 0x22, 0x93, 0x31, 0x22, 0x22,
+  0x11, 0x21, 0x21, 0x11, 0x21, 0x31, 0x22, 0x22, 0x23, 0x21, 0x23, 0x26,
+  0x3A, 0x51, 0x53, 0x53, 0x62, 0x52, 0x52, 0x43, 0x33, 0x44, 0xE2, 0x1B,
+  0x72, 0x71, 0x62, 0x62, 0x62, 0x52, 0x53, 0x62, 0xE2, 0x1A,
+};
+
+// 112 -> 90 bytes
+static const unsigned char snow_rain_28x28_bits[] PROGMEM = {
+  0xF0, 0x13, 0x17, 0x25, 0x36, 0x26, 0x44, 0x44, 0x12, 0x32, 0x21, 0x22,
+  0x22, 0x14, 0x21, 0x14, 0x21, 0x26, 0x36, 0x36, 0x56, 0x35, 0x17, 0x17,
+  0x89, 0x21, 0x26, 0x11, 0x63, 0x52, 0x11, 0x32, 0x61, 0x31, 0x81, 0x12,
+  0x13, 0x12, 0x15, 0x11, 0x26, 0x13, 0x41, 0xD2, 0x14, 0x17, 0x27, 0x26,
+  0x46, 0x75, 0x53, 0x6D, 0x32, 0x12, 0x32, 0x12, 0x32, 0x42, 0x11, 0x12,
+  0x12, 0x41, 0x32, 0x12, 0x32, 0x12, 0x32, 0xB2, 0x14, 0x35, 0x35, 0x25,
+  0x26, 0x25, 0x35, 0x34, 0x43, 0x24, 0xBE, 0x21, 0x26, 0x36, 0x26, 0x26,
+  0x26, 0x35, 0x25, 0x26, 0xAE, 0x01,
+};
+
+// 112 -> 92 bytes
+static const unsigned char snow_heavy_rain_28x28_bits[] PROGMEM = {
+  0xF0, 0x13, 0x17, 0x25, 0x36, 0x26, 0x44, 0x44, 0x22, 0x31, 0x31, 0x21,
+  0x22, 0x14, 0x21, 0x14, 0x21, 0x26, 0x36, 0x36, 0x56, 0x35, 0x17, 0x17,
+  0x89, 0x21, 0x26, 0x11, 0x63, 0x52, 0x11, 0x32, 0x61, 0x31, 0x81, 0x12,
+  0x13, 0x12, 0x15, 0x11, 0x26, 0x13, 0x41, 0xD2, 0x14, 0x17, 0x27, 0x26,
+  0x46, 0x75, 0x53, 0x6C, 0x62, 0x32, 0x12, 0x23, 0x22, 0x12, 0x11, 0x12,
+  0x12, 0x11, 0x12, 0x23, 0x22, 0x32, 0x12, 0x32, 0x62, 0xA2, 0x13, 0x35,
+  0x35, 0x25, 0x26, 0x25, 0x35, 0x34, 0x43, 0x24, 0xBE, 0x21, 0x17, 0x27,
+  0x26, 0x26, 0x26, 0x35, 0x25, 0x26, 0xAE, 0x01,
+};
+
+// 112 -> 32 bytes
+static const unsigned char mist_28x28_bits[] PROGMEM = {
+  0xF0, 0x1B, 0x61, 0xC2, 0x19, 0x44, 0xB4, 0x18, 0x53, 0xA3, 0x62, 0x62,
+  0x1A, 0x28, 0x28, 0x28, 0x19, 0x17, 0x87, 0x82, 0x82, 0x28, 0xF1, 0x52,
+  0x53, 0x1B, 0x17, 0x97, 0x62, 0x62, 0x8A, 0x04,
+};
+
+// 112 -> 72 bytes
+static const unsigned char sun_28x28_bits[] PROGMEM = {
+  0xD0, 0x25, 0x36, 0x35, 0x26, 0x2F, 0x71, 0x21, 0x14, 0x21, 0x14, 0x71,
+  0x71, 0x71, 0xF1, 0x11, 0x26, 0x35, 0x25, 0x7E, 0x62, 0x62, 0x62, 0x92,
+  0x11, 0x43, 0xA2, 0x31, 0x54, 0x62, 0x71, 0x71, 0x71, 0x71, 0x71, 0x62,
+  0x63, 0x18, 0x61, 0x1D, 0x62, 0x62, 0x62, 0xE2, 0x17, 0x36, 0x34, 0x22,
+  0x21, 0x33, 0x36, 0x26, 0x36, 0x26, 0x21, 0x23, 0x21, 0x23, 0x25, 0x35,
+  0x34, 0x35, 0x11, 0x13, 0x32, 0x45, 0x35, 0xA9, 0x22, 0x26, 0xDE, 0x01,
+};
+
+// 112 -> 50 bytes
+static const unsigned char night_28x28_bits[] PROGMEM = {
+  0xF0, 0x15, 0x26, 0x35, 0x25, 0x35, 0x25, 0x35, 0x25, 0x26, 0x26, 0x26,
+  0x27, 0x26, 0x36, 0x26, 0x36, 0x26, 0x17, 0x8B, 0x51, 0xB1, 0x41, 0xC2,
+  0x25, 0x35, 0x34, 0x34, 0x25, 0x35, 0x25, 0x26, 0x26, 0x26, 0x44, 0x44,
+  0x45, 0x17, 0x7B, 0x53, 0x55, 0x64, 0x63, 0x62, 0x2C, 0x16, 0xB8, 0x13,
+  0xFF, 0x01,
+};
+
+// 112 -> 87 bytes
+static const unsigned char small_clouds_day_28x28_bits[] PROGMEM = {
+  0xC0, 0x41, 0x62, 0x32, 0x34, 0x25, 0x26, 0x26, 0x36, 0x36, 0x55, 0x45,
+  0x26, 0x17, 0x1E, 0x62, 0x82, 0x1C, 0x28, 0x3F, 0x71, 0x11, 0x51, 0x44,
+  0x11, 0x63, 0x12, 0x34, 0x16, 0x53, 0x32, 0x12, 0x32, 0x12, 0x62, 0x62,
+  0x63, 0x33, 0x21, 0x13, 0x23, 0x56, 0x42, 0x71, 0x71, 0x71, 0x81, 0x32,
+  0x55, 0x45, 0x26, 0x26, 0x12, 0x23, 0x12, 0x23, 0x12, 0x31, 0x11, 0x11,
+  0x21, 0x31, 0x74, 0x22, 0x41, 0x36, 0x36, 0x26, 0x11, 0x24, 0x11, 0x33,
+  0x25, 0x44, 0x43, 0x11, 0x22, 0x32, 0x46, 0x35, 0x17, 0x17, 0x8F, 0x32,
+  0x35, 0xBD, 0x01,
+};
+
+// 112 -> 69 bytes
+static const unsigned char small_clouds_night_28x28_bits[] PROGMEM = {
+  0xD0, 0x32, 0x53, 0x33, 0x34, 0x25, 0x26, 0x26, 0x36, 0x36, 0x55, 0x35,
+  0x17, 0x88, 0x82, 0xF2, 0x15, 0x35, 0x54, 0x32, 0x12, 0x31, 0x13, 0x21,
+  0x35, 0x25, 0x26, 0x26, 0x14, 0x31, 0x13, 0x22, 0x22, 0x32, 0x21, 0x53,
+  0x44, 0x35, 0x17, 0x48, 0x44, 0x56, 0x64, 0x62, 0x62, 0x62, 0x12, 0x44,
+  0x56, 0x64, 0x63, 0x72, 0x21, 0x16, 0x1A, 0x25, 0x16, 0x17, 0x2F, 0x71,
+  0x71, 0xF1, 0x1F, 0x71, 0x71, 0x62, 0x62, 0xE2, 0x1A,
+};
+
+// 112 -> 73 bytes
+static const unsigned char medium_clouds_day_28x28_bits[] PROGMEM = {
+  0xB0, 0x52, 0x71, 0x31, 0x34, 0x25, 0x26, 0x26, 0x36, 0x36, 0x55, 0x45,
+  0x36, 0x26, 0x17, 0xE8, 0x81, 0xF2, 0x18, 0x61, 0x24, 0x1B, 0x42, 0x18,
+  0x62, 0x43, 0x11, 0x32, 0x43, 0x53, 0xC2, 0x27, 0x46, 0x45, 0x26, 0x26,
+  0x26, 0x26, 0x12, 0x41, 0x61, 0x42, 0x22, 0x22, 0x32, 0x11, 0x24, 0x26,
+  0x26, 0x26, 0x35, 0x11, 0x32, 0x52, 0x52, 0x22, 0x26, 0x21, 0x14, 0x21,
+  0x26, 0x26, 0x9D, 0x11, 0x27, 0x16, 0x4F, 0x44, 0xC4, 0x14, 0x27, 0x16,
+  0x5F,
+};
+
+// 112 -> 63 bytes
+static const unsigned char medium_clouds_night_28x28_bits[] PROGMEM = {
+  0xC0, 0x43, 0x62, 0x31, 0x25, 0x25, 0x26, 0x26, 0x27, 0x36, 0x56, 0x35,
+  0x36, 0x26, 0x17, 0xE8, 0x81, 0xF2, 0x19, 0x33, 0x1B, 0x51, 0x1D, 0x62,
+  0x63, 0x63, 0x63, 0x72, 0x81, 0x36, 0x45, 0x36, 0x36, 0x26, 0x26, 0x35,
+  0x34, 0x21, 0x31, 0x52, 0x34, 0x26, 0x43, 0x52, 0x42, 0x33, 0x34, 0x25,
+  0x26, 0x26, 0x26, 0x26, 0x36, 0xED, 0x11, 0x27, 0x36, 0x35, 0x35, 0x35,
+  0x17, 0xAD, 0x01,
+};
+
+// 112 -> 51 bytes
+static const unsigned char clouds_28x28_bits[] PROGMEM = {
+  0xD0, 0x35, 0x53, 0x32, 0x34, 0x25, 0x26, 0x26, 0x26, 0x36, 0x36, 0x56,
+  0x35, 0x17, 0x17, 0xE8, 0x81, 0x82, 0x19, 0x71, 0x71, 0x62, 0x62, 0x54,
+  0x37, 0x85, 0x1A, 0x28, 0x17, 0x5F, 0x51, 0x53, 0x53, 0x62, 0x52, 0x52,
+  0x43, 0x33, 0x44, 0xE2, 0x1B, 0x62, 0x62, 0x63, 0x62, 0x62, 0x52, 0x53,
+  0x62, 0xE2, 0x1D,
+};
+
+#define WEATHER_SMALL_ADDITIONAL_ICON_W 13
+#define WEATHER_SMALL_ADDITIONAL_ICON_H 13
+
+// 26 -> 31 bytes
+static const unsigned char more_rain_13x13_bits[] PROGMEM = {
+  0xF0, 0x11, 0x32, 0x21, 0x21, 0x41, 0x21, 0x12, 0x11, 0x21, 0x21, 0x11,
+  0x42, 0x55, 0x15, 0x17, 0x27, 0x27, 0x46, 0x36, 0x17, 0x17, 0x26, 0x25,
+  0x16, 0x17, 0x27, 0x26, 0x16, 0x17, 0x1F,
+};
+
+// 26 -> 21 bytes
+static const unsigned char thunder_13x13_bits[] PROGMEM = {
+  0x50, 0x71, 0x71, 0x62, 0x53, 0x11, 0x51, 0x11, 0x21, 0x36, 0x12, 0x42,
+  0x44, 0x54, 0x63, 0x72, 0x81, 0x15, 0x27, 0x26, 0x5E,
+};
+
+// 26 -> 37 bytes
+static const unsigned char snow_13x13_bits[] PROGMEM = {
+  0x30, 0x11, 0x23, 0x16, 0x11, 0x13, 0x11, 0x15, 0x23, 0x12, 0x11, 0x22,
+  0x2D, 0x52, 0x41, 0x11, 0x51, 0x11, 0x42, 0x11, 0x22, 0x31, 0x11, 0x26,
+  0x36, 0x35, 0x15, 0x12, 0x26, 0x54, 0x53, 0x25, 0x44, 0x34, 0x25, 0x17,
+  0x06,
+};
+
+#endif
@@ -1,236 +1,85 @@
+// Generated by tools/generate_assets.py from assets/, do not edit.
+// Bitmaps are run length compressed SH1106 pages, draw them through CWeatherDisplay::DrawPageBitmap.
 #ifndef _WIFI_ICONS_H_
 #define _WIFI_ICONS_H_
 
 #define WIFI_ICON_W 64
 #define WIFI_ICON_H 64
 
+// 512 -> 26 bytes
+static const unsigned char wifi_animation_0_64x64_bits[] PROGMEM = {
+  0xF0, 0x9C, 0x13, 0x26, 0x35, 0x44, 0x53, 0x62, 0xF1, 0x11, 0x37, 0x55,
+  0x83, 0x6E, 0x71, 0x62, 0x53, 0x44, 0x35, 0x26, 0x17, 0x26, 0x35, 0xE2,
+  0xD9, 0x03,
+};
+
+// 512 -> 50 bytes
+static const unsigned char wifi_animation_1_64x64_bits[] PROGMEM = {
+  0xC0, 0xAF, 0x22, 0x45, 0x54, 0x44, 0x35, 0x26, 0xFF, 0x15, 0x26, 0x35,
+  0x44, 0x53, 0x62, 0xF1, 0x11, 0x37, 0x55, 0x83, 0x12, 0x47, 0x84, 0x12,
+  0x47, 0x84, 0x5E, 0x71, 0x62, 0x53, 0x44, 0x35, 0x26, 0x17, 0x26, 0x35,
+  0xC2, 0x23, 0xC3, 0x13, 0xE3, 0x78, 0x52, 0x44, 0x35, 0x44, 0x62, 0xF1,
+  0xCB, 0x02,
+};
+
+// 512 -> 81 bytes
+static const unsigned char wifi_animation_2_64x64_bits[] PROGMEM = {
+  0xE0, 0xBD, 0x21, 0x35, 0x35, 0x26, 0xEC, 0x26, 0x45, 0x54, 0x44, 0x35,
+  0x36, 0x27, 0x36, 0x55, 0x73, 0x72, 0x53, 0x35, 0x17, 0xEF, 0x14, 0x26,
+  0x35, 0x44, 0x53, 0x62, 0xF1, 0x11, 0x37, 0x55, 0x83, 0x12, 0x47, 0x84,
+  0x12, 0x47, 0x84, 0x33, 0x85, 0x33, 0x85, 0x4E, 0x71, 0x62, 0x53, 0x44,
+  0x35, 0x26, 0x17, 0x26, 0x35, 0xC2, 0x23, 0xC3, 0x13, 0xA3, 0xF4, 0xD3,
+  0x68, 0x52, 0x44, 0x35, 0x44, 0x62, 0xD1, 0x21, 0x35, 0x44, 0xC2, 0x22,
+  0x44, 0xD3, 0x78, 0x71, 0x62, 0x62, 0xF1, 0xBF, 0x01,
+};
+
+// 512 -> 120 bytes
+static const unsigned char wifi_animation_3_64x64_bits[] PROGMEM = {
+  0xF0, 0x4C, 0xE1, 0x78, 0x52, 0x53, 0x63, 0x92, 0x11, 0x36, 0x55, 0x63,
+  0x73, 0x62, 0x44, 0x35, 0x17, 0xCC, 0x25, 0x45, 0x54, 0x44, 0x35, 0x36,
+  0x27, 0x36, 0x55, 0x73, 0x72, 0x53, 0x35, 0x17, 0x18, 0x71, 0x53, 0x26,
+  0x18, 0x71, 0x53, 0x26, 0xEF, 0x13, 0x26, 0x35, 0x44, 0x53, 0x62, 0xF1,
+  0x11, 0x37, 0x55, 0x83, 0x12, 0x47, 0x84, 0x12, 0x47, 0x84, 0x33, 0x85,
+  0x33, 0x85, 0x23, 0x86, 0x33, 0x85, 0x3E, 0x71, 0x62, 0x53, 0x44, 0x35,
+  0x26, 0x17, 0x26, 0x35, 0xC2, 0x23, 0xC3, 0x13, 0xA3, 0xF4, 0x93, 0x84,
+  0xC4, 0x58, 0x52, 0x44, 0x35, 0x44, 0x62, 0xD1, 0x21, 0x35, 0x44, 0xC2,
+  0x22, 0x44, 0xB3, 0x23, 0x44, 0xD1, 0x22, 0x44, 0xF1, 0x5F, 0x71, 0x62,
+  0x62, 0xC1, 0x12, 0x36, 0x63, 0x61, 0x61, 0x52, 0x33, 0x25, 0xEE, 0x1A,
+};
+
 #define WIFI_FRAME_ANIMATION_COUNT 4
-static const unsigned char wifi_animation_64x64_bits[WIFI_FRAME_ANIMATION_COUNT][(WIFI_ICON_W * WIFI_ICON_H) / sizeof(char)] PROGMEM = {
-  {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-  },
-  {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 
-  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 
-  0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x3F, 0xE0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 
-  0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-  },
-  {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 
-  0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0x1F, 0xC0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0xFF, 
-  0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 
-  0xFF, 0x1F, 0xFC, 0x0F, 0xF8, 0x1F, 0xFC, 0xFF, 0xFF, 0x3F, 0xFE, 0x01, 
-  0x80, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 
-  0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x3F, 0xE0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 
-  0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-  },
-  {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 
-  0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 
-  0xFF, 0x7F, 0x00, 0xFC, 0x1F, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0xFF, 
-  0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 
-  0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0x3F, 0xE0, 0xFF, 0xFF, 0x01, 0xFF, 0x07, 
-  0xF0, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0x00, 0xFF, 0x81, 0xFF, 
-  0x7F, 0xE0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0x00, 
-  0x00, 0xF0, 0x8F, 0xFF, 0xFF, 0xFD, 0x01, 0xF8, 0x1F, 0xC0, 0xDF, 0xFF, 
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0xFF, 
-  0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 
-  0xFF, 0x1F, 0xFC, 0x0F, 0xF8, 0x1F, 0xFC, 0xFF, 0xFF, 0x3F, 0xFE, 0x01, 
-  0x80, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 
-  0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x3F, 0xE0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 
-  0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 
-  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-  }
+static const unsigned char* const wifi_animation_64x64_bits[WIFI_FRAME_ANIMATION_COUNT] PROGMEM = {
+  wifi_animation_0_64x64_bits,
+  wifi_animation_1_64x64_bits,
+  wifi_animation_2_64x64_bits,
+  wifi_animation_3_64x64_bits,
 };
 
+// 512 -> 272 bytes
 static const unsigned char wifi_conected_64x64_bits[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 
-  0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 
-  0xFF, 0x1F, 0xFE, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 
-  0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 
-  0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x3F, 0xFE, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFC, 
-  0x1F, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0xF8, 0x9F, 0xFF, 0x07, 0x00, 
-  0x00, 0xF0, 0xFF, 0xF9, 0x8F, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xF1, 
-  0xCF, 0x7F, 0x00, 0xFC, 0x1F, 0x00, 0xFF, 0xF3, 0xCF, 0x1F, 0xC0, 0xFF, 
-  0xFF, 0x01, 0xFC, 0xF3, 0xE7, 0x0F, 0xF8, 0xFF, 0xFF, 0x0F, 0xF8, 0xE7, 
-  0xE7, 0x03, 0xFE, 0xFF, 0xFF, 0x3F, 0xE0, 0xE7, 0xE7, 0x01, 0xFF, 0x07, 
-  0xF0, 0xFF, 0xC0, 0xE7, 0xE7, 0xC0, 0x7F, 0x00, 0x00, 0xFF, 0x81, 0xE7, 
-  0x63, 0xE0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xC7, 0xF3, 0xF8, 0x07, 0x00, 
-  0x00, 0xF0, 0x8F, 0xCF, 0xF3, 0xFD, 0x01, 0xF8, 0x1F, 0xC0, 0xDF, 0xCF, 
-  0xF3, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xCF, 0xF3, 0x3F, 0xE0, 0xFF, 
-  0xFF, 0x03, 0xFE, 0xCF, 0xF3, 0x1F, 0xF8, 0xFF, 0xFF, 0x0F, 0xFC, 0xCF, 
-  0xF3, 0x1F, 0xFC, 0x0F, 0xF8, 0x1F, 0xFC, 0xCF, 0xF3, 0x3F, 0xFE, 0x01, 
-  0x80, 0x3F, 0xFE, 0xCF, 0xF3, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0xCF, 
-  0xE3, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0xC7, 0xE7, 0xFF, 0x0F, 0xF0, 
-  0x07, 0xF0, 0xFF, 0xE7, 0xE7, 0xFF, 0x07, 0xFE, 0x3F, 0xE0, 0xFF, 0xE7, 
-  0xE7, 0xFF, 0x87, 0xFF, 0xFF, 0xF0, 0xFF, 0xE7, 0xE7, 0xFF, 0xCF, 0xFF, 
-  0xFF, 0xF9, 0xFF, 0xE7, 0xCF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xF3, 
-  0xCF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xF3, 0x8F, 0xFF, 0xFF, 0x01, 
-  0xC0, 0xFF, 0xFF, 0xF1, 0x9F, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xF9, 
-  0x1F, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x03, 
-  0xE0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFF, 0x07, 0xF0, 0xFF, 0x7F, 0xFC, 
-  0x7F, 0xFC, 0xFF, 0x0F, 0xF8, 0xFF, 0x3F, 0xFE, 0xFF, 0xFC, 0xFF, 0x1F, 
-  0xFC, 0xFF, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0x3F, 0xFE, 0xFF, 0x1F, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0x7F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 
-  0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 
-  0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 
-  0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x1F, 0x61, 0x62, 0x52, 0x53, 0x52, 0x53, 0x62, 0x52, 0x62, 0x62,
+  0x62, 0x52, 0x53, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x23,
+  0x31, 0x62, 0x62, 0x62, 0x72, 0x62, 0x62, 0x63, 0x62, 0x63, 0x62, 0x72,
+  0xF1, 0x2E, 0x51, 0x43, 0x34, 0x43, 0x43, 0x43, 0x53, 0x62, 0x62, 0xD1,
+  0x1D, 0x52, 0x53, 0x63, 0x92, 0x11, 0x36, 0x55, 0x63, 0x73, 0x62, 0x44,
+  0x35, 0x17, 0x48, 0x71, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x54, 0x73,
+  0xF1, 0x1A, 0x41, 0x24, 0x15, 0x35, 0x53, 0xB1, 0x1F, 0x52, 0x44, 0x45,
+  0x54, 0x63, 0x73, 0x62, 0x53, 0x35, 0x27, 0x37, 0x55, 0x73, 0x81, 0x11,
+  0x37, 0x65, 0x82, 0x11, 0x37, 0x65, 0x82, 0x19, 0x71, 0x53, 0x55, 0x55,
+  0x74, 0xA1, 0xA5, 0xB2, 0x18, 0x61, 0x52, 0x43, 0x34, 0x25, 0x16, 0x1F,
+  0x71, 0x53, 0x35, 0x28, 0x71, 0x44, 0x28, 0x71, 0x44, 0x38, 0x53, 0x38,
+  0x53, 0x38, 0x62, 0x38, 0x53, 0xC8, 0x41, 0x84, 0x31, 0x85, 0x64, 0x82,
+  0x41, 0x84, 0x18, 0x71, 0x62, 0x53, 0x44, 0x35, 0x26, 0x17, 0x26, 0x35,
+  0xC2, 0x23, 0xC3, 0x13, 0xA3, 0xF4, 0x93, 0x84, 0xF4, 0x1C, 0x29, 0x5B,
+  0x71, 0x54, 0x55, 0x55, 0x73, 0x91, 0x1E, 0x52, 0x44, 0x35, 0x44, 0x62,
+  0xD1, 0x21, 0x35, 0x44, 0xC2, 0x22, 0x44, 0xB3, 0x23, 0x44, 0xD1, 0x22,
+  0x44, 0xE1, 0x1A, 0x51, 0x33, 0x15, 0x25, 0x44, 0xF1, 0x1A, 0x71, 0x53,
+  0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x72, 0x81, 0x1C, 0x71, 0x62, 0x62,
+  0xC1, 0x12, 0x36, 0x63, 0x61, 0x61, 0x52, 0x33, 0x25, 0x6D, 0x61, 0x62,
+  0x52, 0x43, 0x43, 0x43, 0x33, 0x44, 0x53, 0xF1, 0x2E, 0x71, 0x62, 0x62,
+  0x63, 0x62, 0x63, 0x62, 0x72, 0x62, 0x62, 0x62, 0x62, 0x63, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x52, 0x53, 0x62, 0x62, 0x62, 0x52, 0x62,
+  0x52, 0x53, 0x52, 0x53, 0x62, 0x62, 0xF1, 0x1F,
 };
+
 #endif
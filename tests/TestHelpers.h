@@ -0,0 +1,30 @@
+#ifndef _TESTHELPERS_H
+#define _TESTHELPERS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+///////////////// DEFINES
+// A failed check ends the test with the line it failed on
+#define CHECK(condition) \
+  do \
+  { \
+    if(!(condition)) \
+    { \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+      exit(1); \
+    } \
+  } while(0)
+
+#define CHECK_EQUAL(expected, actual) \
+  do \
+  { \
+    const long long expectedValue = (expected); \
+    const long long actualValue = (actual); \
+    if(expectedValue != actualValue) \
+    { \
+      fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, actualValue, expectedValue); \
+      exit(1); \
+    } \
+  } while(0)
+#endif
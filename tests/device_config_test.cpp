@@ -0,0 +1,244 @@
+// CDeviceConfig on the in-memory SPIFFS of the shim: the power cut at every
+// file system operation of a save, the order generations are loaded in at
+// boot, records that don't pass the checks and the migration of the JSON
+// file older firmware kept the configuration in.
+#include <map>
+#include <string>
+
+#include "DeviceConfig.h"
+#include "TestHelpers.h"
+
+///////////////// DEFINES
+#define TEST_LEGACY_JSON "[{\"wifiName\":\"OldStation\",\"lat\":50.08,\"lon\":14.42,\"apiKey\":\"0123456789abcdef\"," \
+  "\"screenSaver\":false,\"screenSaverTime\":600000,\"DNDFrom\":22,\"celsius\":false,\"rotateDisplay\":true}]"
+
+///////////////// CODE
+namespace
+{
+  // A configuration told apart from the others by its API key
+  SDeviceConfig MakeConfig(const char* apiKey)
+  {
+    SDeviceConfig config;
+    strlcpy(config.m_apiKey, apiKey, sizeof(config.m_apiKey));
+    config.m_dndFrom = 21;
+    config.m_pageIntervals[PAGE_DEVICE_STATUS] = 30;
+    return config;
+  }
+
+  // What the next boot loads
+  SDeviceConfig Boot()
+  {
+    SPIFFS.CutPowerAfter(-1);
+    CDeviceConfig deviceConfig;
+    deviceConfig.Begin();
+    return deviceConfig.Get();
+  }
+
+  // The bytes the record of config is stored as
+  std::string MakeRecord(const char* apiKey)
+  {
+    std::map<std::string, std::string>& files = SPIFFS.GetFiles();
+    files.clear();
+    CDeviceConfig deviceConfig;
+    CHECK(deviceConfig.Save(MakeConfig(apiKey)));
+    return files[DEVICE_CONFIG_FILE];
+  }
+
+  // Changes the header of a record, the CRC is made to match it again
+  std::string RewriteRecord(std::string record, uint16_t version, uint16_t size)
+  {
+    SDeviceConfigHeader header;
+    memcpy(&header, record.data(), sizeof(header));
+    header.m_version = version;
+    header.m_size = size;
+    record.resize(sizeof(header) + size);
+    header.m_crc = Crc32(record.data() + sizeof(header), size);
+    memcpy(&record[0], &header, sizeof(header));
+    return record;
+  }
+
+  void CheckApiKey(const char* expected, const SDeviceConfig& config)
+  {
+    if(strcmp(expected, config.m_apiKey) != 0)
+    {
+      fprintf(stderr, "loaded the configuration %s, expected %s\n", config.m_apiKey, expected);
+      exit(1);
+    }
+  }
+
+  // The power goes at each operation of a save in turn. The next boot has to
+  // come up with the old or the new configuration, the new one from the
+  // point on where the save can't be lost anymore, and the save after it has
+  // to get through.
+  int TestPowerCut()
+  {
+    std::map<std::string, std::string>& files = SPIFFS.GetFiles();
+    const std::string previous = MakeRecord("previous");
+    const std::string current = MakeRecord("current");
+
+    bool newLoaded = false;
+    int operation = 0;
+    for(;; ++operation)
+    {
+      files.clear();
+      files[DEVICE_CONFIG_FILE] = current;
+      files[DEVICE_CONFIG_PREVIOUS_FILE] = previous;
+
+      CDeviceConfig deviceConfig;
+      deviceConfig.Begin();
+      CheckApiKey("current", deviceConfig.Get());
+
+      SPIFFS.CutPowerAfter(operation);
+      deviceConfig.Save(MakeConfig("new"));
+      const bool powerCut = SPIFFS.IsPowerCut();
+
+      const SDeviceConfig loaded = Boot();
+      if(strcmp(loaded.m_apiKey, "new") == 0)
+      {
+        newLoaded = true;
+      }
+      else
+      {
+        CHECK(!newLoaded);
+        CheckApiKey("current", loaded);
+      }
+      CHECK_EQUAL(21, loaded.m_dndFrom);
+      CHECK_EQUAL(30, loaded.m_pageIntervals[PAGE_DEVICE_STATUS]);
+
+      CDeviceConfig afterReboot;
+      afterReboot.Begin();
+      CHECK(afterReboot.Save(MakeConfig("after")));
+      CheckApiKey("after", Boot());
+
+      if(!powerCut)
+      {
+        break;
+      }
+    }
+
+    // The torn write of the temp record is the second operation
+    CHECK(newLoaded);
+    CHECK(operation > 2);
+    return operation;
+  }
+
+  // config.bin, then a temp record a save left behind, then the previous
+  // generation, then the defaults
+  void TestFallbackOrder()
+  {
+    std::map<std::string, std::string>& files = SPIFFS.GetFiles();
+    const std::string current = MakeRecord("current");
+    const std::string temp = MakeRecord("temp");
+    const std::string previous = MakeRecord("previous");
+    std::string broken = current;
+    broken[sizeof(SDeviceConfigHeader)] ^= 0x01;
+
+    files.clear();
+    files[DEVICE_CONFIG_FILE] = current;
+    files[DEVICE_CONFIG_TEMP_FILE] = temp;
+    files[DEVICE_CONFIG_PREVIOUS_FILE] = previous;
+    CheckApiKey("current", Boot());
+
+    files[DEVICE_CONFIG_FILE] = broken;
+    CheckApiKey("temp", Boot());
+
+    files[DEVICE_CONFIG_FILE] = broken;
+    files[DEVICE_CONFIG_TEMP_FILE] = broken;
+    CheckApiKey("previous", Boot());
+
+    // Nothing valid left, the defaults are loaded and stored
+    files.clear();
+    files[DEVICE_CONFIG_FILE] = broken;
+    files[DEVICE_CONFIG_PREVIOUS_FILE] = broken.substr(0, broken.size() / 2);
+    CheckApiKey(SDeviceConfig().m_apiKey, Boot());
+    CheckApiKey(SDeviceConfig().m_apiKey, Boot());
+    CHECK(files[DEVICE_CONFIG_FILE] != broken);
+  }
+
+  // Each of them is passed over for the previous generation
+  void TestInvalidRecords()
+  {
+    std::map<std::string, std::string>& files = SPIFFS.GetFiles();
+    const std::string previous = MakeRecord("previous");
+    const std::string current = MakeRecord("current");
+    const uint16_t size = deviceConfigSizes[DEVICE_CONFIG_VERSION];
+
+    std::string badCrc = current;
+    badCrc[offsetof(SDeviceConfigHeader, m_crc)] ^= 0x80;
+    std::string badMagic = current;
+    badMagic[0] ^= 0x01;
+
+    const std::string invalid[] = {
+      badCrc,
+      badMagic,
+      current.substr(0, current.size() - 1),
+      current + '\0',
+      RewriteRecord(current, 0, size),
+      RewriteRecord(current, DEVICE_CONFIG_VERSION + 1, size),
+      RewriteRecord(current, DEVICE_CONFIG_VERSION, size - 1),
+      RewriteRecord(current + std::string(2, '\0'), DEVICE_CONFIG_VERSION, size + 2),
+      std::string()
+    };
+
+    files.clear();
+    files[DEVICE_CONFIG_FILE] = RewriteRecord(current, DEVICE_CONFIG_VERSION, size);
+    CheckApiKey("current", Boot());
+
+    for(const std::string& record : invalid)
+    {
+      files.clear();
+      files[DEVICE_CONFIG_FILE] = record;
+      files[DEVICE_CONFIG_PREVIOUS_FILE] = previous;
+      CheckApiKey("previous", Boot());
+    }
+  }
+
+  // A device updated from the JSON file firmware keeps its settings, the
+  // pages added since stay off
+  void TestLegacyMigration()
+  {
+    std::map<std::string, std::string>& files = SPIFFS.GetFiles();
+    files.clear();
+    files[DEVICE_CONFIG_LEGACY_FILE] = TEST_LEGACY_JSON;
+
+    const SDeviceConfig config = Boot();
+    const SDeviceConfig defaults;
+    CHECK(strcmp("OldStation", config.m_wifiName) == 0);
+    CheckApiKey("0123456789abcdef", config);
+    CHECK(config.m_lat > 50.07f && config.m_lat < 50.09f);
+    CHECK(config.m_lon > 14.41f && config.m_lon < 14.43f);
+    CHECK(!config.m_screenSaver);
+    CHECK_EQUAL(600000, config.m_screenSaverTime);
+    CHECK_EQUAL(defaults.m_screenSaverTimeOff, config.m_screenSaverTimeOff);
+    CHECK_EQUAL(22, config.m_dndFrom);
+    CHECK_EQUAL(defaults.m_dndTo, config.m_dndTo);
+    CHECK(!config.m_celsius);
+    CHECK(config.m_rotateDisplay);
+    for(uint8_t page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+    {
+      CHECK_EQUAL(0, config.m_pageIntervals[page]);
+    }
+
+    // Stored as a record, the JSON file is gone
+    CHECK(!SPIFFS.exists(DEVICE_CONFIG_LEGACY_FILE));
+    CHECK(SPIFFS.exists(DEVICE_CONFIG_FILE));
+    CHECK(strcmp("OldStation", Boot().m_wifiName) == 0);
+
+    // One that can't be read leaves the defaults
+    files.clear();
+    files[DEVICE_CONFIG_LEGACY_FILE] = "[{\"wifiName\":";
+    CHECK(strcmp(defaults.m_wifiName, Boot().m_wifiName) == 0);
+    CHECK_EQUAL(PAGE_WEATHER_DEFAULT_INTERVAL, Boot().m_pageIntervals[PAGE_WEATHER]);
+  }
+}
+
+int main()
+{
+  const int operations = TestPowerCut();
+  TestFallbackOrder();
+  TestInvalidRecords();
+  TestLegacyMigration();
+
+  printf("device_config_test: power cut at each of %d operations of a save OK\n", operations);
+  return 0;
+}
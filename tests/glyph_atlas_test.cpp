@@ -0,0 +1,92 @@
+// Every glyph of the atlas tools/generate_assets.py generated against the
+// same glyph drawn by u8g2 from its font: the lit pixels, where they sit from
+// the cursor and the advance have to match, so the temperatures don't change
+// by being drawn from the atlas.
+#include "GlyphAtlas.h"
+#include "TestHelpers.h"
+#include "u8g2.h"
+
+///////////////// DEFINES
+// Cursor on the baseline, with room for the tallest glyph above it
+#define TEST_CURSOR_X 40
+#define TEST_CURSOR_Y 48
+#define TEST_BUFFER_W 128
+#define TEST_BUFFER_H 64
+
+///////////////// CODE
+#ifdef GLYPH_ATLAS_GENERATED
+namespace
+{
+  // Indexed by EGlyphFont, as GLYPH_FONTS in tools/generate_assets.py
+  const uint8_t* const fonts[] = {
+    u8g2_font_fub30_tn,
+    u8g2_font_fub14_tn,
+    u8g2_font_helvR12_tf
+  };
+  static_assert(sizeof(fonts) / sizeof(fonts[0]) == GLYPH_FONT_COUNT, "Every EGlyphFont needs a font");
+
+  // U8G2_R0 buffer: pages of 8 rows, least significant bit on top
+  bool IsBufferPixelLit(u8g2_t& u8g2, int x, int y)
+  {
+    return u8g2_GetBufferPtr(&u8g2)[(y >> 3) * TEST_BUFFER_W + x] >> (y & 7) & 1;
+  }
+
+  bool IsAtlasPixelLit(const SAtlasGlyph& glyph, int x, int y)
+  {
+    if(x < 0 || y < 0 || x >= glyph.m_width || y >= glyph.m_height)
+    {
+      return false;
+    }
+    const uint8_t* data = CGlyphAtlas::GetGlyphData(glyph);
+    return data[(x >> 3) * glyph.m_height + glyph.m_height - 1 - y] >> (x & 7) & 1;
+  }
+}
+
+int main()
+{
+  u8g2_t u8g2;
+  u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+
+  int pixels = 0;
+  for(uint8_t index = 0; index < GLYPH_ATLAS_GLYPH_COUNT; ++index)
+  {
+    SAtlasGlyph glyph;
+    memcpy_P(&glyph, &glyph_atlas_glyphs[index], sizeof(glyph));
+    CHECK(glyph.m_font < GLYPH_FONT_COUNT);
+
+    SAtlasGlyph found;
+    CHECK(CGlyphAtlas::GetGlyph(glyph.m_font, glyph.m_character, found));
+    CHECK_EQUAL(glyph.m_data, found.m_data);
+
+    u8g2_ClearBuffer(&u8g2);
+    u8g2_SetFont(&u8g2, fonts[glyph.m_font]);
+    CHECK_EQUAL(glyph.m_advance, u8g2_DrawGlyph(&u8g2, TEST_CURSOR_X, TEST_CURSOR_Y, static_cast<uint8_t>(glyph.m_character)));
+
+    for(int y = 0; y < TEST_BUFFER_H; ++y)
+    {
+      for(int x = 0; x < TEST_BUFFER_W; ++x)
+      {
+        const bool lit = IsBufferPixelLit(u8g2, x, y);
+        if(lit != IsAtlasPixelLit(glyph, x - TEST_CURSOR_X - glyph.m_offsetX, y - TEST_CURSOR_Y - glyph.m_offsetY))
+        {
+          fprintf(stderr, "glyph 0x%02X of font %d: pixel %d, %d from the cursor is %s by u8g2\n", static_cast<uint8_t>(glyph.m_character), glyph.m_font,
+            x - TEST_CURSOR_X, y - TEST_CURSOR_Y, lit ? "lit" : "not lit");
+          return 1;
+        }
+        pixels += lit;
+      }
+    }
+  }
+
+  printf("glyph_atlas_test: %d glyphs, %d pixels same as u8g2 OK\n", GLYPH_ATLAS_GLYPH_COUNT, pixels);
+  return 0;
+}
+#else
+// Built only where U8g2 is there to generate the atlas from, an empty one
+// means glyph_atlas.h was committed without it and the fonts are linked
+int main()
+{
+  fprintf(stderr, "glyph_atlas_test: the atlas is empty, run tools/generate_assets.py with U8g2 and commit glyph_atlas.h\n");
+  return 1;
+}
+#endif
@@ -0,0 +1,535 @@
+// COneCallParser against the deserializeJson() path it replaced. Every sample
+// in data/ is fed whole, one byte at a time and in random slices; the kept
+// fields and the SWeatherInfo derived from them have to match what the old
+// CheckWeather() read from the ArduinoJson document. Truncated bodies must
+// never look like a complete forecast and malformed ones are checked against
+// a table of expected outcomes.
+//
+// The samples are shaped like OneCall 2.5 responses (the compact one as the
+// sketch requests it, a pretty printed one with CRLF line ends and a full one
+// with nothing excluded). Usage: onecall_parser_test data/*.json
+//
+// Both paths are timed on every sample as well: the old one deserializes the
+// whole body and walks hourly three times, the new one streams the body in TCP
+// segments through the parser and digests the timeline in one pass. The times
+// are printed, not checked.
+#include <initializer_list>
+#include <math.h>
+#include <string>
+#include <vector>
+
+#include <ArduinoJson.h>
+
+#include "ForecastDigest.h"
+#include "TestHelpers.h"
+
+///////////////// DEFINES
+#define TEST_DOCUMENT_CAPACITY (128 * 1024)
+#define TEST_RANDOM_SLICE_RUNS 200
+#define TEST_RANDOM_SLICE_MAX 64
+#define TEST_FLOAT_TOLERANCE 1e-4f
+#define TEST_SEGMENT_SIZE 1460
+#define TEST_MALFORMED_SAMPLE "onecall_prague.json"
+#define TEST_BENCHMARK_RUNS 200
+
+#define SECONDS_IN_HOUR 3600UL
+#define SECONDS_IN_DAY (SECONDS_IN_HOUR * 24)
+
+///////////////// CODE
+namespace
+{
+  // weatherTypeWorstness of the old sketch, with 762 in place of the 752 it
+  // listed (see weather_codes_test.cpp)
+  const unsigned int oldWorstness[] = {
+    202, 212, 232, 201, 200, 231, 230, 221, 211, 210,
+    314, 302, 312, 313, 311, 321, 310, 301, 300,
+    504, 503, 511, 502, 522, 501, 531, 521, 520, 500,
+    622, 616, 621, 620, 615, 613, 612, 602, 611, 601, 600,
+    701, 711, 721, 731, 741, 751, 761, 762, 771, 781,
+    804, 803, 802, 801, 800
+  };
+
+  enum EExpect : uint8_t
+  {
+    EXPECT_ERROR = 0,     // HasError()
+    EXPECT_NOT_DONE,      // Neither done nor an error, the fetcher reports it truncated
+    EXPECT_SAME_AS_CLEAN  // Done, same result as the unmodified sample
+  };
+
+  struct SMalformed
+  {
+    const char* m_name;
+    const char* m_find;     // First occurrence is replaced, nullptr replaces the whole body
+    const char* m_replace;
+    EExpect m_expect;
+  };
+
+  // Applied to TEST_MALFORMED_SAMPLE
+  const SMalformed malformed[] = {
+    { "html error page",          nullptr,                 "<html><body><h1>502 Bad Gateway</h1></body></html>", EXPECT_NOT_DONE },
+    { "empty body",               nullptr,                 "",                       EXPECT_NOT_DONE },
+    { "leading close",            "{\"lat\"",              "}{\"lat\"",              EXPECT_ERROR },
+    { "entry closed as array",    "\"icon\":\"04d\"}],",   "\"icon\":\"04d\"}]],",   EXPECT_ERROR },
+    { "letter in dt",             "\"dt\":1696150800",     "\"dt\":16x96150800",     EXPECT_ERROR },
+    { "two dots in feels_like",   "\"feels_like\":",       "\"feels_like\":12.5.3,\"x\":", EXPECT_ERROR },
+    { "bare minus in pop",        "\"pop\":",              "\"pop\":-,\"x\":",       EXPECT_ERROR },
+    // Values of skipped keys aren't validated, deserializeJson() rejects this one
+    { "missing colon, skipped key", "\"pressure\":",       "\"pressure\" ",          EXPECT_SAME_AS_CLEAN }
+  };
+
+  struct SVariant
+  {
+    const char* m_name;
+    const char* m_find;
+    const char* m_replace;
+  };
+
+  // Valid JSON the parser has to read like deserializeJson() does
+  const SVariant variants[] = {
+    { "null pop",                 "\"pop\":",              "\"pop\":null,\"x\":" },
+    { "exponent feels_like",      "\"feels_like\":",       "\"feels_like\":1.25e1,\"x\":" },
+    { "integer feels_like",       "\"feels_like\":",       "\"feels_like\":-3,\"x\":" },
+    { "missing pop",              "\"pop\":",              "\"x\":" },
+    { "empty weather",            "\"weather\":[{",        "\"weather\":[],\"x\":[{" },
+    { "escaped skipped value",    "\"main\":\"",           "\"main\":\"\\\"\\\\\\u00e9\\/" },
+    { "nested hourly key",        "\"lat\":",              "\"current\":{\"hourly\":[{\"dt\":1,\"pop\":1}]},\"lat\":" },
+    { "deep skipped value",       "\"lat\":",              "\"deep\":[[[[[[{\"dt\":[1]}]]]]]],\"lat\":" },
+    { "whitespace",               "\"hourly\":[",          " \"hourly\" \t:\r\n [ \n" }
+  };
+
+  std::string ReadFile(const char* path)
+  {
+    FILE* file = fopen(path, "rb");
+    CHECK(file != nullptr);
+    std::string content;
+    char buffer[4096];
+    size_t length;
+    while((length = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+      content.append(buffer, length);
+    }
+    fclose(file);
+    return content;
+  }
+
+  std::string ReplaceFirst(const std::string& text, const char* find, const char* replace)
+  {
+    if(find == nullptr)
+    {
+      return replace;
+    }
+    const size_t position = text.find(find);
+    CHECK(position != std::string::npos);
+    return text.substr(0, position) + replace + text.substr(position + strlen(find));
+  }
+
+  // Feeds the body in slices of at most sliceMax bytes, a sliceMax of 0 picks
+  // random slice sizes from seed
+  void Parse(const char* body, size_t length, size_t sliceMax, uint32_t seed, COneCallParser& parser, SOneCallForecast& forecast)
+  {
+    parser.Reset(&forecast);
+
+    size_t position = 0;
+    while(position < length && !parser.IsDone() && !parser.HasError())
+    {
+      size_t slice = sliceMax;
+      if(slice == 0)
+      {
+        seed = seed * 1103515245UL + 12345UL;
+        slice = 1 + (seed >> 16) % TEST_RANDOM_SLICE_MAX;
+      }
+      slice = min(slice, length - position);
+
+      const size_t consumed = parser.Feed(body + position, slice);
+      CHECK(consumed <= slice);
+      CHECK(consumed == slice || parser.IsDone() || parser.HasError());
+      position += consumed;
+    }
+  }
+
+  void Parse(const std::string& body, size_t sliceMax, uint32_t seed, COneCallParser& parser, SOneCallForecast& forecast)
+  {
+    Parse(body.data(), body.size(), sliceMax, seed, parser, forecast);
+  }
+
+  // What the old CheckWeather() read from the document, as a forecast
+  void ReadReference(const JsonDocument& document, SOneCallForecast& forecast)
+  {
+    forecast.m_timezoneOffset = document["timezone_offset"].as<long>();
+    forecast.m_hourly.clear();
+
+    JsonArrayConst hourly = document["hourly"];
+    for(JsonObjectConst entry : hourly)
+    {
+      if(forecast.m_hourly.full())
+      {
+        break;
+      }
+
+      SHourlyForecast hour;
+      hour.m_dt        = entry["dt"].as<unsigned long>();
+      hour.m_weatherId = entry["weather"][0]["id"].as<unsigned int>();
+      hour.m_pop       = entry["pop"].as<float>();
+      hour.m_feelsLike = entry["feels_like"].as<float>();
+      forecast.m_hourly.push_back(hour);
+    }
+  }
+
+  void CheckSameForecast(const SOneCallForecast& expected, const SOneCallForecast& actual)
+  {
+    CHECK_EQUAL(expected.m_timezoneOffset, actual.m_timezoneOffset);
+    CHECK_EQUAL(expected.m_hourly.size(), actual.m_hourly.size());
+    for(size_t index = 0; index < expected.m_hourly.size(); ++index)
+    {
+      CHECK_EQUAL(expected.m_hourly[index].m_dt, actual.m_hourly[index].m_dt);
+      CHECK_EQUAL(expected.m_hourly[index].m_weatherId, actual.m_hourly[index].m_weatherId);
+      CHECK(fabsf(expected.m_hourly[index].m_pop - actual.m_hourly[index].m_pop) < TEST_FLOAT_TOLERANCE);
+      CHECK(fabsf(expected.m_hourly[index].m_feelsLike - actual.m_hourly[index].m_feelsLike) < TEST_FLOAT_TOLERANCE);
+    }
+  }
+
+  // Entries of actual are the first ones of expected
+  void CheckPrefix(const SOneCallForecast& expected, const SOneCallForecast& actual)
+  {
+    CHECK(actual.m_hourly.size() <= expected.m_hourly.size());
+    for(size_t index = 0; index < actual.m_hourly.size(); ++index)
+    {
+      CHECK_EQUAL(expected.m_hourly[index].m_dt, actual.m_hourly[index].m_dt);
+      CHECK_EQUAL(expected.m_hourly[index].m_weatherId, actual.m_hourly[index].m_weatherId);
+    }
+  }
+
+  uint8_t OldRank(unsigned int weatherId)
+  {
+    for(uint8_t index = 0; index < sizeof(oldWorstness) / sizeof(oldWorstness[0]); ++index)
+    {
+      if(oldWorstness[index] == weatherId)
+      {
+        return index;
+      }
+    }
+    return WEATHER_RANK_UNKNOWN;
+  }
+
+  // The three walks of the old CheckWeather() over the document, plus the
+  // min/max the digest added
+  void OldDigest(const JsonDocument& document, SWeatherInfo& weatherInfo)
+  {
+    weatherInfo = SWeatherInfo();
+    JsonArrayConst hourly = document["hourly"];
+    if(hourly.size() == 0)
+    {
+      return;
+    }
+    const long timezoneOffset = document["timezone_offset"];
+
+    uint8_t worstRank = WEATHER_RANK_UNKNOWN;
+    uint8_t count = 0;
+    for(JsonObjectConst entry : hourly)
+    {
+      const unsigned int weatherId = entry["weather"][0]["id"];
+      if(OldRank(weatherId) < worstRank)
+      {
+        worstRank = OldRank(weatherId);
+        weatherInfo.m_weatherId = weatherId;
+      }
+      if(++count == WEATHER_CONDITIONS_COUNT_MAX)
+      {
+        break;
+      }
+    }
+
+    for(JsonObjectConst entry : hourly)
+    {
+      const float pop = entry["pop"];
+      weatherInfo.m_pop[weatherInfo.m_popCount++] = uint8_t(min(max(pop, 0.f), 1.f) * 100.f + 0.5f);
+      if(weatherInfo.m_popCount == PROBABILITY_OF_PERCEPTION_MAX_COUNT)
+      {
+        break;
+      }
+    }
+
+    weatherInfo.m_currentTemp = RoundTemperature(hourly[0]["feels_like"].as<float>());
+
+    float midnightTemperature = 0.f;
+    bool skippedFirst = false;
+    for(JsonObjectConst entry : hourly)
+    {
+      if(!skippedFirst)
+      {
+        skippedFirst = true;
+        continue;
+      }
+      const unsigned long epochTime = entry["dt"];
+      if((epochTime + timezoneOffset) % SECONDS_IN_DAY / SECONDS_IN_HOUR == 0)
+      {
+        midnightTemperature = entry["feels_like"];
+        break;
+      }
+    }
+    weatherInfo.m_eveningTemp = RoundTemperature(midnightTemperature);
+
+    weatherInfo.m_minTemp = weatherInfo.m_currentTemp;
+    weatherInfo.m_maxTemp = weatherInfo.m_currentTemp;
+    count = 0;
+    for(JsonObjectConst entry : hourly)
+    {
+      const short temperature = RoundTemperature(entry["feels_like"].as<float>());
+      weatherInfo.m_minTemp = min<int16_t>(weatherInfo.m_minTemp, temperature);
+      weatherInfo.m_maxTemp = max<int16_t>(weatherInfo.m_maxTemp, temperature);
+      if(++count == ONECALL_HOURLY_MAX_COUNT)
+      {
+        break;
+      }
+    }
+  }
+
+  void CheckSameWeatherInfo(const SWeatherInfo& expected, const SWeatherInfo& actual)
+  {
+    CHECK_EQUAL(expected.m_weatherId, actual.m_weatherId);
+    CHECK_EQUAL(expected.m_currentTemp, actual.m_currentTemp);
+    CHECK_EQUAL(expected.m_eveningTemp, actual.m_eveningTemp);
+    CHECK_EQUAL(expected.m_minTemp, actual.m_minTemp);
+    CHECK_EQUAL(expected.m_maxTemp, actual.m_maxTemp);
+    CHECK_EQUAL(expected.m_popCount, actual.m_popCount);
+    for(uint8_t index = 0; index < expected.m_popCount; ++index)
+    {
+      CHECK_EQUAL(expected.m_pop[index], actual.m_pop[index]);
+    }
+  }
+
+  // Parses body in every way and checks it against deserializeJson(), which
+  // has to accept it
+  void CheckAgainstReference(const std::string& body)
+  {
+    DynamicJsonDocument document(TEST_DOCUMENT_CAPACITY);
+    const DeserializationError error = deserializeJson(document, body.data(), body.size());
+    if(error)
+    {
+      fprintf(stderr, "deserializeJson() failed: %s\n", error.c_str());
+      exit(1);
+    }
+
+    SOneCallForecast expected;
+    ReadReference(document, expected);
+    CHECK(expected.m_hourly.size() > 0);
+
+    SWeatherInfo expectedInfo;
+    OldDigest(document, expectedInfo);
+
+    COneCallParser parser;
+    SOneCallForecast forecast;
+    const size_t sliceSizes[] = { body.size(), 1, 2, 7, TEST_SEGMENT_SIZE };
+    for(size_t sliceSize : sliceSizes)
+    {
+      Parse(body, sliceSize, 0, parser, forecast);
+      CHECK(parser.IsDone());
+      CHECK(!parser.HasError());
+      CheckSameForecast(expected, forecast);
+    }
+
+    for(uint32_t seed = 1; seed <= TEST_RANDOM_SLICE_RUNS; ++seed)
+    {
+      Parse(body, 0, seed, parser, forecast);
+      CHECK(parser.IsDone());
+      CheckSameForecast(expected, forecast);
+    }
+
+    SForecastTimeline timeline;
+    BuildTimeline(forecast, timeline);
+    SWeatherInfo weatherInfo;
+    DigestTimeline(timeline, 0, weatherInfo);
+    CheckSameWeatherInfo(expectedInfo, weatherInfo);
+  }
+
+  // Every prefix of the body: no errors, and a forecast only when the parser
+  // has seen all it needs
+  void CheckTruncated(const std::string& body)
+  {
+    DynamicJsonDocument document(TEST_DOCUMENT_CAPACITY);
+    CHECK(!deserializeJson(document, body.data(), body.size()));
+    SOneCallForecast expected;
+    ReadReference(document, expected);
+
+    COneCallParser parser;
+    SOneCallForecast forecast;
+    for(size_t length = 0; length < body.size(); ++length)
+    {
+      Parse(body.data(), length, 0, length, parser, forecast);
+      CHECK(!parser.HasError());
+      if(parser.IsDone())
+      {
+        CheckSameForecast(expected, forecast);
+      }
+      else
+      {
+        CheckPrefix(expected, forecast);
+      }
+
+      // Spot check that the old path refused the same bodies
+      if(length > 0 && length % 997 == 0)
+      {
+        CHECK(deserializeJson(document, body.data(), length) == DeserializationError::IncompleteInput);
+      }
+    }
+  }
+
+  void CheckMalformed(const std::string& clean)
+  {
+    COneCallParser parser;
+    SOneCallForecast cleanForecast;
+    Parse(clean, clean.size(), 0, parser, cleanForecast);
+    CHECK(parser.IsDone());
+
+    for(const SMalformed& test : malformed)
+    {
+      const std::string body = ReplaceFirst(clean, test.m_find, test.m_replace);
+
+      DynamicJsonDocument document(TEST_DOCUMENT_CAPACITY);
+      CHECK(deserializeJson(document, body.data(), body.size()));
+
+      for(size_t sliceSize : { body.size(), size_t(1) })
+      {
+        SOneCallForecast forecast;
+        Parse(body, sliceSize, 0, parser, forecast);
+
+        bool passed = false;
+        switch(test.m_expect)
+        {
+        case EXPECT_ERROR:
+          passed = parser.HasError();
+          break;
+
+        case EXPECT_NOT_DONE:
+          passed = !parser.IsDone() && !parser.HasError();
+          break;
+
+        case EXPECT_SAME_AS_CLEAN:
+          passed = parser.IsDone() && !parser.HasError();
+          if(passed)
+          {
+            CheckSameForecast(cleanForecast, forecast);
+          }
+          break;
+        }
+
+        if(!passed)
+        {
+          fprintf(stderr, "malformed \"%s\": done %d error %d\n", test.m_name, parser.IsDone(), parser.HasError());
+          exit(1);
+        }
+      }
+    }
+
+    for(const SVariant& test : variants)
+    {
+      CheckAgainstReference(ReplaceFirst(clean, test.m_find, test.m_replace));
+    }
+  }
+
+  // Skipped values nested up to ONECALL_PARSER_NESTING_MAX are read past,
+  // deeper ones are an error however deep they go
+  void CheckNesting(const std::string& clean)
+  {
+    COneCallParser parser;
+    SOneCallForecast cleanForecast;
+    Parse(clean, clean.size(), 0, parser, cleanForecast);
+
+    for(int levels : { ONECALL_PARSER_NESTING_MAX - 1, ONECALL_PARSER_NESTING_MAX, 255, 256, 300 })
+    {
+      const std::string nested = "\"deep\":" + std::string(levels, '[') + std::string(levels, ']') + ",\"lat\":";
+      const std::string body = ReplaceFirst(clean, "\"lat\":", nested.c_str());
+
+      SOneCallForecast forecast;
+      Parse(body, TEST_SEGMENT_SIZE, 0, parser, forecast);
+      if(levels < ONECALL_PARSER_NESTING_MAX)
+      {
+        CHECK(parser.IsDone() && !parser.HasError());
+        CheckSameForecast(cleanForecast, forecast);
+      }
+      else
+      {
+        CHECK(parser.HasError());
+      }
+    }
+  }
+
+  // Host microseconds per body of the old and the new path, and of their
+  // walks over data already parsed
+  void Benchmark(const std::string& body)
+  {
+    volatile unsigned int sink = 0;
+    SWeatherInfo weatherInfo;
+
+    unsigned long start = micros();
+    for(int run = 0; run < TEST_BENCHMARK_RUNS; ++run)
+    {
+      DynamicJsonDocument document(TEST_DOCUMENT_CAPACITY);
+      deserializeJson(document, body.data(), body.size());
+      OldDigest(document, weatherInfo);
+      sink = sink + weatherInfo.m_weatherId;
+    }
+    const unsigned long oldPath = micros() - start;
+
+    DynamicJsonDocument document(TEST_DOCUMENT_CAPACITY);
+    deserializeJson(document, body.data(), body.size());
+    start = micros();
+    for(int run = 0; run < TEST_BENCHMARK_RUNS; ++run)
+    {
+      OldDigest(document, weatherInfo);
+      sink = sink + weatherInfo.m_weatherId;
+    }
+    const unsigned long oldWalks = micros() - start;
+
+    COneCallParser parser;
+    SOneCallForecast forecast;
+    SForecastTimeline timeline;
+    start = micros();
+    for(int run = 0; run < TEST_BENCHMARK_RUNS; ++run)
+    {
+      Parse(body, TEST_SEGMENT_SIZE, 0, parser, forecast);
+      BuildTimeline(forecast, timeline);
+      DigestTimeline(timeline, 0, weatherInfo);
+      sink = sink + weatherInfo.m_weatherId;
+    }
+    const unsigned long newPath = micros() - start;
+
+    start = micros();
+    for(int run = 0; run < TEST_BENCHMARK_RUNS; ++run)
+    {
+      DigestTimeline(timeline, 0, weatherInfo);
+      sink = sink + weatherInfo.m_weatherId;
+    }
+    const unsigned long newWalk = micros() - start;
+
+    printf("onecall_parser_test: old %.1f us (3 walks %.2f us), new %.1f us (digest %.2f us) per body\n",
+      static_cast<double>(oldPath) / TEST_BENCHMARK_RUNS, static_cast<double>(oldWalks) / TEST_BENCHMARK_RUNS,
+      static_cast<double>(newPath) / TEST_BENCHMARK_RUNS, static_cast<double>(newWalk) / TEST_BENCHMARK_RUNS);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  CHECK(argc > 1);
+
+  const char* malformedSample = nullptr;
+  for(int arg = 1; arg < argc; ++arg)
+  {
+    const std::string body = ReadFile(argv[arg]);
+    CheckAgainstReference(body);
+    CheckTruncated(body);
+    printf("onecall_parser_test: %s, %zu bytes OK\n", argv[arg], body.size());
+    Benchmark(body);
+
+    if(strstr(argv[arg], TEST_MALFORMED_SAMPLE) != nullptr)
+    {
+      malformedSample = argv[arg];
+    }
+  }
+
+  CHECK(malformedSample != nullptr);
+  CheckMalformed(ReadFile(malformedSample));
+  CheckNesting(ReadFile(malformedSample));
+  printf("onecall_parser_test: %zu malformed, %zu variants OK\n", sizeof(malformed) / sizeof(malformed[0]), sizeof(variants) / sizeof(variants[0]));
+  return 0;
+}
@@ -0,0 +1,512 @@
+// Headless render of every screen and carousel page of CWeatherDisplay with
+// the real u8g2 drawing code. Each screen is written as the PBM the
+// screenshot endpoint would serve and compared with its golden image, the
+// time each one took to draw on the host is printed along. A screen without
+// a golden image fails, `make golden` writes them.
+//
+// Besides the OneCall samples the weather screen is drawn from generated
+// timelines: every weather type by day and by night, with the temperature
+// sign and width, the PoP pattern and the status marks cycled through so
+// each of their combinations shows up.
+//
+// The weather icons are timed at the end on the 64 column screen: drawn the
+// old way, XBM through drawXBMP() with draw color 0, against the icon layer
+// as the weather screen redraws it from the page bitmaps now.
+//
+// Usage: render_test [--update] <golden dir> <output dir>
+// --update writes the renders as the new golden images.
+#include <string>
+#include <vector>
+
+#include "WeatherDisplay.h"
+#include "ForecastDigest.h"
+#include "OneCallParser.h"
+#include "TestHelpers.h"
+
+///////////////// DEFINES
+#define TEST_START_MILLIS 3723000UL
+#define TEST_SSID "WeatherStation"
+#define TEST_IP "192.168.1.42"
+#define TEST_PBM_HEADER_SIZE 10
+#define TEST_BENCHMARK_RUNS 1000
+#define TEST_MAIN_ICON "../assets/weather/rain_56x56.xbm"
+#define TEST_AUX_ICON "../assets/weather/more_rain_25x25.xbm"
+// Generated timelines: a day of hours starting on the hour, the current hour
+// half an hour in
+#define TEST_TIMELINE_FIRST_DT 1700002800UL
+#define TEST_TIMELINE_HOURS 24
+#define TEST_NAME_SIZE 64
+
+///////////////// CODE
+namespace
+{
+  CWeatherDisplay display;
+
+  class CStringPrint : public Print
+  {
+    public:
+      size_t write(uint8_t value) override { m_text += static_cast<char>(value); return 1; }
+      using Print::write;
+
+      std::string m_text;
+  };
+
+  void FillDeviceStatus(SDeviceStatus& status)
+  {
+    status.m_ip = IPAddress(192, 168, 1, 42);
+    status.m_rssi = -67;
+    status.m_freeHeap = 23456;
+  }
+
+  std::string ReadFile(const std::string& path)
+  {
+    std::string content;
+    FILE* file = fopen(path.c_str(), "rb");
+    if(file == nullptr)
+    {
+      return content;
+    }
+    char buffer[4096];
+    size_t length;
+    while((length = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+      content.append(buffer, length);
+    }
+    fclose(file);
+    return content;
+  }
+
+  void WriteFile(const std::string& path, const std::string& content)
+  {
+    FILE* file = fopen(path.c_str(), "wb");
+    if(file == nullptr)
+    {
+      fprintf(stderr, "can't write %s\n", path.c_str());
+      exit(1);
+    }
+    fwrite(content.data(), 1, content.size(), file);
+    fclose(file);
+  }
+
+  // Fills the display timeline from a OneCall sample, half an hour into its
+  // first hour
+  void LoadForecast(const char* path, bool isDay)
+  {
+    const std::string body = ReadFile(path);
+    CHECK(!body.empty());
+
+    SOneCallForecast forecast;
+    COneCallParser parser;
+    parser.Reset(&forecast);
+    parser.Feed(body.data(), body.size());
+    CHECK(parser.IsDone() && !parser.HasError());
+
+    SForecastTimeline& timeline = display.AcquireTimeline();
+    BuildTimeline(forecast, timeline);
+    display.SetLocalTime(timeline.m_firstDt + timeline.m_timezoneOffset + 1800);
+    display.PublishTimeline();
+    display.SetIsDay(isDay);
+  }
+
+  // Next frame of the weather screen, redrawn in full
+  void ShowWeather(bool rotated)
+  {
+    display.SetDisplayRotation(rotated);
+    AdvanceFakeMillis(1000);
+    display.UpdateDisplay();
+    display.FlushDisplay();
+  }
+
+  void DrawWeatherPrague()
+  {
+    LoadForecast("data/onecall_prague.json", true);
+    display.SetCelsiusSign(true);
+    ShowWeather(false);
+  }
+
+  void DrawWeatherNewYorkMarks()
+  {
+    LoadForecast("data/onecall_new_york_pretty.json", false);
+    display.SetCelsiusSign(false);
+    display.SetErrorMark(true);
+    display.SetStaleMark(true);
+    display.SetNoWifiConnectionMark(true);
+    ShowWeather(false);
+  }
+
+  void DrawWeatherRotated()
+  {
+    LoadForecast("data/onecall_berlin_full.json", true);
+    display.SetCelsiusSign(true);
+    display.SetErrorMark(false);
+    display.SetStaleMark(false);
+    display.SetNoWifiConnectionMark(false);
+    ShowWeather(true);
+  }
+
+  // The carousel moves on to the next page
+  void NextPage()
+  {
+    AdvanceFakeMillis(1000);
+    display.UpdateDisplay();
+    display.FlushDisplay();
+  }
+
+  void DrawTemperatureGraph()
+  {
+    ShowWeather(false);
+    for(uint8_t page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+    {
+      display.SetPageInterval(static_cast<EDisplayPage>(page), 1);
+    }
+    NextPage();
+    CHECK_EQUAL(PAGE_TEMPERATURE_GRAPH, display.GetCurrentPage());
+  }
+
+  void DrawPoPChart()
+  {
+    NextPage();
+    CHECK_EQUAL(PAGE_POP_CHART, display.GetCurrentPage());
+  }
+
+  void DrawDeviceStatus()
+  {
+    NextPage();
+    CHECK_EQUAL(PAGE_DEVICE_STATUS, display.GetCurrentPage());
+  }
+
+  void DrawWeatherAfterCarousel()
+  {
+    NextPage();
+    CHECK_EQUAL(PAGE_WEATHER, display.GetCurrentPage());
+    for(uint8_t page = 0; page < DISPLAY_PAGE_COUNT; ++page)
+    {
+      display.SetPageInterval(static_cast<EDisplayPage>(page), 0);
+    }
+  }
+
+  void DrawWiFiAnimation()
+  {
+    display.ResetAnimationFrames();
+    display.UpdateWiFiAnimation(TEST_SSID);
+  }
+
+  void DrawWiFiConnected()
+  {
+    display.UpdateWiFiConnectedState(TEST_SSID, String(TEST_IP));
+  }
+
+  void DrawWiFiHelp()
+  {
+    display.DisplayWiFiConfigurationHelpText(TEST_SSID);
+  }
+
+  struct SScreen
+  {
+    const char* m_name;
+    void (*m_draw)();
+  };
+
+  // In order, later screens start from the state the earlier ones left
+  const SScreen screens[] = {
+    { "weather_prague",          DrawWeatherPrague },
+    { "weather_new_york_marks",  DrawWeatherNewYorkMarks },
+    { "weather_berlin_rotated",  DrawWeatherRotated },
+    { "page_temperature_graph",  DrawTemperatureGraph },
+    { "page_pop_chart",          DrawPoPChart },
+    { "page_device_status",      DrawDeviceStatus },
+    { "page_weather",            DrawWeatherAfterCarousel },
+    { "wifi_animation",          DrawWiFiAnimation },
+    { "wifi_connected",          DrawWiFiConnected },
+    { "wifi_help",               DrawWiFiHelp }
+  };
+
+  // Names of EWeatherType for the screen names, UNKNOWN first
+  const char* const weatherTypeNames[] = {
+    "unknown",
+    "thunderstorm_light_rain", "thunderstorm_rain", "thunderstorm", "thunderstorm_heavy", "thunderstorm_heavy_rain",
+    "rain_light", "rain_light_day", "rain_light_night", "rain", "rain_day", "rain_night",
+    "rain_heavy", "rain_heavy_day", "rain_heavy_night", "rain_freezing", "rain_freezing_day", "rain_freezing_night",
+    "snow", "snow_heavy", "snow_shower", "snow_heavy_shower", "snow_rain", "snow_heavy_rain",
+    "mist",
+    "clear_day", "clear_night",
+    "clouds_light_day", "clouds_light_night", "clouds_medium_day", "clouds_medium_night", "clouds_heavy"
+  };
+  static_assert(sizeof(weatherTypeNames) / sizeof(weatherTypeNames[0]) == WEATHER_TYPE_COUNT + 1, "A name for every weather type");
+
+  // Current and evening temperature: sign, one and two digits, zero
+  const int16_t temperatures[][2] = { { -18, 4 }, { -4, -27 }, { 0, -1 }, { 6, 13 }, { 31, 0 } };
+  const char* const temperatureNames[] = { "m18", "m4", "0", "6", "31" };
+  const size_t temperatureCount = sizeof(temperatures) / sizeof(temperatures[0]);
+
+  enum EPoPPattern : uint8_t
+  {
+    POP_NONE,
+    POP_MIXED,
+    POP_ALL,
+    POP_PATTERN_COUNT
+  };
+  const char* const popNames[POP_PATTERN_COUNT] = { "pop0", "popmixed", "pop100" };
+
+  uint8_t GetPoP(EPoPPattern pattern, uint8_t hour)
+  {
+    switch(pattern)
+    {
+      case POP_NONE:
+        return 0;
+      case POP_MIXED:
+        return hour * 37 % 101;
+      default:
+        return 100;
+    }
+  }
+
+  // Weather code the table gives the type for, 0 when no code has it at that
+  // time of the day. UNKNOWN is code 0 itself.
+  unsigned int FindWeatherId(int type, bool isDay)
+  {
+    if(type == UNKNOWN)
+    {
+      return 0;
+    }
+    for(unsigned int weatherId = WEATHER_CODE_FIRST; weatherId <= WEATHER_CODE_LAST; ++weatherId)
+    {
+      if(GetWeatherCondition(weatherId, isDay).m_type == type)
+      {
+        return weatherId;
+      }
+    }
+    return 0;
+  }
+
+  struct SWeatherCase
+  {
+    char m_name[TEST_NAME_SIZE];
+    unsigned int m_weatherId;
+    bool m_isDay;
+    uint8_t m_temperatureIndex;
+    EPoPPattern m_pop;
+    bool m_marks;
+  };
+
+  // Every weather type the codes can give by day and by night. Temperature,
+  // PoP and marks are counted through together, with more cases than their
+  // combinations each combination is drawn.
+  std::vector<SWeatherCase> BuildWeatherCases()
+  {
+    std::vector<SWeatherCase> cases;
+    for(int type = UNKNOWN; type < WEATHER_TYPE_COUNT; ++type)
+    {
+      for(int isDay = 1; isDay >= 0; --isDay)
+      {
+        const unsigned int weatherId = FindWeatherId(type, isDay);
+        if(weatherId == 0 && type != UNKNOWN)
+        {
+          continue;
+        }
+
+        const size_t index = cases.size();
+        SWeatherCase weatherCase;
+        weatherCase.m_weatherId = weatherId;
+        weatherCase.m_isDay = isDay;
+        weatherCase.m_temperatureIndex = index % temperatureCount;
+        weatherCase.m_pop = static_cast<EPoPPattern>(index / temperatureCount % POP_PATTERN_COUNT);
+        weatherCase.m_marks = index / (temperatureCount * POP_PATTERN_COUNT) % 2;
+        snprintf(weatherCase.m_name, sizeof(weatherCase.m_name), "matrix_%s_%s_%s_%s%s", weatherTypeNames[type + 1], isDay ? "day" : "night",
+          temperatureNames[weatherCase.m_temperatureIndex], popNames[weatherCase.m_pop], weatherCase.m_marks ? "_marks" : "");
+        cases.push_back(weatherCase);
+      }
+    }
+
+    CHECK(cases.size() >= temperatureCount * POP_PATTERN_COUNT * 2);
+    return cases;
+  }
+
+  // The weather screen of a generated timeline, the evening temperature is the
+  // one at midnight
+  void DrawWeatherCase(const SWeatherCase& weatherCase)
+  {
+    SForecastTimeline& timeline = display.AcquireTimeline();
+    timeline.m_firstDt = TEST_TIMELINE_FIRST_DT;
+    timeline.m_timezoneOffset = 0;
+    timeline.m_count = TEST_TIMELINE_HOURS;
+    for(uint8_t hour = 0; hour < TEST_TIMELINE_HOURS; ++hour)
+    {
+      SForecastHour& entry = timeline.m_hours[hour];
+      entry.m_weatherId = weatherCase.m_weatherId;
+      entry.m_feelsLike = temperatures[weatherCase.m_temperatureIndex][hour == 0 ? 0 : 1];
+      entry.m_pop = GetPoP(weatherCase.m_pop, hour);
+    }
+    display.SetLocalTime(TEST_TIMELINE_FIRST_DT + 1800);
+    display.PublishTimeline();
+    display.SetIsDay(weatherCase.m_isDay);
+    // The degree sign with and without the C, every other temperature
+    display.SetCelsiusSign(weatherCase.m_temperatureIndex % 2);
+    display.SetErrorMark(weatherCase.m_marks);
+    display.SetStaleMark(weatherCase.m_marks);
+    display.SetNoWifiConnectionMark(weatherCase.m_marks);
+    ShowWeather(false);
+  }
+
+  // Bytes of an XBM file as the old sketch had them in PROGMEM
+  std::vector<uint8_t> ReadXbm(const char* path)
+  {
+    const std::string text = ReadFile(path);
+    CHECK(!text.empty());
+
+    std::vector<uint8_t> bitmap;
+    for(size_t position = text.find('{'); (position = text.find("0x", position)) != std::string::npos; position += 2)
+    {
+      bitmap.push_back(static_cast<uint8_t>(strtoul(text.c_str() + position, nullptr, 16)));
+    }
+    return bitmap;
+  }
+
+  // Host microseconds of drawing both icons per frame, before and after
+  void BenchmarkIcons()
+  {
+    const std::vector<uint8_t> mainIcon = ReadXbm(TEST_MAIN_ICON);
+    const std::vector<uint8_t> auxIcon = ReadXbm(TEST_AUX_ICON);
+    CHECK_EQUAL((WEATHER_ICON_W + 7) / 8 * WEATHER_ICON_H, mainIcon.size());
+    CHECK_EQUAL((WEATHER_ADDITIONAL_ICON_W + 7) / 8 * WEATHER_ADDITIONAL_ICON_H, auxIcon.size());
+
+    // The old DrawWeatherIcon(), straight on the u8g2 C library so the shim
+    // isn't timed along. Every pixel goes through the rotation.
+    u8g2_t* clib = display.GetPanel().getU8g2();
+    unsigned long start = micros();
+    for(int run = 0; run < TEST_BENCHMARK_RUNS; ++run)
+    {
+      u8g2_SetDrawColor(clib, 0);
+      u8g2_DrawXBMP(clib, CWeatherDisplay::SLayout::MAIN_ICON_X, 0, WEATHER_ICON_W, WEATHER_ICON_H, mainIcon.data());
+      u8g2_DrawXBMP(clib, CWeatherDisplay::SLayout::AUX_ICON_X, 0, WEATHER_ADDITIONAL_ICON_W, WEATHER_ADDITIONAL_ICON_H, auxIcon.data());
+      u8g2_SetDrawColor(clib, 1);
+    }
+    const unsigned long drawXbmp = micros() - start;
+
+    // SetIsDay() dirties the icon layer only, InternalUpdateWeatherDisplay()
+    // clears its box and blits the icons into it. GetLastIconDrawTime() is
+    // the blit alone, the number the telemetry of the device reports.
+    LoadForecast("data/onecall_prague.json", true);
+    ShowWeather(false);
+    const unsigned long fullRender = display.GetLastRenderTime();
+    unsigned long iconLayer = 0;
+    unsigned long iconBlit = 0;
+    for(int run = 0; run < TEST_BENCHMARK_RUNS; ++run)
+    {
+      display.SetIsDay(run & 1);
+      ShowWeather(false);
+      iconLayer += display.GetLastRenderTime();
+      iconBlit += display.GetLastIconDrawTime();
+    }
+
+    printf("render_test: icons by u8g2_DrawXBMP() %.2f us, by page blit %.2f us, icon layer redraw %.2f us, full weather screen %lu us\n",
+      static_cast<double>(drawXbmp) / TEST_BENCHMARK_RUNS, static_cast<double>(iconBlit) / TEST_BENCHMARK_RUNS,
+      static_cast<double>(iconLayer) / TEST_BENCHMARK_RUNS, fullRender);
+  }
+
+  // Pixels that differ between two PBMs of the same size
+  int CountDifferentPixels(const std::string& expected, const std::string& actual)
+  {
+    if(expected.size() != actual.size() || expected.compare(0, TEST_PBM_HEADER_SIZE, actual, 0, TEST_PBM_HEADER_SIZE) != 0)
+    {
+      return -1;
+    }
+
+    int pixels = 0;
+    for(size_t index = TEST_PBM_HEADER_SIZE; index < expected.size(); ++index)
+    {
+      pixels += __builtin_popcount(static_cast<uint8_t>(expected[index] ^ actual[index]));
+    }
+    return pixels;
+  }
+
+  // Writes what the screen shows and compares it with its golden image, or
+  // makes it the golden image. False when it differs or has none.
+  bool CheckScreen(const char* screenName, unsigned long drawUs, bool update, const std::string& goldenDir, const std::string& outputDir)
+  {
+    CStringPrint pbm;
+    display.PrintScreenPbm(pbm);
+
+    const std::string name = std::string(screenName) + ".pbm";
+    WriteFile(outputDir + "/" + name, pbm.m_text);
+
+    bool same = true;
+    const char* result = "";
+    if(update)
+    {
+      WriteFile(goldenDir + "/" + name, pbm.m_text);
+      result = "golden written";
+    }
+    else
+    {
+      const std::string golden = ReadFile(goldenDir + "/" + name);
+      const int pixels = CountDifferentPixels(golden, pbm.m_text);
+      if(golden.empty())
+      {
+        fprintf(stderr, "%s: no golden image %s/%s, render in %s/%s\n", screenName, goldenDir.c_str(), name.c_str(), outputDir.c_str(), name.c_str());
+        result = "NO GOLDEN";
+        same = false;
+      }
+      else if(pixels != 0)
+      {
+        fprintf(stderr, "%s: %d pixels differ from %s/%s, render in %s/%s\n", screenName, pixels, goldenDir.c_str(), name.c_str(), outputDir.c_str(), name.c_str());
+        result = "DIFFERS";
+        same = false;
+      }
+      else
+      {
+        result = "same";
+      }
+    }
+
+    printf("render_test: %-56s %6lu us, last render %5lu us: %s\n", screenName, drawUs, display.GetLastRenderTime(), result);
+    return same;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  const bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+  if(argc != (update ? 4 : 3))
+  {
+    fprintf(stderr, "usage: %s [--update] <golden dir> <output dir>\n", argv[0]);
+    return 2;
+  }
+  const std::string goldenDir = argv[update ? 2 : 1];
+  const std::string outputDir = argv[update ? 3 : 2];
+
+  SetFakeMillis(TEST_START_MILLIS);
+  const unsigned long beginStart = micros();
+  display.Begin();
+  printf("render_test: Begin() %lu us\n", micros() - beginStart);
+  display.SetDeviceStatusCb(FillDeviceStatus);
+
+  int failed = 0;
+  for(const SScreen& screen : screens)
+  {
+    const unsigned long drawStart = micros();
+    screen.m_draw();
+    failed += !CheckScreen(screen.m_name, micros() - drawStart, update, goldenDir, outputDir);
+  }
+
+  const std::vector<SWeatherCase> weatherCases = BuildWeatherCases();
+  for(const SWeatherCase& weatherCase : weatherCases)
+  {
+    const unsigned long drawStart = micros();
+    DrawWeatherCase(weatherCase);
+    failed += !CheckScreen(weatherCase.m_name, micros() - drawStart, update, goldenDir, outputDir);
+  }
+
+  // The small layout never had icons drawn the old way
+  if(!CWeatherDisplay::SLayout::SMALL)
+  {
+    BenchmarkIcons();
+  }
+
+  printf("render_test: %zu screens, %zu of them generated weather screens\n", sizeof(screens) / sizeof(screens[0]) + weatherCases.size(), weatherCases.size());
+  if(failed)
+  {
+    printf("render_test: %d screens differ or have no golden image\n", failed);
+  }
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,124 @@
+#include "Arduino.h"
+
+#include <chrono>
+#include <thread>
+
+///////////////// DEFINES
+// RTC user memory of the ESP8266, in bytes
+#define RTC_USER_MEMORY_SIZE 512
+
+///////////////// CODE
+HardwareSerial Serial;
+EspClass ESP;
+
+namespace
+{
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  bool fakeMillisSet = false;
+  unsigned long fakeMillis = 0;
+
+  uint8_t rtcUserMemory[RTC_USER_MEMORY_SIZE];
+}
+
+unsigned long millis()
+{
+  if(fakeMillisSet)
+  {
+    return fakeMillis;
+  }
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+unsigned long micros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void delay(unsigned long ms)
+{
+  if(fakeMillisSet)
+  {
+    fakeMillis += ms;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield()
+{
+}
+
+void SetFakeMillis(unsigned long ms)
+{
+  fakeMillisSet = true;
+  fakeMillis = ms;
+}
+
+void AdvanceFakeMillis(unsigned long ms)
+{
+  fakeMillis += ms;
+}
+
+size_t strlcpy(char* destination, const char* source, size_t size)
+{
+  const size_t length = strlen(source);
+  if(size)
+  {
+    const size_t copied = length < size - 1 ? length : size - 1;
+    memcpy(destination, source, copied);
+    destination[copied] = '\0';
+  }
+  return length;
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+  size_t written = 0;
+  while(size--)
+  {
+    written += write(*buffer++);
+  }
+  return written;
+}
+
+size_t Print::print(long value)
+{
+  char text[24];
+  snprintf(text, sizeof(text), "%ld", value);
+  return write(text);
+}
+
+size_t Print::print(unsigned long value)
+{
+  char text[24];
+  snprintf(text, sizeof(text), "%lu", value);
+  return write(text);
+}
+
+size_t Print::print(double value, int digits)
+{
+  char text[48];
+  snprintf(text, sizeof(text), "%.*f", digits, value);
+  return write(text);
+}
+
+bool EspClass::rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size)
+{
+  if(offset * 4 + size > RTC_USER_MEMORY_SIZE)
+  {
+    return false;
+  }
+  memcpy(data, rtcUserMemory + offset * 4, size);
+  return true;
+}
+
+bool EspClass::rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size)
+{
+  if(offset * 4 + size > RTC_USER_MEMORY_SIZE)
+  {
+    return false;
+  }
+  memcpy(rtcUserMemory + offset * 4, data, size);
+  return true;
+}
@@ -0,0 +1,138 @@
+#ifndef _ARDUINO_H
+#define _ARDUINO_H
+
+// Host stand-in for the parts of the ESP8266 Arduino core the sketch sources
+// use. PROGMEM is ordinary memory here, the _P functions are the plain ones.
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+
+#include "lwip/ip_addr.h"
+
+///////////////// DEFINES
+#define PROGMEM
+#define PSTR(text) (text)
+#define F(text) (reinterpret_cast<const __FlashStringHelper*>(PSTR(text)))
+
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t*>(address))
+#define pgm_read_word(address) (*reinterpret_cast<const uint16_t*>(address))
+#define pgm_read_dword(address) (*reinterpret_cast<const uint32_t*>(address))
+#define pgm_read_ptr(address) (*reinterpret_cast<const void* const*>(address))
+
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strncasecmp_P strncasecmp
+#define snprintf_P snprintf
+
+// Wemos D1 mini pins of the SPI panels
+#define D3 0
+#define D8 15
+
+///////////////// CODE
+class __FlashStringHelper;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+// Once set, millis() only moves when the test moves it. micros() always runs
+// on the host clock, timings stay real.
+void SetFakeMillis(unsigned long ms);
+void AdvanceFakeMillis(unsigned long ms);
+
+template<typename T> T min(T a, T b) { return b < a ? b : a; }
+template<typename T> T max(T a, T b) { return a < b ? b : a; }
+
+size_t strlcpy(char* destination, const char* source, size_t size);
+
+class Print
+{
+  public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t value) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* text) { return write(reinterpret_cast<const uint8_t*>(text), strlen(text)); }
+
+    size_t print(const __FlashStringHelper* text) { return write(reinterpret_cast<const char*>(text)); }
+    size_t print(const char* text) { return write(text); }
+    size_t print(char value) { return write(static_cast<uint8_t>(value)); }
+    size_t print(int value) { return print(static_cast<long>(value)); }
+    size_t print(unsigned int value) { return print(static_cast<unsigned long>(value)); }
+    size_t print(long value);
+    size_t print(unsigned long value);
+    size_t print(double value, int digits = 2);
+
+    template<typename T>
+    size_t println(T value) { return print(value) + println(); }
+    size_t println() { return write("\r\n"); }
+};
+
+// Writes to stdout
+class HardwareSerial : public Print
+{
+  public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t value) override { return fwrite(&value, 1, 1, stdout); }
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+class String
+{
+  public:
+    String() {}
+    String(const char* text) : m_text(text ? text : "") {}
+    String(const __FlashStringHelper* text) : m_text(reinterpret_cast<const char*>(text)) {}
+    explicit String(long value) : m_text(std::to_string(value)) {}
+
+    const char* c_str() const { return m_text.c_str(); }
+    unsigned int length() const { return m_text.length(); }
+    long toInt() const { return atol(m_text.c_str()); }
+
+    String& operator+=(const String& other) { m_text += other.m_text; return *this; }
+    friend String operator+(String text, const String& other) { return text += other; }
+    bool operator==(const String& other) const { return m_text == other.m_text; }
+
+  private:
+    std::string m_text;
+};
+
+class IPAddress
+{
+  public:
+    IPAddress() : m_address(0) {}
+    IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth)
+      : m_address(first | second << 8 | third << 16 | static_cast<uint32_t>(fourth) << 24) {}
+    IPAddress(const ip_addr_t* address) : m_address(address->addr) {}
+
+    operator uint32_t() const { return m_address; }
+    uint8_t operator[](int index) const { return m_address >> (index * 8); }
+
+  private:
+    uint32_t m_address;
+};
+
+// RTC user memory is kept for as long as the test runs
+class EspClass
+{
+  public:
+    uint32_t getChipId() { return 0x00C0FFEE; }
+    uint32_t getFreeHeap() { return 40000; }
+    uint32_t random() { return static_cast<uint32_t>(::random()); }
+    bool rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size);
+    bool rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size);
+};
+
+extern EspClass ESP;
+#endif
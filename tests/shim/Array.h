@@ -0,0 +1,51 @@
+#ifndef _ARRAY_H
+#define _ARRAY_H
+
+#include <stddef.h>
+
+// Host stand-in for the Array library: a vector of at most MAX_SIZE elements
+// in place, push_back() on a full one is ignored
+template<typename T, size_t MAX_SIZE>
+class Array
+{
+  public:
+    Array() : m_values(), m_size(0) {}
+
+    size_t size() const { return m_size; }
+    size_t max_size() const { return MAX_SIZE; }
+    bool empty() const { return m_size == 0; }
+    bool full() const { return m_size == MAX_SIZE; }
+
+    void clear() { m_size = 0; }
+    void push_back(const T& value)
+    {
+      if(m_size < MAX_SIZE)
+      {
+        m_values[m_size++] = value;
+      }
+    }
+    void pop_back()
+    {
+      if(m_size)
+      {
+        --m_size;
+      }
+    }
+
+    T& operator[](size_t index) { return m_values[index]; }
+    const T& operator[](size_t index) const { return m_values[index]; }
+    T& at(size_t index) { return m_values[index]; }
+    const T& at(size_t index) const { return m_values[index]; }
+    T& front() { return m_values[0]; }
+    T& back() { return m_values[m_size - 1]; }
+
+    T* begin() { return m_values; }
+    T* end() { return m_values + m_size; }
+    const T* begin() const { return m_values; }
+    const T* end() const { return m_values + m_size; }
+
+  private:
+    T m_values[MAX_SIZE];
+    size_t m_size;
+};
+#endif
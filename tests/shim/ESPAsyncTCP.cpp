@@ -0,0 +1,167 @@
+#include "ESPAsyncTCP.h"
+
+///////////////// DEFINES
+// lwIP error codes the fake reports
+#define FAKE_ERR_RST -14
+
+///////////////// CODE
+AsyncClient* AsyncClient::s_latest = nullptr;
+
+AsyncClient::AsyncClient()
+  : m_connectArg(nullptr)
+  , m_disconnectArg(nullptr)
+  , m_errorArg(nullptr)
+  , m_dataArg(nullptr)
+  , m_timeoutArg(nullptr)
+  , m_state(STATE_CLOSED)
+  , m_connectSucceeds(true)
+  , m_port(0)
+  , m_rxTimeout(0)
+  , m_sendSpace(TCP_MSS)
+  , m_ackLater(false)
+  , m_delivered(0)
+  , m_acked(0)
+  , m_largestAck(0)
+  {
+    s_latest = this;
+  }
+
+bool AsyncClient::connect(IPAddress ip, uint16_t port)
+{
+  if(m_state != STATE_CLOSED || !m_connectSucceeds)
+  {
+    return false;
+  }
+
+  m_address = ip;
+  m_port = port;
+  m_state = STATE_CONNECTING;
+  return true;
+}
+
+void AsyncClient::close(bool)
+{
+  if(m_state != STATE_CLOSED)
+  {
+    Disconnect();
+  }
+}
+
+size_t AsyncClient::write(const char* data, size_t size)
+{
+  if(!canSend())
+  {
+    return 0;
+  }
+
+  const size_t written = size < m_sendSpace ? size : m_sendSpace;
+  m_sent.append(data, written);
+  return written;
+}
+
+size_t AsyncClient::ack(size_t length)
+{
+  m_acked += length;
+  m_largestAck = length > m_largestAck ? length : m_largestAck;
+  return length;
+}
+
+const char* AsyncClient::errorToString(int8_t error) const
+{
+  return error == FAKE_ERR_RST ? "Connection reset" : "Unknown error";
+}
+
+void AsyncClient::ServerAccept()
+{
+  if(m_state != STATE_CONNECTING)
+  {
+    return;
+  }
+
+  m_state = STATE_CONNECTED;
+  if(m_connectCb)
+  {
+    m_connectCb(m_connectArg, this);
+  }
+}
+
+void AsyncClient::ServerReset()
+{
+  if(m_state == STATE_CLOSED)
+  {
+    return;
+  }
+
+  if(m_errorCb)
+  {
+    m_errorCb(m_errorArg, this, FAKE_ERR_RST);
+  }
+  Disconnect();
+}
+
+size_t AsyncClient::ServerSend(const char* data, size_t length, bool ignoreWindow)
+{
+  size_t sent = 0;
+  while(m_state == STATE_CONNECTED && sent < length)
+  {
+    size_t segment = length - sent < TCP_MSS ? length - sent : TCP_MSS;
+    if(!ignoreWindow)
+    {
+      segment = segment < GetWindow() ? segment : GetWindow();
+    }
+    if(segment == 0)
+    {
+      break;
+    }
+
+    m_ackLater = false;
+    m_delivered += segment;
+    if(m_dataCb)
+    {
+      m_dataCb(m_dataArg, this, const_cast<char*>(data + sent), segment);
+    }
+    // Data the client doesn't hold back is acknowledged right away
+    if(!m_ackLater)
+    {
+      m_acked += segment;
+    }
+    sent += segment;
+  }
+  return sent;
+}
+
+void AsyncClient::ServerClose()
+{
+  if(m_state != STATE_CLOSED)
+  {
+    Disconnect();
+  }
+}
+
+void AsyncClient::ServerRxTimeout()
+{
+  if(m_state == STATE_CONNECTED && m_timeoutCb)
+  {
+    m_timeoutCb(m_timeoutArg, this, m_rxTimeout * 1000);
+  }
+}
+
+void AsyncClient::ResetFake(bool connectSucceeds)
+{
+  m_state = STATE_CLOSED;
+  m_connectSucceeds = connectSucceeds;
+  m_sendSpace = TCP_MSS;
+  m_sent.clear();
+  m_delivered = 0;
+  m_acked = 0;
+  m_largestAck = 0;
+}
+
+void AsyncClient::Disconnect()
+{
+  m_state = STATE_CLOSED;
+  if(m_disconnectCb)
+  {
+    m_disconnectCb(m_disconnectArg, this);
+  }
+}
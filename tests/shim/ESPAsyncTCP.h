@@ -0,0 +1,111 @@
+#ifndef _ESPASYNCTCP_H
+#define _ESPASYNCTCP_H
+
+#include <Arduino.h>
+#include <functional>
+#include <string>
+
+#include "lwip/tcp.h"
+
+///////////////// CODE
+// Host stand-in for the AsyncClient of ESPAsyncTCP. Nothing goes over the
+// network, the test plays the server through the Server*() calls. They run
+// the callbacks the way lwIP does between two loop() iterations, and keep
+// to the receive window: data handed to onData() counts against it until
+// the client acknowledges it.
+class AsyncClient
+{
+  public:
+    typedef std::function<void(void*, AsyncClient*)> AcConnectHandler;
+    typedef std::function<void(void*, AsyncClient*, int8_t error)> AcErrorHandler;
+    typedef std::function<void(void*, AsyncClient*, void* data, size_t len)> AcDataHandler;
+    typedef std::function<void(void*, AsyncClient*, uint32_t time)> AcTimeoutHandler;
+
+    AsyncClient();
+
+    void onConnect(AcConnectHandler callback, void* arg = nullptr) { m_connectCb = callback; m_connectArg = arg; }
+    void onDisconnect(AcConnectHandler callback, void* arg = nullptr) { m_disconnectCb = callback; m_disconnectArg = arg; }
+    void onError(AcErrorHandler callback, void* arg = nullptr) { m_errorCb = callback; m_errorArg = arg; }
+    void onData(AcDataHandler callback, void* arg = nullptr) { m_dataCb = callback; m_dataArg = arg; }
+    void onTimeout(AcTimeoutHandler callback, void* arg = nullptr) { m_timeoutCb = callback; m_timeoutArg = arg; }
+
+    bool connect(IPAddress ip, uint16_t port);
+    void close(bool now = false);
+    bool connected() const { return m_state == STATE_CONNECTED; }
+    bool connecting() const { return m_state == STATE_CONNECTING; }
+
+    bool canSend() const { return connected() && m_sendSpace > 0; }
+    size_t write(const char* data, size_t size);
+
+    void ackLater() { m_ackLater = true; }
+    size_t ack(size_t length);
+    void setRxTimeout(uint32_t timeout) { m_rxTimeout = timeout; }
+    const char* errorToString(int8_t error) const;
+
+    // Server side
+    void ServerAccept();
+    // Refuses the connection or resets it, onError() and onDisconnect()
+    void ServerReset();
+    // Sends as much of data as the window takes in segments of TCP_MSS,
+    // returns how much that was. ignoreWindow sends it all regardless.
+    size_t ServerSend(const char* data, size_t length, bool ignoreWindow = false);
+    void ServerClose();
+    void ServerRxTimeout();
+
+    // Bytes the client may write per write() call, 0 makes canSend() false
+    void SetSendSpace(size_t space) { m_sendSpace = space; }
+
+    const std::string& GetSent() const { return m_sent; }
+    size_t GetWindow() const { return TCP_WND - (m_delivered - m_acked); }
+    size_t GetLargestAck() const { return m_largestAck; }
+    bool IsClosed() const { return m_state == STATE_CLOSED; }
+    IPAddress GetRemoteAddress() const { return m_address; }
+    uint16_t GetRemotePort() const { return m_port; }
+    uint32_t GetRxTimeout() const { return m_rxTimeout; }
+
+    // A fresh connection for the next test, the callbacks stay
+    void ResetFake(bool connectSucceeds = true);
+
+    // The client constructed last, the test reaches the one a class owns
+    // through it
+    static AsyncClient* GetLatest() { return s_latest; }
+
+  private:
+    enum EState
+    {
+      STATE_CLOSED = 0,
+      STATE_CONNECTING,
+      STATE_CONNECTED
+    };
+
+    void Disconnect();
+
+  private:
+    AcConnectHandler m_connectCb;
+    void* m_connectArg;
+    AcConnectHandler m_disconnectCb;
+    void* m_disconnectArg;
+    AcErrorHandler m_errorCb;
+    void* m_errorArg;
+    AcDataHandler m_dataCb;
+    void* m_dataArg;
+    AcTimeoutHandler m_timeoutCb;
+    void* m_timeoutArg;
+
+    EState m_state;
+    bool m_connectSucceeds;
+    IPAddress m_address;
+    uint16_t m_port;
+    uint32_t m_rxTimeout;
+
+    size_t m_sendSpace;
+    std::string m_sent;
+
+    bool m_ackLater;
+    size_t m_delivered;
+    size_t m_acked;
+    size_t m_largestAck;
+
+    static AsyncClient* s_latest;
+};
+#endif
@@ -0,0 +1,106 @@
+#include "FS.h"
+
+///////////////// CODE
+FS SPIFFS;
+
+namespace fs
+{
+  size_t File::size() const
+  {
+    return m_fs != nullptr && m_fs->exists(m_path.c_str()) ? m_fs->m_files[m_path].size() : 0;
+  }
+
+  size_t File::read(uint8_t* buffer, size_t size)
+  {
+    if(m_fs == nullptr || !m_fs->exists(m_path.c_str()))
+    {
+      return 0;
+    }
+
+    const std::string& content = m_fs->m_files[m_path];
+    const size_t left = m_position < content.size() ? content.size() - m_position : 0;
+    const size_t length = size < left ? size : left;
+    memcpy(buffer, content.data() + m_position, length);
+    m_position += length;
+    return length;
+  }
+
+  int File::read()
+  {
+    uint8_t value;
+    return read(&value, 1) == 1 ? value : -1;
+  }
+
+  size_t File::write(const uint8_t* buffer, size_t size)
+  {
+    if(m_fs == nullptr || !m_fs->exists(m_path.c_str()))
+    {
+      return 0;
+    }
+
+    const FS::EOperation operation = m_fs->Operate();
+    if(operation == FS::OPERATION_NO_POWER)
+    {
+      return 0;
+    }
+
+    // The power went while writing, part of it made it to flash
+    const size_t length = operation == FS::OPERATION_DONE ? size : size / 2;
+    m_fs->m_files[m_path].append(reinterpret_cast<const char*>(buffer), length);
+    return length;
+  }
+
+  File FS::open(const char* path, const char* mode)
+  {
+    if(strcmp(mode, "r") == 0)
+    {
+      return exists(path) ? File(this, path) : File();
+    }
+
+    if(Operate() != OPERATION_DONE)
+    {
+      return File();
+    }
+    m_files[path].clear();
+    return File(this, path);
+  }
+
+  bool FS::remove(const char* path)
+  {
+    if(Operate() != OPERATION_DONE || !exists(path))
+    {
+      return false;
+    }
+    m_files.erase(path);
+    return true;
+  }
+
+  bool FS::rename(const char* pathFrom, const char* pathTo)
+  {
+    if(Operate() != OPERATION_DONE || !exists(pathFrom) || exists(pathTo))
+    {
+      return false;
+    }
+    m_files[pathTo] = m_files[pathFrom];
+    m_files.erase(pathFrom);
+    return true;
+  }
+
+  FS::EOperation FS::Operate()
+  {
+    if(m_powerCut)
+    {
+      return OPERATION_NO_POWER;
+    }
+    if(m_operationsLeft == 0)
+    {
+      m_powerCut = true;
+      return OPERATION_CUT;
+    }
+    if(m_operationsLeft > 0)
+    {
+      --m_operationsLeft;
+    }
+    return OPERATION_DONE;
+  }
+}
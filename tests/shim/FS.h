@@ -0,0 +1,82 @@
+#ifndef _FS_H
+#define _FS_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+
+///////////////// CODE
+// Host stand-in for SPIFFS, files are kept in memory for as long as the test
+// runs. Like SPIFFS a file can't be renamed over an existing one.
+//
+// The test can cut the power: every change to the file system (opening a
+// file for writing, each write, remove, rename) is one operation, and the
+// one the power is cut at doesn't happen. A write it cuts lands half of its
+// bytes. Everything after it fails until the power comes back.
+namespace fs
+{
+  class FS;
+
+  class File
+  {
+    public:
+      File() : m_fs(nullptr), m_position(0) {}
+      File(FS* fs, const std::string& path) : m_fs(fs), m_path(path), m_position(0) {}
+
+      explicit operator bool() const { return m_fs != nullptr; }
+      size_t size() const;
+      size_t read(uint8_t* buffer, size_t size);
+      // What ArduinoJson reads a stream with
+      int read();
+      size_t readBytes(char* buffer, size_t size) { return read(reinterpret_cast<uint8_t*>(buffer), size); }
+      size_t write(const uint8_t* buffer, size_t size);
+      void close() { m_fs = nullptr; }
+
+    private:
+      FS* m_fs;
+      std::string m_path;
+      size_t m_position;
+  };
+
+  class FS
+  {
+    public:
+      FS() : m_operationsLeft(-1), m_powerCut(false) {}
+
+      bool begin() { return true; }
+      File open(const char* path, const char* mode);
+      bool exists(const char* path) const { return m_files.count(path) != 0; }
+      bool remove(const char* path);
+      bool rename(const char* pathFrom, const char* pathTo);
+
+      // The power goes after this many more operations, -1 keeps it on.
+      // Either way it is back on, as after a reboot.
+      void CutPowerAfter(int operations) { m_operationsLeft = operations; m_powerCut = false; }
+      bool IsPowerCut() const { return m_powerCut; }
+      // The files as they are on flash, the test reads and changes them here
+      std::map<std::string, std::string>& GetFiles() { return m_files; }
+
+    private:
+      friend class File;
+
+      enum EOperation
+      {
+        OPERATION_DONE,
+        OPERATION_CUT,
+        OPERATION_NO_POWER
+      };
+
+      // Counts an operation, tells whether it happens
+      EOperation Operate();
+
+      std::map<std::string, std::string> m_files;
+      int m_operationsLeft;
+      bool m_powerCut;
+  };
+}
+
+using fs::File;
+using fs::FS;
+
+extern FS SPIFFS;
+#endif
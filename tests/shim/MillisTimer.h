@@ -0,0 +1,71 @@
+#ifndef _MILLISTIMER_H
+#define _MILLISTIMER_H
+
+#include <Arduino.h>
+
+///////////////// CODE
+// The MillisTimer library as the sketch uses it: a timer is polled through
+// expired() or run(), fires every interval and stops after the set number of
+// repeats (0 repeats forever).
+class MillisTimer
+{
+  public:
+    typedef void (*timerEventHandler)(MillisTimer&);
+
+    MillisTimer(unsigned long interval = 1000, timerEventHandler handler = nullptr)
+      : m_interval(interval)
+      , m_repeats(0)
+      , m_fired(0)
+      , m_startTime(0)
+      , m_running(false)
+      , m_handler(handler)
+      {
+      }
+
+    void setInterval(unsigned long interval) { m_interval = interval; }
+    void setRepeats(unsigned long repeats) { m_repeats = repeats; }
+    void expiredHandler(timerEventHandler handler) { m_handler = handler; }
+
+    void start() { m_running = true; m_fired = 0; m_startTime = millis(); }
+    void stop() { m_running = false; }
+    void reset() { m_fired = 0; m_startTime = millis(); }
+    bool isRunning() const { return m_running; }
+
+    unsigned long getRemainingTime() const
+    {
+      const unsigned long elapsed = millis() - m_startTime;
+      return m_running && elapsed < m_interval ? m_interval - elapsed : 0;
+    }
+
+    bool expired()
+    {
+      if(!m_running || millis() - m_startTime < m_interval)
+      {
+        return false;
+      }
+
+      m_startTime = millis();
+      if(m_repeats && ++m_fired >= m_repeats)
+      {
+        m_running = false;
+      }
+      return true;
+    }
+
+    void run()
+    {
+      if(expired() && m_handler)
+      {
+        m_handler(*this);
+      }
+    }
+
+  private:
+    unsigned long m_interval;
+    unsigned long m_repeats;
+    unsigned long m_fired;
+    unsigned long m_startTime;
+    bool m_running;
+    timerEventHandler m_handler;
+};
+#endif
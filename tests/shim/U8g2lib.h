@@ -0,0 +1,111 @@
+#ifndef _U8G2LIB_H
+#define _U8G2LIB_H
+
+// The u8g2 C library (clib/ of the U8g2 Arduino library) behind the part of
+// its C++ wrapper the sketch uses. The panel classes set up the real
+// controller drivers with callbacks that send nothing, so drawing and the
+// u8x8 tile writes run as on the device and only the bytes on the bus are
+// dropped. What the panel shows is read back from CWeatherDisplay.
+#include <Arduino.h>
+#include "u8g2.h"
+
+///////////////// CODE
+class U8G2
+{
+  public:
+    u8g2_t* getU8g2() { return &m_u8g2; }
+    u8x8_t* getU8x8() { return u8g2_GetU8x8(&m_u8g2); }
+
+    bool begin()
+    {
+      u8g2_InitDisplay(&m_u8g2);
+      u8g2_ClearDisplay(&m_u8g2);
+      u8g2_SetPowerSave(&m_u8g2, 0);
+      return true;
+    }
+
+    void setPowerSave(uint8_t isEnable) { u8g2_SetPowerSave(&m_u8g2, isEnable); }
+    void setContrast(uint8_t value) { u8g2_SetContrast(&m_u8g2, value); }
+    void setDisplayRotation(const u8g2_cb_t* rotation) { u8g2_SetDisplayRotation(&m_u8g2, rotation); }
+    void clearDisplay() { u8g2_ClearDisplay(&m_u8g2); }
+
+    uint8_t* getBufferPtr() { return u8g2_GetBufferPtr(&m_u8g2); }
+    uint8_t getBufferTileWidth() { return u8g2_GetBufferTileWidth(&m_u8g2); }
+    uint8_t getBufferTileHeight() { return u8g2_GetBufferTileHeight(&m_u8g2); }
+    void clearBuffer() { u8g2_ClearBuffer(&m_u8g2); }
+    void sendBuffer() { u8g2_SendBuffer(&m_u8g2); }
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) { u8g2_UpdateDisplayArea(&m_u8g2, tx, ty, tw, th); }
+
+    void setClipWindow(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1) { u8g2_SetClipWindow(&m_u8g2, x0, y0, x1, y1); }
+    void setMaxClipWindow() { u8g2_SetMaxClipWindow(&m_u8g2); }
+    void setDrawColor(uint8_t color) { u8g2_SetDrawColor(&m_u8g2, color); }
+    void setFont(const uint8_t* font) { u8g2_SetFont(&m_u8g2, font); }
+
+    u8g2_uint_t drawGlyph(u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding) { return u8g2_DrawGlyph(&m_u8g2, x, y, encoding); }
+    u8g2_uint_t drawStr(u8g2_uint_t x, u8g2_uint_t y, const char* text) { return u8g2_DrawStr(&m_u8g2, x, y, text); }
+    void drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t* bitmap) { u8g2_DrawXBMP(&m_u8g2, x, y, w, h, bitmap); }
+    void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) { u8g2_DrawBox(&m_u8g2, x, y, w, h); }
+    void drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w) { u8g2_DrawHLine(&m_u8g2, x, y, w); }
+    void drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h) { u8g2_DrawVLine(&m_u8g2, x, y, h); }
+    void drawPixel(u8g2_uint_t x, u8g2_uint_t y) { u8g2_DrawPixel(&m_u8g2, x, y); }
+    void drawLine(u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2) { u8g2_DrawLine(&m_u8g2, x1, y1, x2, y2); }
+    void drawCircle(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t radius, uint8_t option = U8G2_DRAW_ALL) { u8g2_DrawCircle(&m_u8g2, x0, y0, radius, option); }
+
+  protected:
+    u8g2_t m_u8g2;
+};
+
+class U8G2_SH1106_128X64_NONAME_F_HW_I2C : public U8G2
+{
+  public:
+    U8G2_SH1106_128X64_NONAME_F_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+    {
+      u8g2_Setup_sh1106_i2c_128x64_noname_f(&m_u8g2, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    }
+};
+
+class U8G2_SH1106_128X64_NONAME_F_4W_HW_SPI : public U8G2
+{
+  public:
+    U8G2_SH1106_128X64_NONAME_F_4W_HW_SPI(const u8g2_cb_t* rotation, uint8_t cs, uint8_t dc, uint8_t reset = U8X8_PIN_NONE)
+    {
+      u8g2_Setup_sh1106_128x64_noname_f(&m_u8g2, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    }
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2
+{
+  public:
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+    {
+      u8g2_Setup_ssd1306_i2c_128x64_noname_f(&m_u8g2, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    }
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_4W_HW_SPI : public U8G2
+{
+  public:
+    U8G2_SSD1306_128X64_NONAME_F_4W_HW_SPI(const u8g2_cb_t* rotation, uint8_t cs, uint8_t dc, uint8_t reset = U8X8_PIN_NONE)
+    {
+      u8g2_Setup_ssd1306_128x64_noname_f(&m_u8g2, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    }
+};
+
+class U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C : public U8G2
+{
+  public:
+    U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+    {
+      u8g2_Setup_ssd1306_i2c_128x32_univision_f(&m_u8g2, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    }
+};
+
+class U8G2_SSD1306_128X32_UNIVISION_F_4W_HW_SPI : public U8G2
+{
+  public:
+    U8G2_SSD1306_128X32_UNIVISION_F_4W_HW_SPI(const u8g2_cb_t* rotation, uint8_t cs, uint8_t dc, uint8_t reset = U8X8_PIN_NONE)
+    {
+      u8g2_Setup_ssd1306_128x32_univision_f(&m_u8g2, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+    }
+};
+#endif
@@ -0,0 +1,56 @@
+// C functions, the sketch includes lwIP in extern "C"
+extern "C" {
+  #include "lwip/dns.h"
+}
+
+#include <stddef.h>
+
+///////////////// DEFINES
+// 192.0.2.1, the documentation network, first octet lowest
+#define FAKE_DNS_ADDRESS 0x010200C0
+
+///////////////// CODE
+namespace
+{
+  EFakeDnsMode fakeDnsMode = FAKE_DNS_CACHED;
+  const char* pendingName = nullptr;
+  dns_found_callback pendingCallback = nullptr;
+  void* pendingArg = nullptr;
+}
+
+err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback found, void* callback_arg)
+{
+  switch(fakeDnsMode)
+  {
+  case FAKE_DNS_CACHED:
+    addr->addr = FAKE_DNS_ADDRESS;
+    return ERR_OK;
+
+  case FAKE_DNS_PENDING:
+    pendingName = hostname;
+    pendingCallback = found;
+    pendingArg = callback_arg;
+    return ERR_INPROGRESS;
+
+  default:
+    return ERR_ARG;
+  }
+}
+
+void SetFakeDnsMode(EFakeDnsMode mode)
+{
+  fakeDnsMode = mode;
+}
+
+void CompleteFakeDns(bool found)
+{
+  if(!pendingCallback)
+  {
+    return;
+  }
+
+  const ip_addr_t address = { FAKE_DNS_ADDRESS };
+  dns_found_callback callback = pendingCallback;
+  pendingCallback = nullptr;
+  callback(pendingName, found ? &address : nullptr, pendingArg);
+}
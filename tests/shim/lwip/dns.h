@@ -0,0 +1,29 @@
+#ifndef _LWIP_DNS_H
+#define _LWIP_DNS_H
+
+#include <stdint.h>
+
+#include "lwip/ip_addr.h"
+
+typedef int8_t err_t;
+
+#define ERR_OK 0
+#define ERR_INPROGRESS -5
+#define ERR_ARG -16
+
+typedef void (*dns_found_callback)(const char* name, const ip_addr_t* ipaddr, void* callback_arg);
+
+err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback found, void* callback_arg);
+
+// The test decides how the lookup goes. A pending lookup finishes with
+// CompleteFakeDns(), which calls the callback like lwIP would.
+enum EFakeDnsMode
+{
+  FAKE_DNS_CACHED = 0,
+  FAKE_DNS_PENDING,
+  FAKE_DNS_FAILED
+};
+
+void SetFakeDnsMode(EFakeDnsMode mode);
+void CompleteFakeDns(bool found);
+#endif
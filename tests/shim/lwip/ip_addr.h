@@ -0,0 +1,11 @@
+#ifndef _LWIP_IP_ADDR_H
+#define _LWIP_IP_ADDR_H
+
+#include <stdint.h>
+
+// IPv4 only, first octet lowest like lwIP on the ESP8266
+struct ip_addr_t
+{
+  uint32_t addr;
+};
+#endif
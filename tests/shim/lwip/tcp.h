@@ -0,0 +1,7 @@
+#ifndef _LWIP_TCP_H
+#define _LWIP_TCP_H
+
+// Receive window of the lwIP build of the ESP8266 core, 4 segments of 1460
+#define TCP_MSS 1460
+#define TCP_WND (4 * TCP_MSS)
+#endif
@@ -0,0 +1,103 @@
+// One writer publishes numbered states while readers check that every copy
+// they get is one whole generation, and that generations never go back.
+// Built with -fsanitize=thread by make tsan, which also reports any data race
+// between the copies.
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Snapshot.h"
+#include "TestHelpers.h"
+
+///////////////// DEFINES
+#define SNAPSHOT_TEST_PUBLISHES 200000
+#define SNAPSHOT_TEST_READERS 3
+
+///////////////// CODE
+namespace
+{
+  // Larger than a word, a torn copy mixes the values of two publishes
+  struct SState
+  {
+    uint32_t m_values[30];
+    char m_name[33];
+  };
+
+  void Fill(SState& state, uint32_t value)
+  {
+    for(uint32_t& stored : state.m_values)
+    {
+      stored = value;
+    }
+    snprintf(state.m_name, sizeof(state.m_name), "%u", value);
+  }
+
+  void CheckWhole(const SState& state, uint32_t generation)
+  {
+    for(uint32_t value : state.m_values)
+    {
+      CHECK_EQUAL(generation, value);
+    }
+    CHECK_EQUAL(generation, strtoul(state.m_name, nullptr, 10));
+  }
+}
+
+int main()
+{
+  CSnapshot<SState> snapshot;
+  {
+    // The default constructed state is generation 0
+    SState initial;
+    Fill(initial, 0);
+    snapshot.Publish(initial);
+    CHECK_EQUAL(1, snapshot.GetGeneration());
+  }
+
+  std::atomic<bool> done(false);
+  std::atomic<unsigned long> reads(0);
+
+  std::vector<std::thread> readers;
+  for(int reader = 0; reader < SNAPSHOT_TEST_READERS; ++reader)
+  {
+    readers.emplace_back([&]()
+    {
+      uint32_t last = 0;
+      while(!done.load())
+      {
+        uint32_t generation = 0;
+        const SState state = snapshot.Read(&generation);
+        // Generation 1 is the initial state, publish n stores n - 1
+        CHECK(generation >= 1);
+        CheckWhole(state, generation - 1);
+        CHECK(generation >= last);
+        CHECK(snapshot.GetGeneration() >= generation);
+        last = generation;
+        reads.fetch_add(1);
+      }
+    });
+  }
+
+  std::thread writer([&]()
+  {
+    SState state;
+    for(uint32_t value = 1; value <= SNAPSHOT_TEST_PUBLISHES; ++value)
+    {
+      Fill(state, value);
+      snapshot.Publish(state);
+    }
+    done.store(true);
+  });
+
+  writer.join();
+  for(std::thread& reader : readers)
+  {
+    reader.join();
+  }
+
+  uint32_t generation = 0;
+  CheckWhole(snapshot.Read(&generation), SNAPSHOT_TEST_PUBLISHES);
+  CHECK_EQUAL(SNAPSHOT_TEST_PUBLISHES + 1, generation);
+
+  printf("snapshot_test: %d publishes, %lu reads by %d readers OK\n", SNAPSHOT_TEST_PUBLISHES, reads.load(), SNAPSHOT_TEST_READERS);
+  return 0;
+}
@@ -0,0 +1,221 @@
+// The generated weather code table against the mapping it replaced: the
+// GetWeatherType() and DrawWeatherIcon() switches of CWeatherDisplay and the
+// weatherTypeWorstness list of the sketch, copied here as they were.
+//
+// The only intended difference is the rank of 762 (volcanic ash). The old
+// list had 752, which isn't an OpenWeatherMap code, in its place, so 762 was
+// never ranked and lost against every other condition.
+#include "WeatherCodes.h"
+#include "TestHelpers.h"
+
+///////////////// DEFINES
+#define OLD_CODE_WRONG 752
+#define OLD_CODE_RIGHT 762
+
+///////////////// CODE
+namespace
+{
+  const unsigned int oldWorstness[] = {
+    202, 212, 232, 201, 200, 231, 230, 221, 211, 210,
+    314, 302, 312, 313, 311, 321, 310, 301, 300,
+    504, 503, 511, 502, 522, 501, 531, 521, 520, 500,
+    622, 616, 621, 620, 615, 613, 612, 602, 611, 601, 600,
+    701, 711, 721, 731, 741, 751, 761, 752, 771, 781,
+    804, 803, 802, 801, 800
+  };
+
+  uint8_t OldRank(unsigned int weatherId)
+  {
+    for(uint8_t index = 0; index < sizeof(oldWorstness) / sizeof(oldWorstness[0]); ++index)
+    {
+      if(oldWorstness[index] == weatherId)
+      {
+        return index;
+      }
+    }
+    return WEATHER_RANK_UNKNOWN;
+  }
+
+  EWeatherType OldWeatherType(unsigned int weatherId, bool isDay)
+  {
+    switch(weatherId)
+    {
+      case 200: return THUNDERSTROM_LIGHT_RAIN;
+      case 201: return THUNDERSTORM_RAIN;
+      case 202: return THUNDERSTORM_HEAVY_RAIN;
+      case 210:
+      case 211: return THUNDERSTORM;
+      case 212: return THUNDERSTORM_HEAVY;
+      case 221: return THUNDERSTORM;
+      case 230:
+      case 231: return THUNDERSTROM_LIGHT_RAIN;
+      case 232: return THUNDERSTORM_HEAVY_RAIN;
+
+      case 300:
+      case 301: return isDay ? RAIN_LIGHT_DAY : RAIN_LIGHT_NIGHT;
+      case 302: return isDay ? RAIN_HEAVY_DAY : RAIN_HEAVY_NIGHT;
+      case 310:
+      case 311:
+      case 312:
+      case 313: return isDay ? RAIN_DAY : RAIN_NIGHT;
+      case 314: return isDay ? RAIN_HEAVY_DAY : RAIN_HEAVY_NIGHT;
+      case 321: return isDay ? RAIN_DAY : RAIN_NIGHT;
+
+      case 500: return isDay ? RAIN_LIGHT_DAY : RAIN_LIGHT_NIGHT;
+      case 501: return isDay ? RAIN_DAY : RAIN_NIGHT;
+      case 502:
+      case 503:
+      case 504: return isDay ? RAIN_HEAVY_DAY : RAIN_HEAVY_NIGHT;
+      case 511: return isDay ? RAIN_FREEZING_DAY : RAIN_FREEZING_NIGHT;
+      case 520:
+      case 521: return isDay ? RAIN_DAY : RAIN_NIGHT;
+      case 522: return isDay ? RAIN_HEAVY_DAY : RAIN_HEAVY_NIGHT;
+      case 531: return isDay ? RAIN_DAY : RAIN_NIGHT;
+
+      case 600:
+      case 601: return SNOW;
+      case 602: return SNOW_HEAVY;
+      case 611:
+      case 612: return SNOW_SHOWER;
+      case 613: return SNOW_HEAVY_SHOWER;
+      case 615: return SNOW_RAIN;
+      case 616: return SNOW_HEAVY_RAIN;
+      case 620: return SNOW_SHOWER;
+      case 621:
+      case 622: return SNOW_HEAVY_SHOWER;
+
+      case 701:
+      case 711:
+      case 721:
+      case 731:
+      case 741:
+      case 751:
+      case 761:
+      case 762:
+      case 771:
+      case 781: return MIST;
+
+      case 800: return isDay ? CLEAR_DAY : CLEAR_NIGHT;
+
+      case 801: return isDay ? CLOUDS_LIGHT_DAY : CLOUDS_LIGHT_NIGHT;
+      case 802:
+      case 803: return isDay ? CLOUDS_MEDIUM_DAY : CLOUDS_MEDIUM_NIGHT;
+      case 804: return CLOUDS_HEAVY;
+
+      default: return UNKNOWN;
+    }
+  }
+
+  // The bitmaps DrawWeatherIcon() drew, as icon indexes
+  void OldIcons(EWeatherType type, EWeatherIcon& mainIcon, EWeatherAuxIcon& auxIcon)
+  {
+    mainIcon = ICON_NONE;
+    auxIcon = AUX_ICON_NONE;
+
+    switch(type)
+    {
+      case THUNDERSTROM_LIGHT_RAIN: mainIcon = ICON_THUNDER_LIGHT_RAIN; break;
+      case THUNDERSTORM_RAIN:       mainIcon = ICON_THUNDER_RAIN; break;
+      case THUNDERSTORM:            mainIcon = ICON_THUNDER_RAIN; break;
+      case THUNDERSTORM_HEAVY:      mainIcon = ICON_THUNDER_RAIN; auxIcon = AUX_ICON_THUNDER; break;
+      case THUNDERSTORM_HEAVY_RAIN: mainIcon = ICON_THUNDER_RAIN; auxIcon = AUX_ICON_MORE_RAIN; break;
+
+      case RAIN_LIGHT:              mainIcon = ICON_LIGHT_RAIN; break;
+      case RAIN_LIGHT_DAY:          mainIcon = ICON_LIGHT_RAIN_DAY; break;
+      case RAIN_LIGHT_NIGHT:        mainIcon = ICON_LIGHT_RAIN_NIGHT; break;
+      case RAIN:                    mainIcon = ICON_RAIN; break;
+      case RAIN_DAY:                mainIcon = ICON_RAIN_DAY; break;
+      case RAIN_NIGHT:              mainIcon = ICON_RAIN_NIGHT; break;
+      case RAIN_HEAVY:              mainIcon = ICON_RAIN; auxIcon = AUX_ICON_MORE_RAIN; break;
+      case RAIN_HEAVY_DAY:          mainIcon = ICON_RAIN_DAY; auxIcon = AUX_ICON_MORE_RAIN; break;
+      case RAIN_HEAVY_NIGHT:        mainIcon = ICON_RAIN_NIGHT; auxIcon = AUX_ICON_MORE_RAIN; break;
+      case RAIN_FREEZING:           mainIcon = ICON_RAIN; auxIcon = AUX_ICON_SNOW; break;
+      case RAIN_FREEZING_DAY:       mainIcon = ICON_RAIN_DAY; auxIcon = AUX_ICON_SNOW; break;
+      case RAIN_FREEZING_NIGHT:     mainIcon = ICON_RAIN_NIGHT; auxIcon = AUX_ICON_SNOW; break;
+
+      case SNOW:                    mainIcon = ICON_SNOW; break;
+      case SNOW_HEAVY:              mainIcon = ICON_SNOW; auxIcon = AUX_ICON_SNOW; break;
+      case SNOW_SHOWER:             mainIcon = ICON_SNOW_SHOWER; break;
+      case SNOW_HEAVY_SHOWER:       mainIcon = ICON_SNOW_HEAVY_SHOWER; break;
+      case SNOW_RAIN:               mainIcon = ICON_SNOW_RAIN; break;
+      case SNOW_HEAVY_RAIN:         mainIcon = ICON_SNOW_HEAVY_RAIN; break;
+
+      case MIST:                    mainIcon = ICON_MIST; break;
+
+      case CLEAR_DAY:               mainIcon = ICON_SUN; break;
+      case CLEAR_NIGHT:             mainIcon = ICON_NIGHT; break;
+
+      case CLOUDS_LIGHT_DAY:        mainIcon = ICON_SMALL_CLOUDS_DAY; break;
+      case CLOUDS_LIGHT_NIGHT:      mainIcon = ICON_SMALL_CLOUDS_NIGHT; break;
+      case CLOUDS_MEDIUM_DAY:       mainIcon = ICON_MEDIUM_CLOUDS_DAY; break;
+      case CLOUDS_MEDIUM_NIGHT:     mainIcon = ICON_MEDIUM_CLOUDS_NIGHT; break;
+      case CLOUDS_HEAVY:            mainIcon = ICON_CLOUDS; break;
+
+      default: break;
+    }
+  }
+
+  void CheckCode(unsigned int weatherId)
+  {
+    for(int isDay = 0; isDay < 2; ++isDay)
+    {
+      const SWeatherCondition condition = GetWeatherCondition(weatherId, isDay);
+      const EWeatherType oldType = OldWeatherType(weatherId, isDay);
+      EWeatherIcon oldMainIcon;
+      EWeatherAuxIcon oldAuxIcon;
+      OldIcons(oldType, oldMainIcon, oldAuxIcon);
+
+      if(condition.m_type != oldType || condition.m_mainIcon != oldMainIcon || condition.m_auxIcon != oldAuxIcon)
+      {
+        fprintf(stderr, "code %u %s: type %d icons %d/%d, expected %d icons %d/%d\n", weatherId, isDay ? "day" : "night",
+          condition.m_type, condition.m_mainIcon, condition.m_auxIcon, oldType, oldMainIcon, oldAuxIcon);
+        exit(1);
+      }
+      CHECK_EQUAL(condition.m_rank, GetWeatherRank(weatherId));
+    }
+
+    // The fix: 762 takes the rank 752 had, 752 is as unknown as any other
+    // code OpenWeatherMap doesn't send
+    uint8_t expectedRank = OldRank(weatherId);
+    if(weatherId == OLD_CODE_RIGHT)
+    {
+      expectedRank = OldRank(OLD_CODE_WRONG);
+    }
+    else if(weatherId == OLD_CODE_WRONG)
+    {
+      expectedRank = WEATHER_RANK_UNKNOWN;
+    }
+    if(GetWeatherRank(weatherId) != expectedRank)
+    {
+      fprintf(stderr, "code %u: rank %u, expected %u\n", weatherId, GetWeatherRank(weatherId), expectedRank);
+      exit(1);
+    }
+  }
+}
+
+int main()
+{
+  CHECK_EQUAL(605, WEATHER_CODE_COUNT);
+
+  int known = 0;
+  for(unsigned int weatherId = WEATHER_CODE_FIRST; weatherId <= WEATHER_CODE_LAST; ++weatherId)
+  {
+    CheckCode(weatherId);
+    known += GetWeatherRank(weatherId) != WEATHER_RANK_UNKNOWN;
+  }
+  CHECK_EQUAL(sizeof(oldWorstness) / sizeof(oldWorstness[0]), known);
+
+  // Outside the table
+  const unsigned int outside[] = { 0, 1, 199, 805, 999, 65535 };
+  for(unsigned int weatherId : outside)
+  {
+    CheckCode(weatherId);
+  }
+
+  // 762 now loses against the milder atmosphere codes only
+  CHECK(GetWeatherRank(OLD_CODE_RIGHT) < GetWeatherRank(771));
+  CHECK(GetWeatherRank(OLD_CODE_RIGHT) > GetWeatherRank(761));
+
+  printf("weather_codes_test: %d codes, %d known OK\n", WEATHER_CODE_COUNT, known);
+  return 0;
+}
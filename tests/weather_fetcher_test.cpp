@@ -0,0 +1,424 @@
+// State transitions of CWeatherFetcher against a fake AsyncClient played as
+// the server: fast, slow, stalled and partial servers, servers that close
+// early, and error responses. The clock only moves when the test moves it.
+#include <string>
+
+#include "WeatherFetcher.h"
+#include "TestHelpers.h"
+
+///////////////// DEFINES
+#define TEST_HOST "api.example.org"
+#define TEST_PATH "/data/2.5/onecall?lat=1&lon=2"
+#define TEST_FIRST_DT 1600000000UL
+#define TEST_RUNS_MAX 100000
+
+///////////////// CODE
+namespace
+{
+  CWeatherFetcher fetcher;
+  AsyncClient* client = nullptr;
+  SOneCallForecast forecast;
+
+  bool finished = false;
+  EFetchError finishedError = FETCH_ERROR_NONE;
+  int finishedHttpCode = 0;
+
+  void FetchDone(EFetchError error, int httpCode)
+  {
+    CHECK(!finished);
+    finished = true;
+    finishedError = error;
+    finishedHttpCode = httpCode;
+  }
+
+  // Shaped like OneCall with exclude=current,minutely,daily,alerts, with the
+  // fields the parser skips
+  std::string MakeBody(int hours, bool closeArray = true)
+  {
+    std::string body = "{\"lat\":50.08,\"lon\":14.42,\"timezone\":\"Europe/Prague\",\"timezone_offset\":7200,\"hourly\":[";
+    for(int hour = 0; hour < hours; ++hour)
+    {
+      char entry[320];
+      snprintf(entry, sizeof(entry),
+        "%s{\"dt\":%lu,\"temp\":%.2f,\"feels_like\":%.2f,\"pressure\":1015,\"humidity\":71,"
+        "\"weather\":[{\"id\":%d,\"main\":\"Rain\",\"description\":\"light rain\",\"icon\":\"10d\"}],"
+        "\"pop\":%.2f,\"rain\":{\"1h\":0.31}}",
+        hour ? "," : "", TEST_FIRST_DT + hour * 3600UL, 12.5 + hour % 7, 11.25 + hour % 7, hour % 2 ? 500 : 803, (hour % 10) / 10.0);
+      body += entry;
+    }
+    if(closeArray)
+    {
+      body += "]}";
+    }
+    return body;
+  }
+
+  std::string MakeResponse(const char* statusLine, const std::string& body, const char* headers = "")
+  {
+    return std::string(statusLine) + "\r\nServer: openresty\r\nContent-Type: application/json; charset=utf-8\r\n" + headers + "\r\n" + body;
+  }
+
+  // Starts a fetch on a fresh connection and takes it to FETCH_HEADERS
+  void StartAndConnect()
+  {
+    finished = false;
+    client->ResetFake();
+    SetFakeDnsMode(FAKE_DNS_CACHED);
+
+    CHECK(fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    CHECK_EQUAL(FETCH_RESOLVING, fetcher.GetState());
+    fetcher.Run();
+    CHECK_EQUAL(FETCH_CONNECTING, fetcher.GetState());
+    CHECK_EQUAL(80, client->GetRemotePort());
+    CHECK_EQUAL(WEATHER_FETCH_RX_TIMEOUT_SEC, client->GetRxTimeout());
+
+    fetcher.Run();
+    CHECK_EQUAL(FETCH_CONNECTING, fetcher.GetState());
+    client->ServerAccept();
+    fetcher.Run();
+    CHECK_EQUAL(FETCH_SENDING, fetcher.GetState());
+    fetcher.Run();
+    CHECK_EQUAL(FETCH_HEADERS, fetcher.GetState());
+
+    const std::string& request = client->GetSent();
+    CHECK(request.find("GET " TEST_PATH " HTTP/1.0\r\n") == 0);
+    CHECK(request.find("\r\nHost: " TEST_HOST "\r\n") != std::string::npos);
+    CHECK(request.size() > 4 && request.compare(request.size() - 4, 4, "\r\n\r\n") == 0);
+  }
+
+  // Hands the server the response chunk bytes at a time, the fetcher runs
+  // once between chunks and the clock moves by step ms. The fetcher never
+  // takes more than a slice per run, or the window would be overrun.
+  void Serve(const std::string& response, size_t chunk, unsigned long step, bool closeAtEnd = false)
+  {
+    size_t offset = 0;
+    for(int run = 0; run < TEST_RUNS_MAX && !finished; ++run)
+    {
+      if(offset < response.size())
+      {
+        const size_t length = response.size() - offset < chunk ? response.size() - offset : chunk;
+        offset += client->ServerSend(response.data() + offset, length);
+      }
+      else if(closeAtEnd)
+      {
+        client->ServerClose();
+      }
+
+      AdvanceFakeMillis(step);
+      fetcher.Run();
+      CHECK(client->GetLargestAck() <= WEATHER_FETCH_SLICE_SIZE);
+    }
+    CHECK(finished);
+    CHECK_EQUAL(FETCH_IDLE, fetcher.GetState());
+    CHECK(client->IsClosed());
+  }
+
+  void CheckForecast(int hours)
+  {
+    CHECK_EQUAL(7200, forecast.m_timezoneOffset);
+    CHECK_EQUAL(hours, forecast.m_hourly.size());
+    for(int hour = 0; hour < hours; ++hour)
+    {
+      const SHourlyForecast& entry = forecast.m_hourly[hour];
+      CHECK_EQUAL(TEST_FIRST_DT + hour * 3600UL, entry.m_dt);
+      CHECK_EQUAL(hour % 2 ? 500 : 803, entry.m_weatherId);
+      CHECK(fabsf(entry.m_feelsLike - (11.25f + hour % 7)) < 0.001f);
+      CHECK(fabsf(entry.m_pop - (hour % 10) / 10.f) < 0.001f);
+    }
+  }
+
+  void CheckFinished(EFetchError error, int httpCode)
+  {
+    CHECK(finished);
+    if(finishedError != error)
+    {
+      fprintf(stderr, "finished with %s, expected %s\n", reinterpret_cast<const char*>(FetchErrorToString(finishedError)),
+        reinterpret_cast<const char*>(FetchErrorToString(error)));
+      exit(1);
+    }
+    CHECK_EQUAL(httpCode, finishedHttpCode);
+  }
+
+  void TestFastServer()
+  {
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 200 OK", MakeBody(ONECALL_HOURLY_MAX_COUNT + 2)), TCP_WND, 1);
+    CheckFinished(FETCH_ERROR_NONE, 200);
+    CheckForecast(ONECALL_HOURLY_MAX_COUNT);
+  }
+
+  void TestSlowServer()
+  {
+    // A byte per run, well inside the timeout
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 200 OK", MakeBody(ONECALL_HOURLY_MAX_COUNT)), 1, 0);
+    CheckFinished(FETCH_ERROR_NONE, 200);
+    CheckForecast(ONECALL_HOURLY_MAX_COUNT);
+
+    // Segments of odd sizes
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 200 OK", MakeBody(ONECALL_HOURLY_MAX_COUNT)), 37, 5);
+    CheckFinished(FETCH_ERROR_NONE, 200);
+    CheckForecast(ONECALL_HOURLY_MAX_COUNT);
+  }
+
+  void TestStalledServer()
+  {
+    // Headers, then nothing until the fetch times out
+    StartAndConnect();
+    const std::string headers = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n";
+    client->ServerSend(headers.data(), headers.size());
+    for(unsigned long elapsed = 0; elapsed <= WEATHER_FETCH_TIMEOUT && !finished; elapsed += 500)
+    {
+      fetcher.Run();
+      AdvanceFakeMillis(500);
+    }
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_TIMEOUT, 200);
+    CHECK(client->IsClosed());
+
+    // The RX timeout of the connection closes it first
+    StartAndConnect();
+    client->ServerSend(headers.data(), headers.size());
+    fetcher.Run();
+    client->ServerRxTimeout();
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_TRUNCATED, 200);
+  }
+
+  void TestEarlyClose()
+  {
+    // In the status line
+    StartAndConnect();
+    Serve("HTTP/1.1 50", 4, 1, true);
+    CheckFinished(FETCH_ERROR_TRUNCATED, 0);
+
+    // In the headers of a 200
+    StartAndConnect();
+    Serve("HTTP/1.1 200 OK\r\nContent-Type: app", 8, 1, true);
+    CheckFinished(FETCH_ERROR_TRUNCATED, 200);
+
+    // In the headers of an error response, its status decides
+    StartAndConnect();
+    Serve("HTTP/1.1 503 Service Unavailable\r\nRetry-After: 120\r\nConn", 8, 1, true);
+    CheckFinished(FETCH_ERROR_HTTP_SERVER, 503);
+    CHECK_EQUAL(120, fetcher.GetRetryAfter());
+
+    StartAndConnect();
+    Serve("HTTP/1.1 401 Unauthorized\r\n", 64, 1, true);
+    CheckFinished(FETCH_ERROR_HTTP_UNAUTHORIZED, 401);
+
+    // In the body
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 200 OK", MakeBody(20, false)), 512, 1, true);
+    CheckFinished(FETCH_ERROR_TRUNCATED, 200);
+    CHECK_EQUAL(20, forecast.m_hourly.size());
+
+    // Reset by the server
+    StartAndConnect();
+    const std::string response = MakeResponse("HTTP/1.1 200 OK", MakeBody(4, false));
+    client->ServerSend(response.data(), response.size());
+    client->ServerReset();
+    for(int run = 0; run < 100 && !finished; ++run)
+    {
+      fetcher.Run();
+    }
+    CheckFinished(FETCH_ERROR_TRUNCATED, 200);
+
+    // A complete response closed before the fetcher got to any of it
+    StartAndConnect();
+    const std::string complete = MakeResponse("HTTP/1.1 200 OK", MakeBody(16));
+    CHECK_EQUAL(complete.size(), client->ServerSend(complete.data(), complete.size()));
+    client->ServerClose();
+    for(int run = 0; run < TEST_RUNS_MAX && !finished; ++run)
+    {
+      fetcher.Run();
+    }
+    CheckFinished(FETCH_ERROR_NONE, 200);
+    CheckForecast(16);
+
+    // Fewer hours than asked for, the array end completes the forecast
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 200 OK", MakeBody(24)), 100, 1, true);
+    CheckFinished(FETCH_ERROR_NONE, 200);
+    CheckForecast(24);
+  }
+
+  void TestErrorResponses()
+  {
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 429 Too Many Requests", "{\"cod\":429}", "retry-after:  3600\r\n"), 16, 1);
+    CheckFinished(FETCH_ERROR_HTTP_RATE_LIMITED, 429);
+    CHECK_EQUAL(3600, fetcher.GetRetryAfter());
+
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 429 Too Many Requests", "", "Retry-After: 99999999\r\n"), 64, 1);
+    CheckFinished(FETCH_ERROR_HTTP_RATE_LIMITED, 429);
+    CHECK_EQUAL(WEATHER_FETCH_RETRY_AFTER_MAX_SEC, fetcher.GetRetryAfter());
+
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 502 Bad Gateway", "<html></html>"), 64, 1);
+    CheckFinished(FETCH_ERROR_HTTP_SERVER, 502);
+    CHECK_EQUAL(0, fetcher.GetRetryAfter());
+
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 404 Not Found", "{}"), 64, 1);
+    CheckFinished(FETCH_ERROR_HTTP_OTHER, 404);
+
+    StartAndConnect();
+    Serve(MakeResponse("HTTP/1.1 200 OK", "{\"hourly\":[{\"dt\":1}}"), 64, 1);
+    CheckFinished(FETCH_ERROR_PARSE, 200);
+  }
+
+  void TestOverrun()
+  {
+    // A server that ignores the window overruns the receive buffer
+    StartAndConnect();
+    const std::string response = MakeResponse("HTTP/1.1 200 OK", MakeBody(ONECALL_HOURLY_MAX_COUNT));
+    CHECK(response.size() > WEATHER_FETCH_BUFFER_SIZE);
+    client->ServerSend(response.data(), response.size(), true);
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_TRUNCATED, 0);
+  }
+
+  void TestResolving()
+  {
+    // Answered later by the DNS server
+    finished = false;
+    client->ResetFake();
+    SetFakeDnsMode(FAKE_DNS_PENDING);
+    CHECK(fetcher.Start(TEST_HOST, 8080, TEST_PATH, &forecast));
+    fetcher.Run();
+    fetcher.Run();
+    CHECK_EQUAL(FETCH_RESOLVING, fetcher.GetState());
+    CompleteFakeDns(true);
+    fetcher.Run();
+    CHECK_EQUAL(FETCH_CONNECTING, fetcher.GetState());
+    CHECK_EQUAL(8080, client->GetRemotePort());
+    CHECK_EQUAL(0x010200C0, static_cast<uint32_t>(client->GetRemoteAddress()));
+    client->ServerReset();
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_CONNECT, 0);
+
+    finished = false;
+    client->ResetFake();
+    CHECK(fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    fetcher.Run();
+    CompleteFakeDns(false);
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_DNS, 0);
+
+    // Never answered
+    finished = false;
+    client->ResetFake();
+    CHECK(fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    AdvanceFakeMillis(WEATHER_FETCH_TIMEOUT + 1);
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_TIMEOUT, 0);
+    // A late answer is ignored
+    CompleteFakeDns(true);
+    CHECK_EQUAL(FETCH_IDLE, fetcher.GetState());
+
+    finished = false;
+    SetFakeDnsMode(FAKE_DNS_FAILED);
+    CHECK(fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_DNS, 0);
+  }
+
+  void TestConnecting()
+  {
+    finished = false;
+    client->ResetFake(false);
+    SetFakeDnsMode(FAKE_DNS_CACHED);
+    CHECK(fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_CONNECT, 0);
+  }
+
+  void TestSending()
+  {
+    // No send space for a while, then the request in pieces
+    finished = false;
+    client->ResetFake();
+    SetFakeDnsMode(FAKE_DNS_CACHED);
+    CHECK(fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    fetcher.Run();
+    client->ServerAccept();
+    fetcher.Run();
+    client->SetSendSpace(0);
+    fetcher.Run();
+    fetcher.Run();
+    CHECK_EQUAL(FETCH_SENDING, fetcher.GetState());
+    CHECK(client->GetSent().empty());
+
+    client->SetSendSpace(10);
+    int runs = 0;
+    while(fetcher.GetState() == FETCH_SENDING && runs < 100)
+    {
+      fetcher.Run();
+      ++runs;
+    }
+    CHECK_EQUAL(FETCH_HEADERS, fetcher.GetState());
+    CHECK(runs > 5);
+    CHECK(client->GetSent().find("GET " TEST_PATH " HTTP/1.0\r\n") == 0);
+
+    // Closed before any of the response
+    finished = false;
+    client->ServerReset();
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_TRUNCATED, 0);
+
+    // Closed while sending
+    finished = false;
+    client->ResetFake();
+    CHECK(fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    fetcher.Run();
+    client->ServerAccept();
+    client->SetSendSpace(0);
+    fetcher.Run();
+    client->ServerReset();
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_CONNECT, 0);
+  }
+
+  void TestStart()
+  {
+    // A path that doesn't fit the request buffer
+    const std::string path(WEATHER_FETCH_REQUEST_SIZE, 'x');
+    CHECK(!fetcher.Start(TEST_HOST, 80, path.c_str(), &forecast));
+    CHECK(!fetcher.IsBusy());
+
+    // One fetch at a time
+    finished = false;
+    client->ResetFake();
+    SetFakeDnsMode(FAKE_DNS_PENDING);
+    CHECK(fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    CHECK(!fetcher.Start(TEST_HOST, 80, TEST_PATH, &forecast));
+    AdvanceFakeMillis(WEATHER_FETCH_TIMEOUT + 1);
+    fetcher.Run();
+    CheckFinished(FETCH_ERROR_TIMEOUT, 0);
+  }
+}
+
+int main()
+{
+  SetFakeMillis(1000);
+  client = AsyncClient::GetLatest();
+  CHECK(client);
+  fetcher.SetFetchDoneCb(FetchDone);
+
+  TestFastServer();
+  TestSlowServer();
+  TestStalledServer();
+  TestEarlyClose();
+  TestErrorResponses();
+  TestOverrun();
+  TestResolving();
+  TestConnecting();
+  TestSending();
+  TestStart();
+
+  printf("weather_fetcher_test: OK\n");
+  return 0;
+}
@@ -0,0 +1,146 @@
+// Coalescing, debouncing and the job states of CWorkQueue, on a clock the
+// test moves by hand.
+#include "WorkQueue.h"
+#include "TestHelpers.h"
+
+///////////////// CODE
+namespace
+{
+  CWorkQueue queue;
+  int runs[WORK_JOB_COUNT];
+  uint16_t runningId = 0;
+  EJobState stateWhileRunning = JOB_STATE_UNKNOWN;
+  uint16_t postedWhileRunning = 0;
+  // Finished jobs whose states have to outlast a burst
+  uint16_t finished[3];
+
+  // A save asks for a weather refresh 2 s later, like the sketch does.
+  // Resets fail.
+  bool RunJob(EWorkJob job)
+  {
+    ++runs[job];
+    stateWhileRunning = queue.GetState(runningId);
+    if(job == JOB_SAVE_CONFIG)
+    {
+      postedWhileRunning = queue.Post(JOB_REFRESH_WEATHER, 2000);
+    }
+    return job != JOB_RESET;
+  }
+
+  void TestCoalescing()
+  {
+    // Three quick saves are one write, only the latest id is remembered
+    const uint16_t first = queue.Post(JOB_SAVE_CONFIG);
+    const uint16_t second = queue.Post(JOB_SAVE_CONFIG);
+    const uint16_t third = queue.Post(JOB_SAVE_CONFIG);
+    CHECK(first && second && third);
+    CHECK(first != second && second != third);
+    CHECK_EQUAL(JOB_STATE_UNKNOWN, queue.GetState(first));
+    CHECK_EQUAL(JOB_STATE_UNKNOWN, queue.GetState(second));
+    CHECK_EQUAL(JOB_STATE_PENDING, queue.GetState(third));
+    CHECK_EQUAL(2, queue.GetJobsCoalesced());
+
+    runningId = third;
+    queue.Run();
+    CHECK_EQUAL(1, runs[JOB_SAVE_CONFIG]);
+    CHECK_EQUAL(JOB_STATE_RUNNING, stateWhileRunning);
+    CHECK_EQUAL(JOB_STATE_DONE, queue.GetState(third));
+    finished[0] = third;
+
+    // Posted from the running job, it doesn't join it
+    CHECK_EQUAL(JOB_STATE_PENDING, queue.GetState(postedWhileRunning));
+    queue.Run();
+    CHECK_EQUAL(1, runs[JOB_SAVE_CONFIG]);
+  }
+
+  void TestDebounce()
+  {
+    // The refresh posted by the save is due 2 s after it
+    const uint16_t refresh = postedWhileRunning;
+    AdvanceFakeMillis(1500);
+    queue.Run();
+    CHECK_EQUAL(0, runs[JOB_REFRESH_WEATHER]);
+
+    // Another save pushes it back to 2 s after the new one. A shorter delay
+    // doesn't pull it forward.
+    queue.Post(JOB_SAVE_CONFIG);
+    queue.Run();
+    CHECK_EQUAL(2, runs[JOB_SAVE_CONFIG]);
+    const uint16_t pushedBack = postedWhileRunning;
+    CHECK_EQUAL(JOB_STATE_UNKNOWN, queue.GetState(refresh));
+    CHECK_EQUAL(JOB_STATE_PENDING, queue.GetState(pushedBack));
+    CHECK_EQUAL(JOB_STATE_PENDING, queue.GetState(queue.Post(JOB_REFRESH_WEATHER, 0)));
+    const uint16_t latest = queue.Post(JOB_REFRESH_WEATHER, 100);
+
+    AdvanceFakeMillis(1000);
+    queue.Run();
+    CHECK_EQUAL(0, runs[JOB_REFRESH_WEATHER]);
+
+    AdvanceFakeMillis(1000);
+    queue.Run();
+    CHECK_EQUAL(1, runs[JOB_REFRESH_WEATHER]);
+    CHECK_EQUAL(JOB_STATE_DONE, queue.GetState(latest));
+    finished[1] = latest;
+  }
+
+  void TestStates()
+  {
+    const uint16_t reset = queue.Post(JOB_RESET, 500);
+    CHECK_EQUAL(JOB_STATE_PENDING, queue.GetState(reset));
+    CHECK(queue.IsPending(JOB_RESET));
+    queue.Run();
+    CHECK_EQUAL(JOB_STATE_PENDING, queue.GetState(reset));
+
+    AdvanceFakeMillis(500);
+    runningId = reset;
+    queue.Run();
+    CHECK_EQUAL(JOB_STATE_RUNNING, stateWhileRunning);
+    CHECK_EQUAL(JOB_STATE_FAILED, queue.GetState(reset));
+    CHECK(!queue.IsPending(JOB_RESET));
+    finished[2] = reset;
+
+    CHECK_EQUAL(JOB_STATE_UNKNOWN, queue.GetState(0));
+    CHECK_EQUAL(JOB_STATE_UNKNOWN, queue.GetState(60000));
+  }
+
+  void TestSlotCost()
+  {
+    // A burst of one kind holds one slot, so the states of earlier jobs
+    // stay around and nothing is turned away
+    const uint16_t restart = queue.Post(JOB_RESTART);
+    queue.Run();
+    CHECK_EQUAL(JOB_STATE_DONE, queue.GetState(restart));
+
+    const unsigned long rejected = queue.GetJobsRejected();
+    uint16_t saves[WORK_QUEUE_SIZE * 4];
+    for(uint16_t& save : saves)
+    {
+      save = queue.Post(JOB_SAVE_CONFIG, 1000);
+      CHECK(save);
+      CHECK(queue.Post(JOB_REFRESH_WEATHER, 3000));
+    }
+    CHECK_EQUAL(rejected, queue.GetJobsRejected());
+    CHECK_EQUAL(JOB_STATE_DONE, queue.GetState(restart));
+    CHECK_EQUAL(JOB_STATE_DONE, queue.GetState(finished[0]));
+    CHECK_EQUAL(JOB_STATE_DONE, queue.GetState(finished[1]));
+    CHECK_EQUAL(JOB_STATE_FAILED, queue.GetState(finished[2]));
+
+    AdvanceFakeMillis(1000);
+    queue.Run();
+    CHECK_EQUAL(JOB_STATE_DONE, queue.GetState(saves[WORK_QUEUE_SIZE * 4 - 1]));
+  }
+}
+
+int main()
+{
+  SetFakeMillis(1000);
+  queue.SetRunJobCb(RunJob);
+
+  TestCoalescing();
+  TestDebounce();
+  TestStates();
+  TestSlotCost();
+
+  printf("work_queue_test: %lu posted, %lu coalesced, %lu run OK\n", queue.GetJobsPosted(), queue.GetJobsCoalesced(), queue.GetJobsRun());
+  return 0;
+}
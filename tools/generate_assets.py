@@ -0,0 +1,462 @@
+#!/usr/bin/env python3
+"""Generates the PROGMEM bitmap headers of the sketch from the XBM files in assets/.
+
+Every bitmap is checked against the size its header declares, converted to the
+SH1106 page layout and stored run length compressed. The display streams the
+pages back with CRleBitmapReader (RleBitmap.h) and copies them straight into
+the u8g2 frame buffer.
+
+The page layout is the one of the U8G2_R1 rotation, in which a logical column
+of the portrait screen is a panel row and a logical row is a panel column
+counted from the right. Lit pixels are set: the XBM sources are inverted art
+that the sketch used to draw with draw color 0.
+
+U8G2_R3 is U8G2_R1 turned by 180 degrees, the display mirrors the same pages
+instead of keeping a second copy in flash.
+
+The weather icons are also written at half size for the 32 column screen of
+128x32 panels. A pixel of the small icon is lit when any of the 2x2 pixels it
+stands for is, so thin lines survive the scaling.
+
+The glyph atlas holds the temperature digits and the degree sign decoded from
+the U8g2 fonts the display used to draw them with. Each glyph is cut to the
+pixels it lights and stored uncompressed in the same page layout, so drawing a
+temperature is a copy out of PROGMEM and the fonts are not linked. The fonts
+are read from u8g2_fonts.c of the U8g2 library, without it an empty atlas is
+written and the sketch draws the glyphs through u8g2 as before.
+
+Web pages are stripped of their indentation and gzipped, the sketch serves
+them as they are with Content-Encoding: gzip. Their ETag is a hash of the
+gzipped bytes, so it changes exactly when the page does.
+
+Usage: python3 tools/generate_assets.py [U8g2 src dir]
+The U8g2 src dir defaults to $U8G2_SRC, then ~/Arduino/libraries/U8g2/src.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ASSETS = os.path.join(ROOT, 'assets')
+SKETCH = os.path.join(ROOT, 'WeatherStation_wemos_d1_mini_oled')
+
+WEATHER_ICONS = [
+    'thunder_light_rain_56x56', 'thunder_rain_56x56', 'thunder_56x56',
+    'light_rain_56x56', 'light_rain_day_56x56', 'light_rain_night_56x56',
+    'rain_56x56', 'rain_day_56x56', 'rain_night_56x56',
+    'snow_56x56', 'snow_shower_56x56', 'snow_heavy_shower_56x56', 'snow_rain_56x56', 'snow_heavy_rain_56x56',
+    'mist_56x56', 'sun_56x56', 'night_56x56',
+    'small_clouds_day_56x56', 'small_clouds_night_56x56',
+    'medium_clouds_day_56x56', 'medium_clouds_night_56x56', 'clouds_56x56',
+]
+
+WEATHER_ADDITIONAL_ICONS = ['more_rain_25x25', 'thunder_25x25', 'snow_25x25']
+
+WIFI_ANIMATION = ['wifi_animation_%d_64x64' % frame for frame in range(4)]
+
+# output header, include guard, groups of (size defines, width, height, asset dir, bitmaps, optional frame table,
+# halved). A halved group is scaled down from the XBM of twice its size and named after its own size.
+MANIFEST = [
+    ('weather_icons.h', '_WEATHER_ICONS_H_', [
+        (('WEATHER_ICON_W', 'WEATHER_ICON_H'), 56, 56, 'weather', WEATHER_ICONS, None, False),
+        (('WEATHER_ADDITIONAL_ICON_W', 'WEATHER_ADDITIONAL_ICON_H'), 25, 25, 'weather', WEATHER_ADDITIONAL_ICONS, None, False),
+        (('WEATHER_SMALL_ICON_W', 'WEATHER_SMALL_ICON_H'), 28, 28, 'weather', WEATHER_ICONS, None, True),
+        (('WEATHER_SMALL_ADDITIONAL_ICON_W', 'WEATHER_SMALL_ADDITIONAL_ICON_H'), 13, 13, 'weather', WEATHER_ADDITIONAL_ICONS, None, True),
+    ]),
+    ('wifi_icons.h', '_WIFI_ICONS_H_', [
+        (('WIFI_ICON_W', 'WIFI_ICON_H'), 64, 64, 'wifi', WIFI_ANIMATION,
+         ('wifi_animation_64x64_bits', 'WIFI_FRAME_ANIMATION_COUNT'), False),
+        (None, 64, 64, 'wifi', ['wifi_conected_64x64'], None, False),
+    ]),
+]
+
+# enum in GlyphAtlas.h, U8g2 font, characters the display draws with it
+GLYPH_FONTS = [
+    ('GLYPH_FONT_TEMPERATURE', 'u8g2_font_fub30_tn', ' -0123456789'),
+    ('GLYPH_FONT_EVENING_TEMPERATURE', 'u8g2_font_fub14_tn', ' -0123456789'),
+    ('GLYPH_FONT_DEGREE', 'u8g2_font_helvR12_tf', '\xb0'),
+]
+
+# Glyph pages are copied through a buffer of RLE_BITMAP_PAGE_COLUMNS_MAX bytes
+GLYPH_HEIGHT_MAX = 64
+
+# output header, include guard, page in assets/, array name
+WEB_PAGES = [
+    ('config_webpage.h', '_CONFIG_WEBPAGE_H_', 'web/config.html', 'CONFIG_HTML'),
+]
+
+
+def read_xbm(path):
+    with open(path) as xbm:
+        text = xbm.read()
+
+    width = int(re.search(r'#define\s+\w+_width\s+(\d+)', text).group(1))
+    height = int(re.search(r'#define\s+\w+_height\s+(\d+)', text).group(1))
+    data = [int(value, 16) for value in re.findall(r'0[xX][0-9a-fA-F]{1,2}', text.split('{', 1)[1])]
+
+    return width, height, data
+
+
+def halve(width, height, data):
+    """XBM data of the bitmap scaled to half its size, rounded up. The art is
+    inverted, so a pixel is lit when it is 0 and the 2x2 pixels are ANDed."""
+    row_bytes = (width + 7) // 8
+    half_width = (width + 1) // 2
+    half_height = (height + 1) // 2
+    half_row_bytes = (half_width + 7) // 8
+    half = [0] * (half_row_bytes * half_height)
+    for y in range(half_height):
+        for x in range(half_width):
+            pixel = 1
+            for source_y in range(2 * y, min(2 * y + 2, height)):
+                for source_x in range(2 * x, min(2 * x + 2, width)):
+                    pixel &= data[source_y * row_bytes + source_x // 8] >> (source_x % 8) & 1
+            half[y * half_row_bytes + x // 8] |= pixel << (x % 8)
+    return half_width, half_height, half
+
+
+def pages(width, height, data):
+    """Pixel stream of the bitmap in U8G2_R1 page layout: (width + 7) / 8
+    pages of height columns, every column byte holding 8 panel rows least
+    significant bit first. Rows past the bitmap width are padding and stay 0."""
+    row_bytes = (width + 7) // 8
+    stream = []
+    for page in range(row_bytes):
+        for column in range(height):
+            y = height - 1 - column
+            for bit in range(8):
+                x = page * 8 + bit
+                stream.append(0 if x >= width else 1 - ((data[y * row_bytes + x // 8] >> (x % 8)) & 1))
+    return stream
+
+
+def compress(stream):
+    """Run lengths of the pixel stream, runs alternate between 1 and 0 pixels
+    starting with 1. Every run length is a varint of nibbles, 3 bits of
+    payload each, bit 3 set when more follow. Nibbles fill a byte low nibble
+    first."""
+    runs = []
+    current = 1
+    length = 0
+    for pixel in stream:
+        if pixel == current:
+            length += 1
+        else:
+            runs.append(length)
+            current = pixel
+            length = 1
+    runs.append(length)
+
+    nibbles = []
+    for length in runs:
+        while True:
+            nibble = length & 0x7
+            length >>= 3
+            nibbles.append(nibble | (0x8 if length else 0))
+            if not length:
+                break
+
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [nibbles[index] | nibbles[index + 1] << 4 for index in range(0, len(nibbles), 2)]
+
+
+def decompress(count, packed):
+    nibbles = [nibble for value in packed for nibble in (value & 0xF, value >> 4)]
+    result = []
+    current = 0
+    index = 0
+    while len(result) < count:
+        length = 0
+        shift = 0
+        while True:
+            nibble = nibbles[index]
+            index += 1
+            length |= (nibble & 0x7) << shift
+            shift += 3
+            if not nibble & 0x8:
+                break
+        current ^= 1
+        result += [current] * length
+    return result[:count]
+
+
+def format_bytes(data):
+    lines = []
+    for start in range(0, len(data), 12):
+        lines.append('  ' + ' '.join('0x%02X,' % value for value in data[start:start + 12]))
+    return '\n'.join(lines)
+
+
+def generate(header, guard, groups):
+    out = ['// Generated by tools/generate_assets.py from assets/, do not edit.',
+           '// Bitmaps are run length compressed SH1106 pages, draw them through CWeatherDisplay::DrawPageBitmap.',
+           '#ifndef %s' % guard,
+           '#define %s' % guard,
+           '']
+    raw_total = 0
+    packed_total = 0
+
+    for defines, width, height, directory, bitmaps, frame_table, halved in groups:
+        if defines:
+            out += ['#define %s %d' % (defines[0], width), '#define %s %d' % (defines[1], height), '']
+
+        if halved:
+            bitmaps = [(re.sub(r'_\d+x\d+$', '_%dx%d' % (width, height), name), name) for name in bitmaps]
+        else:
+            bitmaps = [(name, name) for name in bitmaps]
+
+        for name, source in bitmaps:
+            path = os.path.join(ASSETS, directory, source + '.xbm')
+            xbm_width, xbm_height, data = read_xbm(path)
+            if halved:
+                if len(data) != (xbm_width + 7) // 8 * xbm_height:
+                    sys.exit('%s: %dx%d needs %d bytes, got %d'
+                             % (path, xbm_width, xbm_height, (xbm_width + 7) // 8 * xbm_height, len(data)))
+                xbm_width, xbm_height, data = halve(xbm_width, xbm_height, data)
+            expected = (width + 7) // 8 * height
+            if (xbm_width, xbm_height) != (width, height) or len(data) != expected:
+                sys.exit('%s: expected %dx%d (%d bytes), got %dx%d (%d bytes)'
+                         % (path, width, height, expected, xbm_width, xbm_height, len(data)))
+
+            stream = pages(width, height, data)
+            packed = compress(stream)
+            assert decompress(len(stream), packed) == stream
+            raw_total += len(data)
+            packed_total += len(packed)
+
+            out += ['// %d -> %d bytes' % (len(data), len(packed)),
+                    'static const unsigned char %s_bits[] PROGMEM = {' % name,
+                    format_bytes(packed),
+                    '};',
+                    '']
+
+        if frame_table:
+            table, count = frame_table
+            out += ['#define %s %d' % (count, len(bitmaps)),
+                    'static const unsigned char* const %s[%s] PROGMEM = {' % (table, count)]
+            out += ['  %s_bits,' % name for name, source in bitmaps]
+            out += ['};', '']
+
+    out += ['#endif', '']
+
+    with open(os.path.join(SKETCH, header), 'w', newline='\n') as generated:
+        generated.write('\n'.join(out))
+
+    print('%s: %d -> %d bytes' % (header, raw_total, packed_total))
+
+
+def read_u8g2_font(text, name):
+    """Bytes of the font array name in u8g2_fonts.c, a run of C string
+    literals."""
+    match = re.search(r'\b%s\[\d*\][^=;]*=((?:\s*"(?:[^"\\]|\\.)*")+)\s*;' % name, text)
+    if not match:
+        sys.exit('u8g2_fonts.c: %s not found' % name)
+
+    escapes = {'n': 10, 't': 9, 'r': 13, 'a': 7, 'b': 8, 'f': 12, 'v': 11, '\\': 92, '"': 34, "'": 39, '?': 63}
+    data = []
+    for literal in re.findall(r'"((?:[^"\\]|\\.)*)"', match.group(1)):
+        index = 0
+        while index < len(literal):
+            char = literal[index]
+            index += 1
+            if char != '\\':
+                data.append(ord(char))
+                continue
+            octal = re.match(r'[0-7]{1,3}', literal[index:])
+            hexadecimal = re.match(r'x([0-9a-fA-F]+)', literal[index:])
+            if octal:
+                data.append(int(octal.group(0), 8))
+                index += len(octal.group(0))
+            elif hexadecimal:
+                data.append(int(hexadecimal.group(1), 16) & 0xFF)
+                index += len(hexadecimal.group(0))
+            else:
+                data.append(escapes[literal[index]])
+                index += 1
+    return data
+
+
+class BitReader:
+    """Fields of a u8g2 glyph, packed least significant bit first."""
+
+    def __init__(self, data, start):
+        self.data = data
+        self.position = start * 8
+
+    def unsigned(self, count):
+        value = 0
+        for bit in range(count):
+            value |= (self.data[self.position >> 3] >> (self.position & 7) & 1) << bit
+            self.position += 1
+        return value
+
+    def signed(self, count):
+        return self.unsigned(count) - (1 << (count - 1))
+
+
+def decode_u8g2_glyph(font, encoding):
+    """Decodes a glyph the way u8g2_font_decode_glyph() draws it. Returns the
+    lit pixels as (x, y) from the cursor on the baseline and the advance."""
+    bits_per_0, bits_per_1, bits_width, bits_height, bits_x, bits_y, bits_delta = font[2:9]
+
+    # Glyphs below 256 are a list of encoding, offset to the next one and the
+    # bitstream, ended by an offset of 0
+    position = 23
+    while font[position + 1] and font[position] != encoding:
+        position += font[position + 1]
+    if not font[position + 1]:
+        return None
+
+    reader = BitReader(font, position + 2)
+    width = reader.unsigned(bits_width)
+    height = reader.unsigned(bits_height)
+    offset_x = reader.signed(bits_x)
+    offset_y = reader.signed(bits_y)
+    advance = reader.signed(bits_delta)
+
+    # Runs of background and foreground pixels fill the box row by row, a
+    # pair is repeated while a 1 bit follows it
+    pixels = []
+    pixel = 0
+    while width and pixel < width * height:
+        background = reader.unsigned(bits_per_0)
+        foreground = reader.unsigned(bits_per_1)
+        while True:
+            pixel += background
+            pixels += [((pixel + index) % width, (pixel + index) // width) for index in range(foreground)]
+            pixel += foreground
+            if not reader.unsigned(1):
+                break
+
+    top = -(height + offset_y)
+    return [(offset_x + x, top + y) for x, y in pixels if y < height], advance
+
+
+def generate_glyph_atlas(header, guard, u8g2_src):
+    path = os.path.join(u8g2_src, 'clib', 'u8g2_fonts.c')
+    out = ['// Generated by tools/generate_assets.py from the U8g2 fonts, do not edit.',
+           '// Glyphs are uncompressed SH1106 pages, look them up through CGlyphAtlas.',
+           '#ifndef %s' % guard,
+           '#define %s' % guard,
+           '']
+
+    if not os.path.exists(path):
+        out += ['// U8g2 was not found, the atlas is empty and the display draws the',
+                '// glyphs with the fonts through u8g2.',
+                '',
+                '#endif',
+                '']
+        with open(os.path.join(SKETCH, header), 'w', newline='\n') as generated:
+            generated.write('\n'.join(out))
+        print('%s: %s not found, empty atlas written' % (header, path))
+        return
+
+    with open(path, encoding='latin-1') as fonts:
+        text = fonts.read()
+
+    glyphs = []
+    bits = []
+    for enum, name, characters in GLYPH_FONTS:
+        font = read_u8g2_font(text, name)
+        for character in characters:
+            decoded = decode_u8g2_glyph(font, ord(character))
+            if decoded is None:
+                sys.exit('%s: no glyph for 0x%02X' % (name, ord(character)))
+            pixels, advance = decoded
+
+            # Cut to the lit pixels, like CWeatherDisplay clips the blit
+            left = top = width = height = 0
+            if pixels:
+                left = min(x for x, y in pixels)
+                top = min(y for x, y in pixels)
+                width = max(x for x, y in pixels) - left + 1
+                height = max(y for x, y in pixels) - top + 1
+            if height > GLYPH_HEIGHT_MAX:
+                sys.exit('%s: glyph 0x%02X is %d pixels high, at most %d fit'
+                         % (name, ord(character), height, GLYPH_HEIGHT_MAX))
+
+            # Same page layout as pages(), rows counted from the glyph bottom
+            data = [0] * ((width + 7) // 8 * height)
+            for x, y in pixels:
+                x -= left
+                column = height - 1 - (y - top)
+                data[(x >> 3) * height + column] |= 1 << (x & 7)
+
+            if ord(character) < 0x80 and character not in '\\\'':
+                literal = "'%s'" % character
+            else:
+                literal = "'\\x%02x'" % ord(character)
+            glyphs.append('  { %s, %s, %d, %d, %d, %d, %d, %d },'
+                          % (enum, literal, left, top, width, height, advance, len(bits)))
+            bits += data
+
+    out += ['#define GLYPH_ATLAS_GENERATED',
+            '#define GLYPH_ATLAS_GLYPH_COUNT %d' % len(glyphs),
+            '',
+            '// font, character, offset x, offset y, width, height, advance, first byte',
+            'static const SAtlasGlyph glyph_atlas_glyphs[GLYPH_ATLAS_GLYPH_COUNT] PROGMEM = {']
+    out += glyphs
+    out += ['};',
+            '',
+            '// %d bytes' % len(bits),
+            'static const uint8_t glyph_atlas_bits[] PROGMEM = {',
+            format_bytes(bits),
+            '};',
+            '',
+            '#endif',
+            '']
+
+    with open(os.path.join(SKETCH, header), 'w', newline='\n') as generated:
+        generated.write('\n'.join(out))
+
+    print('%s: %d glyphs, %d bytes' % (header, len(glyphs), len(bits)))
+
+
+def minify(text):
+    """Drops indentation and blank lines. Line breaks stay, the scripts rely
+    on them in place of semicolons."""
+    return '\n'.join(line.strip() for line in text.splitlines() if line.strip()) + '\n'
+
+
+def generate_web_page(header, guard, source, name):
+    with open(os.path.join(ASSETS, source), encoding='utf-8') as page:
+        text = page.read()
+
+    # mtime 0 keeps the output, and so the ETag, the same between runs
+    packed = gzip.compress(minify(text).encode('utf-8'), compresslevel=9, mtime=0)
+    etag = hashlib.sha1(packed).hexdigest()[:16]
+
+    out = ['// Generated by tools/generate_assets.py from assets/%s, do not edit.' % source,
+           '// Gzipped, send it with Content-Encoding: gzip.',
+           '#ifndef %s' % guard,
+           '#define %s' % guard,
+           '',
+           '// %d -> %d bytes' % (len(text.encode('utf-8')), len(packed)),
+           '#define %s_ETAG "\\"%s\\""' % (name, etag),
+           'const uint32_t %s_SIZE = %d;' % (name, len(packed)),
+           'static const uint8_t %s[] PROGMEM = {' % name,
+           format_bytes(packed),
+           '};',
+           '',
+           '#endif',
+           '']
+
+    with open(os.path.join(SKETCH, header), 'w', newline='\n') as generated:
+        generated.write('\n'.join(out))
+
+    print('%s: %d -> %d bytes' % (header, len(text.encode('utf-8')), len(packed)))
+
+
+if __name__ == '__main__':
+    u8g2_src = sys.argv[1] if len(sys.argv) > 1 else os.environ.get(
+        'U8G2_SRC', os.path.join(os.path.expanduser('~'), 'Arduino', 'libraries', 'U8g2', 'src'))
+
+    for header, guard, groups in MANIFEST:
+        generate(header, guard, groups)
+    for header, guard, source, name in WEB_PAGES:
+        generate_web_page(header, guard, source, name)
+    generate_glyph_atlas('glyph_atlas.h', '_GLYPH_ATLAS_H_', u8g2_src)